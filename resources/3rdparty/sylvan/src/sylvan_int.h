@@ -112,6 +112,7 @@ static const uint64_t CACHE_MTBDD_EQUAL_NORM_RF     = (66LL<<40);
 static const uint64_t CACHE_MTBDD_EQUAL_NORM_REL_RF = (67LL<<40);
 
 static const uint64_t CACHE_MTBDD_ABSTRACT_REPRESENTATIVE = (68LL<<40);
+static const uint64_t CACHE_MTBDD_AND_ABSTRACT_PLUS_PLUS_ABSTRACT_MINMAX = (69LL<<40);
     
 #ifdef __cplusplus
 }
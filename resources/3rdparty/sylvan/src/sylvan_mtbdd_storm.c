@@ -1014,6 +1014,97 @@ TASK_IMPL_3(BDD, mtbdd_max_abstract_representative, MTBDD, a, MTBDD, v, uint32_t
     }	
 }
 
+TASK_IMPL_6(MTBDD, mtbdd_and_abstract_plus_plus_abstract_minmax, MTBDD, a, MTBDD, b, MTBDD, c, MTBDD, sumvars, MTBDD, vars, int, maximize)
+{
+    /* Check terminal case */
+    if (vars == mtbdd_true) {
+        MTBDD product = mtbdd_refs_push(mtbdd_and_abstract_plus(a, b, sumvars));
+        MTBDD result = mtbdd_plus(product, c);
+        mtbdd_refs_pop(1);
+        return result;
+    }
+
+    /* Maybe perform garbage collection */
+    sylvan_gc_test();
+
+    /* Check cache */
+    MTBDD result;
+    if (cache_get6(CACHE_MTBDD_AND_ABSTRACT_PLUS_PLUS_ABSTRACT_MINMAX | a, b, c, sumvars, vars, (uint64_t)maximize, &result, NULL)) {
+        return result;
+    }
+
+    /* Get top variable */
+    int la = mtbdd_isleaf(a);
+    int lb = mtbdd_isleaf(b);
+    int lc = mtbdd_isleaf(c);
+    mtbddnode_t na = la ? 0 : MTBDD_GETNODE(a);
+    mtbddnode_t nb = lb ? 0 : MTBDD_GETNODE(b);
+    mtbddnode_t nc = lc ? 0 : MTBDD_GETNODE(c);
+    uint32_t va = la ? 0xffffffff : mtbddnode_getvariable(na);
+    uint32_t vb = lb ? 0xffffffff : mtbddnode_getvariable(nb);
+    uint32_t vc = lc ? 0xffffffff : mtbddnode_getvariable(nc);
+    uint32_t var = va < vb ? va : vb;
+    var = vc < var ? vc : var;
+
+    mtbddnode_t nv = MTBDD_GETNODE(vars);
+    uint32_t vv = mtbddnode_getvariable(nv);
+
+    /* Check whether the top variable is summed over */
+    int sum_var = 0;
+    MTBDD s = sumvars;
+    while (s != mtbdd_true) {
+        mtbddnode_t ns = MTBDD_GETNODE(s);
+        uint32_t vs = mtbddnode_getvariable(ns);
+        if (vs >= var) {
+            sum_var = vs == var;
+            break;
+        }
+        s = node_gethigh(s, ns);
+    }
+
+    if (vv < var) {
+        /* The operands do not depend on the abstraction variable, so abstracting it does not change the result */
+        result = CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, a, b, c, sumvars, node_gethigh(vars, nv), maximize);
+    } else if (sum_var) {
+        /* The sum has to be computed before the remaining variables can be abstracted, so the operation cannot be fused */
+        MTBDD product = mtbdd_refs_push(mtbdd_and_abstract_plus(a, b, sumvars));
+        MTBDD sum = mtbdd_refs_push(mtbdd_plus(product, c));
+        result = maximize ? mtbdd_abstract_max(sum, vars) : mtbdd_abstract_min(sum, vars);
+        mtbdd_refs_pop(2);
+    } else {
+        /* Get cofactors */
+        MTBDD alow, ahigh, blow, bhigh, clow, chigh;
+        alow  = (!la && va == var) ? node_getlow(a, na)  : a;
+        ahigh = (!la && va == var) ? node_gethigh(a, na) : a;
+        blow  = (!lb && vb == var) ? node_getlow(b, nb)  : b;
+        bhigh = (!lb && vb == var) ? node_gethigh(b, nb) : b;
+        clow  = (!lc && vc == var) ? node_getlow(c, nc)  : c;
+        chigh = (!lc && vc == var) ? node_gethigh(c, nc) : c;
+
+        if (vv == var) {
+            /* Recursive, then abstract result */
+            MTBDD next = node_gethigh(vars, nv);
+            mtbdd_refs_spawn(SPAWN(mtbdd_and_abstract_plus_plus_abstract_minmax, ahigh, bhigh, chigh, sumvars, next, maximize));
+            MTBDD low = mtbdd_refs_push(CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, alow, blow, clow, sumvars, next, maximize));
+            MTBDD high = mtbdd_refs_push(mtbdd_refs_sync(SYNC(mtbdd_and_abstract_plus_plus_abstract_minmax)));
+            result = maximize ? mtbdd_max(low, high) : mtbdd_min(low, high);
+            mtbdd_refs_pop(2);
+        } else /* vv > var */ {
+            /* Recursive, then create node */
+            mtbdd_refs_spawn(SPAWN(mtbdd_and_abstract_plus_plus_abstract_minmax, ahigh, bhigh, chigh, sumvars, vars, maximize));
+            MTBDD low = mtbdd_refs_push(CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, alow, blow, clow, sumvars, vars, maximize));
+            MTBDD high = mtbdd_refs_sync(SYNC(mtbdd_and_abstract_plus_plus_abstract_minmax));
+            mtbdd_refs_pop(1);
+            result = mtbdd_makenode(var, low, high);
+        }
+    }
+
+    /* Store in cache */
+    cache_put6(CACHE_MTBDD_AND_ABSTRACT_PLUS_PLUS_ABSTRACT_MINMAX | a, b, c, sumvars, vars, (uint64_t)maximize, result, 0);
+
+    return result;
+}
+
 TASK_IMPL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, dd, mtbdd_uapply_op, op, size_t, param)
 {
     /* Maybe perform garbage collection */
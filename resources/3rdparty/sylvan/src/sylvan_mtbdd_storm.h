@@ -164,6 +164,16 @@ TASK_DECL_3(BDD, mtbdd_min_abstract_representative, MTBDD, MTBDD, uint32_t);
 TASK_DECL_3(BDD, mtbdd_max_abstract_representative, MTBDD, MTBDD, uint32_t);
 #define mtbdd_max_abstract_representative(a, vars) (CALL(mtbdd_max_abstract_representative, a, vars, 0))
 
+/**
+ * Multiply <a> and <b>, abstract the variables <sumvars> using summation, add <c> and finally abstract the variables
+ * <vars> by taking the minimum (or the maximum if <maximize> is nonzero). This fuses the operations of one step of
+ * value iteration for MDPs into one operation, so that all steps of the recursion can be executed in parallel.
+ * Intermediate results are only computed (and cached) for the cofactors in which <vars> are not yet abstracted.
+ */
+TASK_DECL_6(MTBDD, mtbdd_and_abstract_plus_plus_abstract_minmax, MTBDD, MTBDD, MTBDD, MTBDD, MTBDD, int);
+#define mtbdd_and_abstract_plus_plus_abstract_min(a, b, c, sumvars, vars) (CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, a, b, c, sumvars, vars, 0))
+#define mtbdd_and_abstract_plus_plus_abstract_max(a, b, c, sumvars, vars) (CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, a, b, c, sumvars, vars, 1))
+
 // A version of unary apply that performs no caching. This is needed of the argument is actually used by the unary operation,
 // but may not be used to identify cache entries, for example if the argument is a pointer.
 TASK_DECL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, mtbdd_uapply_op, size_t);
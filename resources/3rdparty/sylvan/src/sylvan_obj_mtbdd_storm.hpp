@@ -27,6 +27,8 @@ Mtbdd Ceil() const;
 Mtbdd Minimum() const;
 Mtbdd Maximum() const;
 
+Mtbdd AndExistsPlusAbstractMinMax(const Mtbdd &other, const BddSet &summationVariables, const Mtbdd &offset, const BddSet &abstractionVariables, bool maximize) const;
+
 bool EqualNorm(const Mtbdd& other, double epsilon) const;
 bool EqualNormRel(const Mtbdd& other, double epsilon) const;
 
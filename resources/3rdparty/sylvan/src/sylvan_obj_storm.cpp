@@ -187,6 +187,12 @@ Mtbdd::Maximum() const {
     return mtbdd_maximum(mtbdd);
 }
 
+Mtbdd
+Mtbdd::AndExistsPlusAbstractMinMax(const Mtbdd &other, const BddSet &summationVariables, const Mtbdd &offset, const BddSet &abstractionVariables, bool maximize) const {
+    LACE_ME;
+    return CALL(mtbdd_and_abstract_plus_plus_abstract_minmax, mtbdd, other.mtbdd, offset.mtbdd, summationVariables.set.bdd, abstractionVariables.set.bdd, maximize ? 1 : 0);
+}
+
 bool
 Mtbdd::EqualNorm(const Mtbdd& other, double epsilon) const {
     LACE_ME;
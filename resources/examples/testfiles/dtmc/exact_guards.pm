@@ -0,0 +1,13 @@
+// A model whose guards only hold if they are evaluated exactly: in floating point arithmetic, 3*0.1 differs from 0.3.
+dtmc
+
+module counter
+
+	x : [0..4] init 0;
+	
+	[] x<3 -> 1/3 : (x'=x+1) + 2/3 : true;
+	[] x*0.1=0.3 -> 1 : (x'=4);
+	[] x=3 & x*0.1!=0.3 -> 1 : true;
+	[] x=4 -> 1 : true;
+	
+endmodule
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/parser/AutoParser.h"
+#include "storm/parser/BinaryModelParser.h"
 #include "storm/parser/DirectEncodingParser.h"
 #include "storm/parser/ImcaMarkovAutomatonParser.h"
 
@@ -23,6 +24,9 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -40,6 +44,10 @@ namespace storm {
                     options.buildAllRewardModels = true;
                 }
                 
+                auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+                options.computeVariableOrder = buildSettings.isDdVariableOrderSet();
+                options.siftVariableOrder = buildSettings.isDdSiftingSet();
+                
                 storm::builder::DdPrismModelBuilder<LibraryType, ValueType> builder;
                 return builder.build(model.asPrismProgram(), options);
             } else {
@@ -52,6 +60,10 @@ namespace storm {
                     options.buildAllRewardModels = true;
                 }
                 
+                auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+                options.computeVariableOrder = buildSettings.isDdVariableOrderSet();
+                options.siftVariableOrder = buildSettings.isDdSiftingSet();
+                
                 storm::builder::DdJaniModelBuilder<LibraryType, ValueType> builder;
                 return builder.build(model.asJaniModel(), options);
             }
@@ -128,6 +140,16 @@ namespace storm {
             return storm::parser::AutoParser<double, double>::parseModel(transitionsFile, labelingFile, stateRewardsFile ? stateRewardsFile.get() : "", transitionRewardsFile ? transitionRewardsFile.get() : "", choiceLabelingFile ? choiceLabelingFile.get() : "" );
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unable to load " << binaryFile << ": exact or parametric models in the binary format are not supported.");
+        }
+        
+        template<>
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            return storm::parser::BinaryModelParser<double>::parseModel(binaryFile);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(std::string const& drnFile) {
             return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile);
@@ -24,6 +24,7 @@
 
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -115,7 +116,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> const& resultHintCache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
                 storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
@@ -124,6 +125,7 @@ namespace storm {
                 }
             } else {
                 storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                modelchecker.setResultHintCache(resultHintCache);
                 if (modelchecker.canHandle(task)) {
                     result = modelchecker.check(task);
                 }
@@ -161,6 +163,22 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> const& qualitativeAnalysisCache, std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> const& resultHintCache = nullptr) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp, qualitativeAnalysisCache);
+            modelchecker.setResultHintCache(resultHintCache);
+            if (modelchecker.canHandle(task)) {
+                result = modelchecker.check(task);
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> const&, std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> const& = nullptr) {
+            return verifyWithSparseEngine(mdp, task);
+        }
+        
         template<typename ValueType>
         typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -200,6 +218,56 @@ namespace storm {
             return result;
         }
         
+        /*!
+         * Creates a cache through which the graph analyses on the given model are shared among its properties,
+         * provided this is enabled in the settings and supported for the model.
+         */
+        template<typename ValueType>
+        std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> createQualitativeAnalysisCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> result;
+            uint64_t capacity = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getQualitativeAnalysisCacheCapacity();
+            if (capacity > 0 && model->getType() == storm::models::ModelType::Mdp) {
+                result = std::make_shared<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>>(model->getTransitionMatrix(), capacity);
+            }
+            return result;
+        }
+        
+        /*!
+         * Creates a cache through which the results of earlier properties on the given model serve as hints for
+         * later compatible properties, provided this is enabled in the settings and supported for the model.
+         */
+        template<typename ValueType>
+        std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> createResultHintCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> result;
+            auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+            if (!std::is_same<ValueType, storm::RationalFunction>::value && modelCheckerSettings.isWarmStartSet() && (model->getType() == storm::models::ModelType::Dtmc || model->getType() == storm::models::ModelType::Mdp)) {
+                result = std::make_shared<storm::modelchecker::ResultHintCache<ValueType>>(modelCheckerSettings.getWarmStartCapacity());
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> const& qualitativeAnalysisCache, std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> const& resultHintCache = nullptr) {
+            if ((qualitativeAnalysisCache || resultHintCache) && model->getType() == storm::models::ModelType::Mdp) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), task, qualitativeAnalysisCache, resultHintCache);
+            } else if (resultHintCache && model->getType() == storm::models::ModelType::Dtmc) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::Dtmc<ValueType>>(), task, resultHintCache);
+            }
+            return verifyWithSparseEngine(model, task);
+        }
+        
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<ValueType>> qualitativeAnalysisCache = createQualitativeAnalysisCache(model);
+            std::shared_ptr<storm::modelchecker::ResultHintCache<ValueType>> resultHintCache = createResultHintCache(model);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+            results.reserve(tasks.size());
+            for (auto const& task : tasks) {
+                results.push_back(verifyWithSparseEngine(model, task, qualitativeAnalysisCache, resultHintCache));
+            }
+            return results;
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
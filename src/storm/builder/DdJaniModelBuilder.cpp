@@ -1,4 +1,5 @@
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include <sstream>
 
@@ -46,18 +47,18 @@ namespace storm {
     namespace builder {
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -261,7 +262,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, boost::optional<std::vector<storm::expressions::Variable>> const& variableOrder = boost::none) : model(model), automata(), actionInformation(actionInformation), variableOrder(variableOrder) {
                 // Intentionally left empty.
             }
             
@@ -327,12 +328,44 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // If an order was given, we create the meta variables of the model variables in this order up front.
+                if (variableOrder) {
+                    std::map<storm::expressions::Variable, std::pair<std::string, boost::optional<std::pair<int_fast64_t, int_fast64_t>>>> variableToNameAndBoundsMap;
+                    for (auto const& automatonName : this->automata) {
+                        storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                        variableToNameAndBoundsMap.emplace(automaton.getLocationExpressionVariable(), std::make_pair("l_" + automaton.getName(), std::pair<int_fast64_t, int_fast64_t>(0, automaton.getNumberOfLocations() - 1)));
+                    }
+                    auto addVariables = [&variableToNameAndBoundsMap] (storm::jani::VariableSet const& variables) {
+                        for (auto const& variable : variables) {
+                            if (variable.isTransient()) {
+                                continue;
+                            }
+                            if (variable.isBoundedIntegerVariable()) {
+                                storm::jani::BoundedIntegerVariable const& integerVariable = variable.asBoundedIntegerVariable();
+                                variableToNameAndBoundsMap.emplace(variable.getExpressionVariable(), std::make_pair(variable.getExpressionVariable().getName(), std::make_pair(integerVariable.getLowerBound().evaluateAsInt(), integerVariable.getUpperBound().evaluateAsInt())));
+                            } else {
+                                variableToNameAndBoundsMap.emplace(variable.getExpressionVariable(), std::make_pair(variable.getExpressionVariable().getName(), boost::none));
+                            }
+                        }
+                    };
+                    addVariables(this->model.getGlobalVariables());
+                    for (auto const& automaton : this->model.getAutomata()) {
+                        addVariables(automaton.getVariables());
+                    }
+                    
+                    for (auto const& variable : variableOrder.get()) {
+                        auto it = variableToNameAndBoundsMap.find(variable);
+                        STORM_LOG_THROW(it != variableToNameAndBoundsMap.end(), storm::exceptions::InvalidArgumentException, "The variable order refers to the unknown variable '" << variable.getName() << "'.");
+                        getOrAddMetaVariables(variable, it->second.first, it->second.second, result);
+                    }
+                }
+                
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
                     
                     // Start by creating a meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(locationExpressionVariable, "l_" + automaton.getName(), std::pair<int_fast64_t, int_fast64_t>(0, automaton.getNumberOfLocations() - 1), result);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
                     result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -397,6 +430,18 @@ namespace storm {
                 return result;
             }
             
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> const& getOrAddMetaVariables(storm::expressions::Variable const& variable, std::string const& name, boost::optional<std::pair<int_fast64_t, int_fast64_t>> const& bounds, CompositionVariables<Type, ValueType>& result) {
+                auto it = variableToMetaVariablesMap.find(variable);
+                if (it == variableToMetaVariablesMap.end()) {
+                    if (bounds) {
+                        it = variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(name, bounds.get().first, bounds.get().second)).first;
+                    } else {
+                        it = variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(name)).first;
+                    }
+                }
+                return it->second;
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -410,7 +455,7 @@ namespace storm {
             void createVariable(storm::jani::BoundedIntegerVariable const& variable, CompositionVariables<Type, ValueType>& result) {
                 int_fast64_t low = variable.getLowerBound().evaluateAsInt();
                 int_fast64_t high = variable.getUpperBound().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(variable.getExpressionVariable(), variable.getExpressionVariable().getName(), std::make_pair(low, high), result);
                 
                 STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -430,7 +475,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BooleanVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(variable.getExpressionVariable(), variable.getExpressionVariable().getName(), boost::none, result);
                 
                 STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -453,6 +498,10 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            boost::optional<std::vector<storm::expressions::Variable>> variableOrder;
+            
+            // The row and column meta variables of the model variables that were already created.
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1958,7 +2007,11 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            boost::optional<std::vector<storm::expressions::Variable>> variableOrder = options.variableOrder;
+            if (!variableOrder && options.computeVariableOrder) {
+                variableOrder = DdVariableOrdering::computeOrder(preparedModel);
+            }
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, variableOrder);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -2008,7 +2061,21 @@ namespace storm {
             modelComponents.labelToExpressionMap = buildLabelExpressions(preparedModel, variables, options);
             
             // Finally, create the model.
-            return createModel(preparedModel.getModelType(), variables, modelComponents);
+            std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result = createModel(preparedModel.getModelType(), variables, modelComponents);
+            
+            // If requested, we try to improve the variable order by sifting. If the DDs cannot be reordered in place,
+            // the model is rebuilt with the improved order (if it pays off).
+            if (options.siftVariableOrder) {
+                boost::optional<std::vector<storm::expressions::Variable>> siftedVariableOrder = DdVariableOrdering::sift(*result, *variables.variableToRowMetaVariableMap);
+                if (siftedVariableOrder) {
+                    Options siftedOptions = options;
+                    siftedOptions.siftVariableOrder = false;
+                    siftedOptions.variableOrder = siftedVariableOrder;
+                    return this->build(model, siftedOptions);
+                }
+            }
+            
+            return result;
         }
         
         template class DdJaniModelBuilder<storm::dd::DdType::CUDD, double>;
@@ -103,6 +103,18 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<storm::expressions::Expression> negatedTerminalStates;
+                
+                // A flag indicating whether the meta variables of the model variables are to be created in an order
+                // that is computed from the dependencies between the variables (rather than in declaration order).
+                bool computeVariableOrder;
+                
+                // A flag indicating whether the variable order is to be improved by sifting after the model was built.
+                // If this yields a smaller transition matrix, the model is rebuilt using the improved order.
+                bool siftVariableOrder;
+                
+                // An optional order of the (non-transient) model variables including the location variables. If this
+                // is set, the meta variables of these variables are created in this order and no order is computed.
+                boost::optional<std::vector<storm::expressions::Variable>> variableOrder;
             };
                         
             /*!
@@ -1,4 +1,5 @@
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -92,10 +93,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, boost::optional<std::vector<storm::expressions::Variable>> const& variableOrder = boost::none) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(variableOrder);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -148,14 +149,35 @@ namespace storm {
             // DDs representing the valid ranges of the variables of each module.
             std::map<std::string, storm::dd::Add<Type, ValueType>> moduleToRangeMap;
             
+            // The row and column meta variables of each program variable.
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
+            
             // The parameters appearing in the model.
             std::set<storm::RationalFunctionVariable> parameters;
             
         private:
+            /*!
+             * Creates the row and column meta variables for the given program variable (unless they were already
+             * created).
+             */
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> const& getOrAddMetaVariables(storm::expressions::Variable const& variable, boost::optional<std::pair<int_fast64_t, int_fast64_t>> const& bounds) {
+                auto it = variableToMetaVariablesMap.find(variable);
+                if (it == variableToMetaVariablesMap.end()) {
+                    if (bounds) {
+                        it = variableToMetaVariablesMap.emplace(variable, manager->addMetaVariable(variable.getName(), bounds.get().first, bounds.get().second)).first;
+                    } else {
+                        it = variableToMetaVariablesMap.emplace(variable, manager->addMetaVariable(variable.getName())).first;
+                    }
+                }
+                return it->second;
+            }
+            
             /*!
              * Creates the required meta variables and variable/module identities.
+             *
+             * @param variableOrder If given, the meta variables of the program variables are created in this order.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(boost::optional<std::vector<storm::expressions::Variable>> const& variableOrder) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,11 +197,36 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
+                // If an order was given, we create the meta variables of the program variables in this order up front.
+                if (variableOrder) {
+                    std::map<storm::expressions::Variable, boost::optional<std::pair<int_fast64_t, int_fast64_t>>> variableToBoundsMap;
+                    for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+                        variableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
+                        variableToBoundsMap.emplace(booleanVariable.getExpressionVariable(), boost::none);
+                    }
+                    for (storm::prism::Module const& module : program.getModules()) {
+                        for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                            variableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                        }
+                        for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                            variableToBoundsMap.emplace(booleanVariable.getExpressionVariable(), boost::none);
+                        }
+                    }
+                    
+                    for (auto const& variable : variableOrder.get()) {
+                        auto it = variableToBoundsMap.find(variable);
+                        STORM_LOG_THROW(it != variableToBoundsMap.end(), storm::exceptions::InvalidArgumentException, "The variable order refers to the unknown variable '" << variable.getName() << "'.");
+                        getOrAddMetaVariables(variable, it->second);
+                    }
+                }
+                
                 // Create meta variables for global program variables.
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
                     int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
                     int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(integerVariable.getExpressionVariable(), std::make_pair(low, high));
                     
                     STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -196,7 +243,7 @@ namespace storm {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(booleanVariable.getExpressionVariable(), boost::none);
                     
                     STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -221,7 +268,7 @@ namespace storm {
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
                         int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
                         int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(integerVariable.getExpressionVariable(), std::make_pair(low, high));
                         STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -238,7 +285,7 @@ namespace storm {
                         rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = getOrAddMetaVariables(booleanVariable.getExpressionVariable(), boost::none);
                         STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -540,18 +587,18 @@ namespace storm {
         };
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), computeVariableOrder(false), siftVariableOrder(false), variableOrder() {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -1342,7 +1389,11 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            boost::optional<std::vector<storm::expressions::Variable>> variableOrder = options.variableOrder;
+            if (!variableOrder && options.computeVariableOrder) {
+                variableOrder = DdVariableOrdering::computeOrder(program);
+            }
+            GenerationInformation generationInfo(program, variableOrder);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -1504,6 +1555,18 @@ namespace storm {
                 result->addParameters(generationInfo.parameters);
             }
             
+            // If requested, we try to improve the variable order by sifting. If the DDs cannot be reordered in place,
+            // the model is rebuilt with the improved order (if it pays off).
+            if (options.siftVariableOrder) {
+                boost::optional<std::vector<storm::expressions::Variable>> siftedVariableOrder = DdVariableOrdering::sift(*result, *generationInfo.variableToRowMetaVariableMap);
+                if (siftedVariableOrder) {
+                    Options siftedOptions = options;
+                    siftedOptions.siftVariableOrder = false;
+                    siftedOptions.variableOrder = siftedVariableOrder;
+                    return this->build(program, siftedOptions);
+                }
+            }
+            
             return result;
         }
         
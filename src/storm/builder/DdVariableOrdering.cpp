@@ -0,0 +1,323 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/models/symbolic/Model.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace builder {
+        
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrder(storm::prism::Program const& program) {
+            std::vector<storm::expressions::Variable> variables;
+            for (auto const& variable : program.getGlobalIntegerVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& variable : program.getGlobalBooleanVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& module : program.getModules()) {
+                for (auto const& variable : module.getIntegerVariables()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getBooleanVariables()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+            }
+            
+            // Every unlabeled command is a dependency on its own. As the commands that synchronize on an action are
+            // combined when building the model, all of them form one dependency.
+            std::vector<std::set<storm::expressions::Variable>> dependencies;
+            std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionIndexToDependencyMap;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+                    for (auto const& update : command.getUpdates()) {
+                        std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                        commandVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                        for (auto const& assignment : update.getAssignments()) {
+                            commandVariables.insert(assignment.getVariable());
+                            std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                            commandVariables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                        }
+                    }
+                    
+                    if (command.isLabeled()) {
+                        actionIndexToDependencyMap[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+                    } else {
+                        dependencies.push_back(std::move(commandVariables));
+                    }
+                }
+            }
+            for (auto& actionIndexDependencyPair : actionIndexToDependencyMap) {
+                dependencies.push_back(std::move(actionIndexDependencyPair.second));
+            }
+            
+            return computeOrder(variables, dependencies);
+        }
+        
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrder(storm::jani::Model const& model) {
+            std::vector<storm::expressions::Variable> variables;
+            for (auto const& automaton : model.getAutomata()) {
+                variables.push_back(automaton.getLocationExpressionVariable());
+            }
+            for (auto const& variable : model.getGlobalVariables()) {
+                if (!variable.isTransient()) {
+                    variables.push_back(variable.getExpressionVariable());
+                }
+            }
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& variable : automaton.getVariables()) {
+                    if (!variable.isTransient()) {
+                        variables.push_back(variable.getExpressionVariable());
+                    }
+                }
+            }
+            
+            // Every silent edge is a dependency on its own. As the edges that synchronize on an action are combined
+            // when building the model, all of them form one dependency.
+            std::vector<std::set<storm::expressions::Variable>> dependencies;
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToDependencyMap;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> edgeVariables = edge.getGuard().getVariables();
+                    edgeVariables.insert(automaton.getLocationExpressionVariable());
+                    for (auto const& destination : edge.getDestinations()) {
+                        std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                        edgeVariables.insert(probabilityVariables.begin(), probabilityVariables.end());
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            edgeVariables.insert(assignment.getExpressionVariable());
+                            std::set<storm::expressions::Variable> assignmentVariables = assignment.getAssignedExpression().getVariables();
+                            edgeVariables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                        }
+                    }
+                    
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionIndexToDependencyMap[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+                    } else {
+                        dependencies.push_back(std::move(edgeVariables));
+                    }
+                }
+            }
+            for (auto& actionIndexDependencyPair : actionIndexToDependencyMap) {
+                dependencies.push_back(std::move(actionIndexDependencyPair.second));
+            }
+            
+            return computeOrder(variables, dependencies);
+        }
+        
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& dependencies) {
+            uint64_t const maximalNumberOfIterations = 50;
+            
+            std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                variableToIndexMap.emplace(variables[index], index);
+            }
+            
+            // Translate the dependencies to indices. Dependencies with less than two variables cannot be improved by
+            // any order, so we drop them.
+            std::vector<std::vector<uint64_t>> dependencyIndices;
+            for (auto const& dependency : dependencies) {
+                std::vector<uint64_t> indices;
+                for (auto const& variable : dependency) {
+                    auto it = variableToIndexMap.find(variable);
+                    if (it != variableToIndexMap.end()) {
+                        indices.push_back(it->second);
+                    }
+                }
+                if (indices.size() > 1) {
+                    dependencyIndices.push_back(std::move(indices));
+                }
+            }
+            if (dependencyIndices.empty()) {
+                return variables;
+            }
+            
+            std::vector<double> positions(variables.size());
+            std::iota(positions.begin(), positions.end(), 0.0);
+            auto computeSpan = [&dependencyIndices, &positions] () {
+                double span = 0;
+                for (auto const& indices : dependencyIndices) {
+                    auto minMax = std::minmax_element(indices.begin(), indices.end(), [&positions] (uint64_t first, uint64_t second) { return positions[first] < positions[second]; });
+                    span += positions[*minMax.second] - positions[*minMax.first];
+                }
+                return span;
+            };
+            
+            std::vector<uint64_t> order(variables.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint64_t> bestOrder = order;
+            double bestSpan = computeSpan();
+            STORM_LOG_TRACE("Initial span of the variable dependencies is " << bestSpan << ".");
+            
+            std::vector<double> newPositions(variables.size());
+            std::vector<uint64_t> numberOfDependencies(variables.size());
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+                // Move every variable to the average center of gravity of the dependencies it appears in.
+                std::fill(newPositions.begin(), newPositions.end(), 0.0);
+                std::fill(numberOfDependencies.begin(), numberOfDependencies.end(), 0);
+                for (auto const& indices : dependencyIndices) {
+                    double center = 0;
+                    for (auto index : indices) {
+                        center += positions[index];
+                    }
+                    center /= indices.size();
+                    for (auto index : indices) {
+                        newPositions[index] += center;
+                        ++numberOfDependencies[index];
+                    }
+                }
+                for (uint64_t index = 0; index < variables.size(); ++index) {
+                    newPositions[index] = numberOfDependencies[index] > 0 ? newPositions[index] / numberOfDependencies[index] : positions[index];
+                }
+                
+                // As the order is sorted by the current positions, sorting it stably breaks ties by the current position.
+                std::stable_sort(order.begin(), order.end(), [&newPositions] (uint64_t first, uint64_t second) { return newPositions[first] < newPositions[second]; });
+                for (uint64_t position = 0; position < order.size(); ++position) {
+                    positions[order[position]] = position;
+                }
+                
+                double span = computeSpan();
+                STORM_LOG_TRACE("Span of the variable dependencies after iteration " << iteration << " is " << span << ".");
+                if (span >= bestSpan) {
+                    break;
+                }
+                bestSpan = span;
+                bestOrder = order;
+            }
+            
+            std::vector<storm::expressions::Variable> result;
+            result.reserve(variables.size());
+            for (auto index : bestOrder) {
+                result.push_back(variables[index]);
+            }
+            return result;
+        }
+        
+        template<storm::dd::DdType Type, typename ValueType>
+        boost::optional<std::vector<storm::expressions::Variable>> DdVariableOrdering::sift(storm::models::symbolic::Model<Type, ValueType> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap) {
+            // Rebuilding the model only pays off if the transition matrix gets smaller by at least this fraction.
+            double const minimalGain = 0.05;
+            
+            uint64_t initialNodeCount = model.getTransitionMatrix().getNodeCount();
+            if (Type == storm::dd::DdType::CUDD) {
+                // The DDs can be reordered in place, which is much cheaper than evaluating candidate orders on copies.
+                // The row and column DD variables stay interleaved, as they are grouped by the manager.
+                model.getManager().triggerReordering();
+                STORM_LOG_INFO("Reordering the DD variables changed the size of the transition matrix from " << initialNodeCount << " to " << model.getTransitionMatrix().getNodeCount() << " nodes.");
+                return boost::none;
+            }
+            
+            std::map<storm::expressions::Variable, storm::expressions::Variable> rowMetaVariableToVariableMap;
+            for (auto const& variableMetaVariablePair : variableToRowMetaVariableMap) {
+                rowMetaVariableToVariableMap.emplace(variableMetaVariablePair.second, variableMetaVariablePair.first);
+            }
+            
+            // Group the row and column meta variables of every state variable and order the groups by their current
+            // position.
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> metaVariablePairs = model.getRowColumnMetaVariablePairs();
+            storm::dd::DdManager<Type> const& manager = model.getManager();
+            std::sort(metaVariablePairs.begin(), metaVariablePairs.end(), [&manager] (std::pair<storm::expressions::Variable, storm::expressions::Variable> const& first, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& second) { return manager.getMetaVariable(first.first).getHighestLevel() < manager.getMetaVariable(second.first).getHighestLevel(); });
+            std::vector<std::set<storm::expressions::Variable>> groups;
+            for (auto const& metaVariablePair : metaVariablePairs) {
+                groups.push_back({metaVariablePair.first, metaVariablePair.second});
+            }
+            
+            uint64_t nodeCount = initialNodeCount;
+            std::vector<uint64_t> order = sift(model.getTransitionMatrix(), groups, nodeCount);
+            if (nodeCount > (1 - minimalGain) * initialNodeCount) {
+                STORM_LOG_INFO("Sifting only reduced the transition matrix from " << initialNodeCount << " to " << nodeCount << " nodes, keeping the variable order.");
+                return boost::none;
+            }
+            STORM_LOG_INFO("Sifting reduced the transition matrix from " << initialNodeCount << " to " << nodeCount << " nodes.");
+            
+            std::vector<storm::expressions::Variable> result;
+            for (auto group : order) {
+                auto it = rowMetaVariableToVariableMap.find(metaVariablePairs[group].first);
+                STORM_LOG_THROW(it != rowMetaVariableToVariableMap.end(), storm::exceptions::InvalidArgumentException, "Unknown state variable for meta variable '" << metaVariablePairs[group].first.getName() << "'.");
+                result.push_back(it->second);
+            }
+            return result;
+        }
+        
+        template<storm::dd::DdType Type, typename ValueType>
+        std::vector<uint64_t> DdVariableOrdering::sift(storm::dd::Add<Type, ValueType> const& dd, std::vector<std::set<storm::expressions::Variable>> const& groups, uint64_t& nodeCount) {
+            // Stop moving a group in one direction once the DD is this much larger than the smallest one so far.
+            double const maximalGrowth = 1.1;
+            
+            // A group is moved by at most this many positions in each direction, so the number of candidate orders is
+            // linear in the number of groups.
+            int64_t const maximalDistance = 4;
+            
+            std::vector<uint64_t> order(groups.size());
+            std::iota(order.begin(), order.end(), 0);
+            nodeCount = dd.getNodeCount();
+            if (groups.size() < 2) {
+                return order;
+            }
+            
+            auto computeNodeCount = [&dd, &groups] (std::vector<uint64_t> const& candidateOrder) {
+                std::vector<std::set<storm::expressions::Variable>> orderedGroups;
+                orderedGroups.reserve(candidateOrder.size());
+                for (auto group : candidateOrder) {
+                    orderedGroups.push_back(groups[group]);
+                }
+                return dd.getNodeCountForOrder(orderedGroups);
+            };
+            
+            uint64_t bestNodeCount = nodeCount;
+            uint64_t initialNodeCount = nodeCount;
+            for (uint64_t group = 0; group < groups.size(); ++group) {
+                std::vector<uint64_t> remainingOrder = order;
+                uint64_t position = std::distance(order.begin(), std::find(order.begin(), order.end(), group));
+                remainingOrder.erase(remainingOrder.begin() + position);
+                
+                // Move the group down and then up, remembering the best position.
+                uint64_t bestPosition = position;
+                for (int64_t direction : {1, -1}) {
+                    int64_t firstPosition = std::max<int64_t>(0, static_cast<int64_t>(position) - maximalDistance);
+                    int64_t lastPosition = std::min<int64_t>(remainingOrder.size(), position + maximalDistance);
+                    for (int64_t candidatePosition = position + direction; candidatePosition >= firstPosition && candidatePosition <= lastPosition; candidatePosition += direction) {
+                        std::vector<uint64_t> candidateOrder = remainingOrder;
+                        candidateOrder.insert(candidateOrder.begin() + candidatePosition, group);
+                        uint64_t candidateNodeCount = computeNodeCount(candidateOrder);
+                        if (candidateNodeCount < bestNodeCount) {
+                            bestNodeCount = candidateNodeCount;
+                            bestPosition = candidatePosition;
+                        } else if (candidateNodeCount > maximalGrowth * bestNodeCount) {
+                            break;
+                        }
+                    }
+                }
+                
+                if (bestPosition != position) {
+                    STORM_LOG_TRACE("Sifting moved group " << group << " from position " << position << " to position " << bestPosition << ", the DD now has " << bestNodeCount << " nodes.");
+                    remainingOrder.insert(remainingOrder.begin() + bestPosition, group);
+                    order = std::move(remainingOrder);
+                }
+            }
+            
+            STORM_LOG_DEBUG("Sifting reduced the DD from " << initialNodeCount << " to " << bestNodeCount << " nodes.");
+            nodeCount = bestNodeCount;
+            return order;
+        }
+        
+        template boost::optional<std::vector<storm::expressions::Variable>> DdVariableOrdering::sift(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap);
+        template boost::optional<std::vector<storm::expressions::Variable>> DdVariableOrdering::sift(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap);
+        template boost::optional<std::vector<storm::expressions::Variable>> DdVariableOrdering::sift(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap);
+        template boost::optional<std::vector<storm::expressions::Variable>> DdVariableOrdering::sift(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap);
+    
+    }
+}
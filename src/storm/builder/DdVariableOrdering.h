@@ -0,0 +1,108 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    
+    namespace jani {
+        class Model;
+    }
+    
+    namespace dd {
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        class Add;
+    }
+    
+    namespace models {
+        namespace symbolic {
+            template<storm::dd::DdType Type, typename ValueType>
+            class Model;
+        }
+    }
+    
+    namespace builder {
+        
+        /*!
+         * Computes orders of the DD variables that encode the state variables of a model. The symbolic model builders
+         * create the meta variables in the computed order. Note that the DD variables of the row and column meta
+         * variables of one state variable are always interleaved.
+         */
+        class DdVariableOrdering {
+        public:
+            /*!
+             * Computes a static order of the state variables of the given program. Variables that are read and written
+             * by the same commands (or by commands that synchronize on the same action) are placed near each other.
+             *
+             * @param program The program whose variables to order.
+             * @return The (non-transient) state variables in the order in which their meta variables are to be created.
+             */
+            static std::vector<storm::expressions::Variable> computeOrder(storm::prism::Program const& program);
+            
+            /*!
+             * Computes a static order of the state variables (including the location variables) of the given JANI
+             * model. Variables that are read and written by the same edges (or by edges that synchronize on the same
+             * action) are placed near each other.
+             *
+             * @param model The model whose variables to order.
+             * @return The (non-transient) state variables in the order in which their meta variables are to be created.
+             */
+            static std::vector<storm::expressions::Variable> computeOrder(storm::jani::Model const& model);
+            
+            /*!
+             * Tries to improve the order of the state variables of the given model by sifting, i.e. by moving every
+             * variable to the position at which the transition matrix of the model is smallest. The row and column
+             * meta variables of a state variable are moved together.
+             *
+             * If the DD library supports reordering (CUDD), the DDs of the model are reordered in place with the
+             * reordering technique that is set for the library, so no order is returned. Otherwise, the candidate
+             * orders are evaluated on a copy of the transition matrix and the model needs to be rebuilt with the
+             * returned order.
+             *
+             * @param model The model whose variable order is to be improved.
+             * @param variableToRowMetaVariableMap A mapping from the state variables to their row meta variables.
+             * @return The improved order of the state variables, if the model needs to be rebuilt with it. This is
+             * only the case if the transition matrix gets considerably smaller.
+             */
+            template<storm::dd::DdType Type, typename ValueType>
+            static boost::optional<std::vector<storm::expressions::Variable>> sift(storm::models::symbolic::Model<Type, ValueType> const& model, std::map<storm::expressions::Variable, storm::expressions::Variable> const& variableToRowMetaVariableMap);
+        
+        private:
+            /*!
+             * Orders the given variables using the FORCE heuristic: starting from the given order, every variable is
+             * repeatedly moved to the average center of the dependencies it occurs in, until the total span of the
+             * dependencies does not decrease anymore.
+             *
+             * @param variables The variables in their initial order.
+             * @param dependencies Sets of variables that should be placed near each other. Variables that do not
+             * appear in the given variables are ignored.
+             * @return The ordered variables.
+             */
+            static std::vector<storm::expressions::Variable> computeOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& dependencies);
+            
+            /*!
+             * Improves the order of the given groups of meta variables with respect to the size of the given DD by
+             * sifting: every group is moved to the nearby positions (as long as the DD does not grow too much) and
+             * then fixed at the position at which the DD is smallest. The size of the DD for a candidate order is
+             * determined by permuting a copy of the DD, and the DD itself is not changed.
+             *
+             * @param dd The DD whose size is to be minimized.
+             * @param groups The groups of meta variables in the order in which they currently appear in the DD.
+             * @param nodeCount Is set to the number of nodes of the DD in the returned order.
+             * @return The indices of the groups in the order in which they are to appear.
+             */
+            template<storm::dd::DdType Type, typename ValueType>
+            static std::vector<uint64_t> sift(storm::dd::Add<Type, ValueType> const& dd, std::vector<std::set<storm::expressions::Variable>> const& groups, uint64_t& nodeCount);
+        };
+    
+    }
+}
@@ -1,6 +1,13 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <map>
+#include <type_traits>
+
+#include "storm-config.h"
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,6 +15,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/settings/modules/CoreSettings.h"
@@ -34,6 +42,9 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/ThreadPool.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -41,10 +52,28 @@
 
 namespace storm {
     namespace builder {
-                        
+        
+        namespace {
+            // The number of chunks (of the current exploration level) per thread.
+            static const uint64_t chunksPerThread = 8;
+            
+            /*!
+             * The behavior of a state that was explored by one of the workers of the parallel exploration. The
+             * successors are stored in the successor sequence of the worker in [successorsBegin, successorsEnd).
+             */
+            template<typename ValueType, typename StateType>
+            struct ExploredState {
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                uint64_t successorsBegin;
+                uint64_t successorsEnd;
+            };
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()), outOfCoreMemoryLimit(storm::settings::getModule<storm::settings::modules::BuildSettings>().getOutOfCoreMemoryLimit() * 1024 * 1024) {
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isOutOfCoreSet()) {
+                outOfCoreDirectory = storm::settings::getModule<storm::settings::modules::BuildSettings>().getOutOfCoreDirectory();
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -87,14 +116,12 @@ namespace storm {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
             // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
-            
-            StateType actualIndex = actualIndexBucketPair.first;
+            StateType actualIndex = stateStorage.findOrAddState(state, newIndex);
             
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
                     statesToExplore.emplace_front(state, actualIndex);
-
+                    
                     // Reserve one slot for the new state in the remapping.
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
                 } else if (options.explorationOrder == ExplorationOrder::Bfs) {
@@ -115,7 +142,29 @@ namespace storm {
                 // The bit vector will be resized when the correct size is known.
                 markovianStates = storm::storage::BitVector(1000);
             }
-
+            
+            if (exploreInParallel()) {
+                uint_fast64_t numberOfRowGroups = 0;
+                buildMatricesInParallel(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, numberOfRowGroups);
+                if (markovianStates) {
+                    markovianStates->resize(numberOfRowGroups, false);
+                }
+                return;
+            }
+            
+            if (options.outOfCoreDirectory) {
+                // The memory limit is shared equally by the states and the transitions. A state occupies its bits and
+                // its index in a hash map that may only be half full after it has grown.
+                uint64_t memoryLimit = options.outOfCoreMemoryLimit / 2;
+                uint64_t bytesPerState = 2 * (stateStorage.bitsPerState / 8 + sizeof(StateType));
+                stateStorage.spillStatesToDisk(options.outOfCoreDirectory.get(), memoryLimit / bytesPerState);
+                if (std::is_trivially_copyable<ValueType>::value) {
+                    transitionMatrixBuilder.spillEntriesToDisk(options.outOfCoreDirectory.get(), memoryLimit / sizeof(storm::storage::MatrixEntry<typename storm::storage::SparseMatrixBuilder<ValueType>::index_type, ValueType>));
+                } else {
+                    STORM_LOG_WARN("The transitions of models of this value type can not be written to disk. Keeping them in memory.");
+                }
+            }
+            
             // Create a callback for the next-state generator to enable it to request the index of states.
             std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
             
@@ -132,11 +181,12 @@ namespace storm {
             // Now explore the current state until there is no more reachable state.
             uint_fast64_t currentRowGroup = 0;
             uint_fast64_t currentRow = 0;
-
+            
             auto timeOfStart = std::chrono::high_resolution_clock::now();
             auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
+            bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet();
             
             // Perform a search through the model.
             while (!statesToExplore.empty()) {
@@ -158,91 +208,11 @@ namespace storm {
                 generator->load(currentState);
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
                 
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-                    
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-                    
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        
-                        // add the generated choice information
-                        if (choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                choiceInformationBuilder.addLabel(label, currentRow);
-                            }
-                        }
-                        if (choice.hasOriginData()) {
-                            choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
-                        }
-                        
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-                        
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                    }
-                    ++currentRowGroup;
+                // Deadlock states are only allowed if we are to fix them.
+                if (behavior.empty() && dontFixDeadlocks && behavior.wasExpanded()) {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
                 }
+                addStateBehaviorToMatrices(currentIndex, behavior, nullptr, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
                 
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
@@ -264,7 +234,7 @@ namespace storm {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
             }
-
+            
             // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
             // (reversed) mapping of row groups to indices.
             if (options.explorationOrder != ExplorationOrder::Bfs) {
@@ -278,7 +248,7 @@ namespace storm {
                 
                 // Fix (a).
                 transitionMatrixBuilder.replaceColumns(remapping, 0);
-
+                
                 // Fix (b).
                 std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
                 std::transform(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end(), newInitialStateIndices.begin(), [&remapping] (StateType const& state) { return remapping[state]; } );
@@ -286,10 +256,272 @@ namespace storm {
                 this->stateStorage.initialStateIndices = std::move(newInitialStateIndices);
                 
                 // Fix (c).
-                this->stateStorage.stateToId.remap([&remapping] (StateType const& state) { return remapping[state]; } );
+                this->stateStorage.remapStateIndices([&remapping] (StateType const& state) { return remapping[state]; } );
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehaviorToMatrices(StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* columnRemapping, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+            // If there is no behavior, we introduce a self-loop.
+            if (behavior.empty()) {
+                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                if (behavior.wasExpanded()) {
+                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                }
+                
+                if (markovianStates) {
+                    markovianStates.get().grow(currentRowGroup + 1, false);
+                    markovianStates.get().set(currentRowGroup);
+                }
+                
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                    }
+                    
+                    if (rewardModelBuilder.hasStateActionRewards()) {
+                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                    }
+                }
+                
+                ++currentRow;
+                ++currentRowGroup;
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                std::vector<std::pair<StateType, ValueType>> remappedEntries;
+                for (auto const& choice : behavior) {
+                    
+                    // add the generated choice information
+                    if (choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            choiceInformationBuilder.addLabel(label, currentRow);
+                        }
+                    }
+                    if (choice.hasOriginData()) {
+                        choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix. If the target states need to be remapped, we have
+                    // to restore the order of the columns.
+                    if (columnRemapping) {
+                        remappedEntries.clear();
+                        for (auto const& stateProbabilityPair : choice) {
+                            remappedEntries.emplace_back((*columnRemapping)[stateProbabilityPair.first], stateProbabilityPair.second);
+                        }
+                        std::sort(remappedEntries.begin(), remappedEntries.end(), [] (std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                        for (auto const& stateProbabilityPair : remappedEntries) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreInParallel() const {
+            if (options.numberOfThreads == 1) {
+                return false;
+            }
+            if (options.outOfCoreDirectory) {
+                STORM_LOG_WARN("Parallel exploration is not supported in the out-of-core mode. Exploring the state space sequentially.");
+                return false;
+            }
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Parallel exploration requires breadth-first exploration order. Exploring the state space sequentially.");
+                return false;
+            }
+#ifdef STORM_HAVE_CARL
+            if (std::is_same<ValueType, storm::RationalFunction>::value) {
+                // Arithmetic on rational functions is not thread-safe.
+                STORM_LOG_WARN("Parallel exploration is not supported for parametric models. Exploring the state space sequentially.");
+                return false;
+            }
+#endif
+            return true;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesInParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRowGroup) {
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(options.numberOfThreads);
+            STORM_LOG_DEBUG("Exploring the state space with " << numberOfThreads << " threads.");
+            
+            // Every worker needs its own generator. The generators are created sequentially, because their creation
+            // accesses the (shared) expression manager.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators;
+            generators.push_back(generator);
+            for (uint64_t worker = 1; worker < numberOfThreads; ++worker) {
+                generators.push_back(generator->clone());
+            }
+            
+            // The states are stored with temporary indices, namely the buckets they are stored in, which are
+            // consecutive in the order in which the states were found.
+            storm::storage::ConcurrentBitVectorHashMap<StateType> stateToTemporaryId(generator->getStateSize(), 100000);
+            std::function<StateType (uint64_t)> bucketToId = [] (uint64_t bucket) { return static_cast<StateType>(bucket); };
+            bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet();
+            
+            // The mapping from temporary indices to the indices that a sequential breadth-first search assigns. A state
+            // is assigned its index when it is first requested as a successor of a state of the previous level.
+            StateType const unassigned = std::numeric_limits<StateType>::max();
+            std::vector<StateType> remapping;
+            uint64_t numberOfAssignedStates = 0;
+            auto discover = [&] (StateType const& state) {
+                if (remapping[state] == unassigned) {
+                    remapping[state] = static_cast<StateType>(numberOfAssignedStates++);
+                }
+            };
+            
+            // Let the generator create all initial states. The frontier holds the states of the current level in the
+            // order of their (final) indices.
+            std::vector<std::pair<CompressedState, StateType>> frontier;
+            std::function<StateType (CompressedState const&)> initialStateToIdCallback = [&] (CompressedState const& state) {
+                std::pair<StateType, bool> indexNewPair = stateToTemporaryId.findOrAddLazily(state, bucketToId);
+                if (indexNewPair.second) {
+                    frontier.emplace_back(state, indexNewPair.first);
+                    remapping.push_back(unassigned);
+                }
+                discover(indexNewPair.first);
+                return indexNewPair.first;
+            };
+            std::vector<StateType> initialStateIndices = generator->getInitialStates(initialStateToIdCallback);
+            this->stateStorage.initialStateIndices.clear();
+            for (auto const& state : initialStateIndices) {
+                this->stateStorage.initialStateIndices.push_back(remapping[state]);
+            }
+            
+            // Explore the state space level by level. Each worker stores the behaviors of the states it explored along
+            // with the (temporary) indices of the successors in the order in which the generator requested them. Once
+            // a level is explored, its rows are added to the matrices and its behaviors are released, so only the
+            // behaviors of a single level are held at any time.
+            std::vector<std::vector<ExploredState<ValueType, StateType>>> exploredStates(numberOfThreads);
+            std::vector<std::vector<StateType>> successorSequences(numberOfThreads);
+            std::vector<std::vector<std::pair<CompressedState, StateType>>> nextFrontiers(numberOfThreads);
+            std::vector<std::pair<uint64_t, uint64_t>> exploredStateLocations;
+            
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStates = 0;
+            uint_fast64_t currentRow = 0;
+            while (!frontier.empty()) {
+                uint64_t numberOfChunks = std::min<uint64_t>(frontier.size(), numberOfThreads * chunksPerThread);
+                std::atomic<uint64_t> nextChunk(0);
+                exploredStateLocations.resize(frontier.size());
+                storm::utility::getThreadPool().execute(numberOfThreads, [&] (uint64_t worker) {
+                    storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = *generators[worker];
+                    std::vector<ExploredState<ValueType, StateType>>& workerExploredStates = exploredStates[worker];
+                    std::vector<StateType>& successorSequence = successorSequences[worker];
+                    std::vector<std::pair<CompressedState, StateType>>& nextFrontier = nextFrontiers[worker];
+                    
+                    std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                        std::pair<StateType, bool> indexNewPair = stateToTemporaryId.findOrAddLazily(state, bucketToId);
+                        if (indexNewPair.second) {
+                            nextFrontier.emplace_back(state, indexNewPair.first);
+                        }
+                        successorSequence.push_back(indexNewPair.first);
+                        return indexNewPair.first;
+                    };
+                    
+                    for (uint64_t chunk = nextChunk++; chunk < numberOfChunks; chunk = nextChunk++) {
+                        uint64_t chunkEnd = frontier.size() * (chunk + 1) / numberOfChunks;
+                        for (uint64_t position = frontier.size() * chunk / numberOfChunks; position < chunkEnd; ++position) {
+                            CompressedState const& currentState = frontier[position].first;
+                            exploredStateLocations[position] = std::make_pair(worker, workerExploredStates.size());
+                            workerExploredStates.emplace_back();
+                            ExploredState<ValueType, StateType>& exploredState = workerExploredStates.back();
+                            exploredState.successorsBegin = successorSequence.size();
+                            
+                            workerGenerator.load(currentState);
+                            exploredState.behavior = workerGenerator.expand(stateToIdCallback);
+                            exploredState.successorsEnd = successorSequence.size();
+                            
+                            // Deadlock states are only allowed if we are to fix them.
+                            if (exploredState.behavior.empty() && dontFixDeadlocks && exploredState.behavior.wasExpanded()) {
+                                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << workerGenerator.toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                            }
+                        }
+                    }
+                });
+                
+                // Assign the indices to the states of the next level in the order in which a sequential breadth-first
+                // search would have discovered them and add the rows of the current level to the matrices.
+                remapping.resize(stateToTemporaryId.size(), unassigned);
+                uint64_t firstStateOfNextLevel = numberOfAssignedStates;
+                for (uint64_t position = 0; position < frontier.size(); ++position) {
+                    auto const& location = exploredStateLocations[position];
+                    auto& exploredState = exploredStates[location.first][location.second];
+                    std::vector<StateType> const& successorSequence = successorSequences[location.first];
+                    for (uint64_t successor = exploredState.successorsBegin; successor < exploredState.successorsEnd; ++successor) {
+                        discover(successorSequence[successor]);
+                    }
+                    
+                    StateType index = remapping[frontier[position].second];
+                    addStateBehaviorToMatrices(index, exploredState.behavior, &remapping, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                    exploredState.behavior = storm::generator::StateBehavior<ValueType, StateType>();
+                    this->stateStorage.stateToId.findOrAdd(frontier[position].first, index);
+                }
+                for (uint64_t worker = 0; worker < numberOfThreads; ++worker) {
+                    exploredStates[worker].clear();
+                    successorSequences[worker].clear();
+                }
+                
+                // The states of the next level are exactly the ones that were newly found, so their indices are
+                // consecutive and they can be placed at their position directly.
+                numberOfExploredStates += frontier.size();
+                frontier.resize(numberOfAssignedStates - firstStateOfNextLevel);
+                for (auto& nextFrontier : nextFrontiers) {
+                    for (auto& stateIndexPair : nextFrontier) {
+                        frontier[remapping[stateIndexPair.second] - firstStateOfNextLevel] = std::move(stateIndexPair);
+                    }
+                    nextFrontier.clear();
+                }
+                
+                if (generator->getOptions().isShowProgressSet()) {
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                    std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (" << frontier.size() << " states in the next level)." << std::endl;
+                }
+            }
+            STORM_LOG_ASSERT(numberOfAssignedStates == stateToTemporaryId.size(), "Renumbering did not reach all states.");
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             
@@ -321,9 +553,9 @@ namespace storm {
             // If requested, build the state valuations and choice origins
             if (generator->getOptions().isBuildStateValuationsSet()) {
                 std::vector<storm::expressions::SimpleValuation> valuations(modelComponents.transitionMatrix.getRowGroupCount());
-                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-                    valuations[bitVectorIndexPair.second] = generator->toValuation(bitVectorIndexPair.first);
-                }
+                stateStorage.forEachState([&] (CompressedState const& state, StateType const& index) {
+                    valuations[index] = generator->toValuation(state);
+                });
                 modelComponents.stateValuations = storm::storage::sparse::StateValuations(std::move(valuations));
             }
             if (generator->getOptions().isBuildChoiceOriginsSet()) {
@@ -58,6 +58,17 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads that explore the model (zero means the number of hardware threads).
+                uint64_t numberOfThreads;
+                
+                // If set, the states and transitions are written to files in this directory when they exceed the
+                // memory limit.
+                boost::optional<std::string> outOfCoreDirectory;
+                
+                // The amount of memory (in bytes) that the states and transitions may occupy in memory if they are
+                // written to disk.
+                uint64_t outOfCoreMemoryLimit;
             };
             
             /*!
@@ -112,6 +123,30 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
             
+            /*!
+             * Builds the matrices like buildMatrices, but explores the states with multiple threads that each use their
+             * own generator. After each level of the breadth-first search, the states of the next level are numbered
+             * such that the result coincides with the one of a sequential breadth-first exploration and the rows of
+             * the level are added to the matrices.
+             */
+            void buildMatricesInParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices, uint_fast64_t& currentRowGroup);
+            
+            /*!
+             * Adds the behavior of the given state as the next row group to the matrices.
+             *
+             * @param currentIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param columnRemapping If given, the target states of the behavior are mapped to this.
+             * @param currentRowGroup The row group of the state. Will be increased.
+             * @param currentRow The first row of the state. Will be increased by the number of rows of the state.
+             */
+            void addStateBehaviorToMatrices(StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* columnRemapping, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
+            
+            /*!
+             * Retrieves whether the state space is to be explored with multiple threads.
+             */
+            bool exploreInParallel() const;
+            
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
@@ -1,8 +1,10 @@
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
 #include <iostream>
+#include <fstream>
 #include <cstdio>
 #include <chrono>
+#include <set>
 #include <errno.h>
 
 #include "storm/solver/SmtSolver.h"
@@ -37,6 +39,7 @@
 
 
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/storm-version.h"
 #include "storm-config.h"
 
 namespace storm {
@@ -55,6 +58,39 @@ namespace storm {
             static const std::string DYLIB_EXTENSION = ".dll";
 #endif
             
+            /*!
+             * Computes the (64-bit FNV-1a) hash of the given string.
+             */
+            static uint64_t computeHash(std::string const& value) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char const& character : value) {
+                    hash ^= static_cast<unsigned char>(character);
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+            
+            /*!
+             * Retrieves the names of the headers that the given code includes with quotes.
+             */
+            static std::vector<std::string> getQuotedIncludes(std::string const& code) {
+                std::vector<std::string> result;
+                std::istringstream codeStream(code);
+                std::string line;
+                while (std::getline(codeStream, line)) {
+                    std::size_t start = line.find_first_not_of(" \t");
+                    if (start == std::string::npos || line.compare(start, 8, "#include") != 0) {
+                        continue;
+                    }
+                    std::size_t open = line.find('"', start + 8);
+                    std::size_t close = open == std::string::npos ? std::string::npos : line.find('"', open + 1);
+                    if (close != std::string::npos) {
+                        result.push_back(line.substr(open + 1, close - open - 1));
+                    }
+                }
+                return result;
+            }
+            
             template <typename ValueType, typename RewardModelType>
             ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options) : options(options), model(model.substituteConstants()), modelComponentsBuilder(model.getModelType()) {
                 
@@ -101,6 +137,9 @@ namespace storm {
                     carlIncludeDirectory = STORM_CARL_INCLUDE_DIR;
                 }
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = settings.getCacheDirectory();
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -477,20 +516,45 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
+                // (2) If the shared library for this source code was compiled before, we can take it from the cache.
+                boost::filesystem::path dynamicLibraryPath;
+                boost::optional<std::string> cacheKey;
+                bool libraryIsCached = false;
+                if (cacheDirectory) {
+                    cacheKey = getCacheKey(source);
+                    boost::optional<boost::filesystem::path> cachedLibraryPath = loadFromCache(cacheKey.get());
+                    if (cachedLibraryPath) {
+                        STORM_LOG_INFO("Using cached shared library " << cachedLibraryPath.get() << ".");
+                        dynamicLibraryPath = cachedLibraryPath.get();
+                        libraryIsCached = true;
+                    }
+                }
                 
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                if (!libraryIsCached) {
+                    // (3) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (4) Compile the source code to a shared library.
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (5) Remove the source code of the shared library we just compiled.
+                    boost::filesystem::remove(temporarySourceFile);
+                    
+                    // (6) Keep the shared library for later builds of the same model, if requested.
+                    if (cacheKey) {
+                        boost::optional<boost::filesystem::path> cachedLibraryPath = storeInCache(cacheKey.get(), dynamicLibraryPath);
+                        if (cachedLibraryPath) {
+                            dynamicLibraryPath = cachedLibraryPath.get();
+                            libraryIsCached = true;
+                        }
+                    }
+                }
                 
-                // (5) Create the builder from the shared library.
+                // (7) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
                 
-                // (6) Execute the build function of the builder in the shared library and build the actual model.
+                // (8) Execute the build function of the builder in the shared library and build the actual model.
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 std::shared_ptr<storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>> sparseModel(nullptr);
@@ -506,8 +570,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (9) Delete the shared library unless it is kept in the cache.
+                if (!libraryIsCached) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -2476,6 +2542,99 @@ namespace storm {
                 return dynamicLibraryPath;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCacheKey(std::string const& source) const {
+                // The shared library depends on everything that enters the compiler invocation.
+                std::stringstream keyStream;
+                keyStream << compiler << " " << compilerFlags << " -I" << stormIncludeDirectory << " -I" << sparseppIncludeDirectory << " -I" << boostIncludeDirectory << " -I" << carlIncludeDirectory << std::endl;
+                
+                // The headers of storm may change while their paths stay the same (e.g. when storm is rebuilt in place),
+                // so the key also comprises the version of storm and the contents of the headers found in storm's
+                // include directories that the source includes (directly or indirectly).
+                keyStream << storm::utility::StormVersion::longVersionString() << std::endl;
+                std::vector<std::string> includingCode = {source};
+                std::set<std::string> visitedHeaders;
+                while (!includingCode.empty()) {
+                    std::string code = std::move(includingCode.back());
+                    includingCode.pop_back();
+                    for (auto const& header : getQuotedIncludes(code)) {
+                        if (!visitedHeaders.insert(header).second) {
+                            continue;
+                        }
+                        for (auto const& includeDirectory : {stormIncludeDirectory, sparseppIncludeDirectory}) {
+                            std::ifstream headerFile((boost::filesystem::path(includeDirectory) / header).native(), std::ios::binary);
+                            if (headerFile) {
+                                std::stringstream contents;
+                                contents << headerFile.rdbuf();
+                                keyStream << header << " " << std::hex << computeHash(contents.str()) << std::dec << std::endl;
+                                includingCode.push_back(contents.str());
+                                break;
+                            }
+                        }
+                    }
+                }
+                
+                keyStream << source;
+                return keyStream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::pair<boost::filesystem::path, boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCachePaths(std::string const& cacheKey) const {
+                // Name the files after the hash of the key. As the hash is not required to be free of collisions, the key
+                // itself is stored alongside the shared library.
+                std::stringstream nameStream;
+                nameStream << "storm-jit-" << std::hex << computeHash(cacheKey);
+                
+                boost::filesystem::path libraryPath = boost::filesystem::path(cacheDirectory.get()) / (nameStream.str() + DYLIB_EXTENSION);
+                boost::filesystem::path keyPath = boost::filesystem::path(cacheDirectory.get()) / (nameStream.str() + ".key");
+                return std::make_pair(libraryPath, keyPath);
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::loadFromCache(std::string const& cacheKey) const {
+                auto paths = getCachePaths(cacheKey);
+                if (!boost::filesystem::exists(paths.first) || !boost::filesystem::exists(paths.second)) {
+                    STORM_LOG_TRACE("No cached shared library found at " << paths.first << ".");
+                    return boost::none;
+                }
+                
+                std::ifstream keyFile(paths.second.native(), std::ios::binary);
+                std::stringstream storedKey;
+                storedKey << keyFile.rdbuf();
+                if (!keyFile || storedKey.str() != cacheKey) {
+                    STORM_LOG_TRACE("The cached shared library at " << paths.first << " was compiled from a different source.");
+                    return boost::none;
+                }
+                return paths.first;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeInCache(std::string const& cacheKey, boost::filesystem::path const& dynamicLibraryPath) const {
+                auto paths = getCachePaths(cacheKey);
+                try {
+                    boost::filesystem::create_directories(cacheDirectory.get());
+                    
+                    // Copy the files under temporary names first and then rename them, so that concurrent builds never
+                    // see incomplete files. The library is put in place before the key, which validates it.
+                    boost::filesystem::path temporaryLibraryPath = boost::filesystem::path(cacheDirectory.get()) / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + DYLIB_EXTENSION);
+                    boost::filesystem::copy_file(dynamicLibraryPath, temporaryLibraryPath, boost::filesystem::copy_option::overwrite_if_exists);
+                    boost::filesystem::rename(temporaryLibraryPath, paths.first);
+                    
+                    boost::filesystem::path temporaryKeyPath = boost::filesystem::path(cacheDirectory.get()) / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.key");
+                    std::ofstream keyFile(temporaryKeyPath.native(), std::ios::binary);
+                    keyFile << cacheKey;
+                    keyFile.close();
+                    STORM_LOG_THROW(keyFile, storm::exceptions::InvalidStateException, "Unable to write " << temporaryKeyPath << ".");
+                    boost::filesystem::rename(temporaryKeyPath, paths.second);
+                } catch (std::exception const& e) {
+                    STORM_LOG_WARN("Unable to store the shared library in the cache directory '" << cacheDirectory.get() << "' (error: " << e.what() << ").");
+                    return boost::none;
+                }
+                
+                boost::filesystem::remove(dynamicLibraryPath);
+                return paths.first;
+            }
+            
             template<typename RationalFunctionType, typename TP = typename RationalFunctionType::PolyType, carl::EnableIf<carl::needs_cache<TP>> = carl::dummy>
             RationalFunctionType convertVariableToPolynomial(carl::Variable const& variable, std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache) {
                 return RationalFunctionType(typename RationalFunctionType::PolyType(typename RationalFunctionType::PolyType::PolyType(variable), cache));
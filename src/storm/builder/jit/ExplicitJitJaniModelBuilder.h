@@ -141,6 +141,32 @@ namespace storm {
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
 
+                /*!
+                 * Retrieves the key under which the shared library compiled from the given source code is cached. Besides
+                 * the source code, the key comprises the compiler invocation, the version of storm and (hashes of) the
+                 * contents of the storm headers included by the source code.
+                 */
+                std::string getCacheKey(std::string const& source) const;
+                
+                /*!
+                 * Retrieves the path of the cached shared library and the path of the file storing its key.
+                 */
+                std::pair<boost::filesystem::path, boost::filesystem::path> getCachePaths(std::string const& cacheKey) const;
+                
+                /*!
+                 * Looks up the shared library with the given key in the cache directory.
+                 *
+                 * @return The path to the cached shared library or nothing if there is none.
+                 */
+                boost::optional<boost::filesystem::path> loadFromCache(std::string const& cacheKey) const;
+                
+                /*!
+                 * Moves the given shared library to the cache directory.
+                 *
+                 * @return The new path of the shared library or nothing if it could not be stored in the cache.
+                 */
+                boost::optional<boost::filesystem::path> storeInCache(std::string const& cacheKey, boost::filesystem::path const& dynamicLibraryPath) const;
+
                 /*!
                  * Loads the given shared library and creates the builder from it.
                  */
@@ -195,6 +221,9 @@ namespace storm {
                 /// The include directory of sparsepp.
                 std::string sparseppIncludeDirectory;
                 
+                /// If set, the directory in which the compiled shared libraries are cached.
+                boost::optional<std::string> cacheDirectory;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache;
             };
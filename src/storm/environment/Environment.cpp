@@ -1,6 +1,7 @@
 #include "storm/environment/Environment.h"
 #include "storm/environment/SubEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 namespace storm {
 
 
@@ -19,4 +20,12 @@ namespace storm {
     SolverEnvironment const& Environment::solver() const {
         return solverEnvironment.get();
     }
+    
+    ModelCheckerEnvironment& Environment::modelchecker() {
+        return modelcheckerEnvironment.get();
+    }
+    
+    ModelCheckerEnvironment const& Environment::modelchecker() const {
+        return modelcheckerEnvironment.get();
+    }
 }
\ No newline at end of file
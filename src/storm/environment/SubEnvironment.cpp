@@ -7,6 +7,7 @@
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 namespace storm {
     
@@ -44,6 +45,7 @@ namespace storm {
     template class SubEnvironment<MultiplierEnvironment>;
     template class SubEnvironment<GameSolverEnvironment>;
     template class SubEnvironment<TopologicalSolverEnvironment>;
+    template class SubEnvironment<ModelCheckerEnvironment>;
     
 }
 
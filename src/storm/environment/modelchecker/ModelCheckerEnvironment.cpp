@@ -0,0 +1,42 @@
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
+namespace storm {
+    
+    ModelCheckerEnvironment::ModelCheckerEnvironment() {
+        auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+        lraNumberOfThreads = modelCheckerSettings.getLraNumberOfThreads();
+        lraDirectSolverThreshold = modelCheckerSettings.getLraDirectSolverThreshold();
+        graphAnalysisNumberOfThreads = modelCheckerSettings.getGraphAnalysisNumberOfThreads();
+    }
+    
+    ModelCheckerEnvironment::~ModelCheckerEnvironment() {
+        // Intentionally left empty
+    }
+    
+    uint64_t const& ModelCheckerEnvironment::getLraNumberOfThreads() const {
+        return lraNumberOfThreads;
+    }
+    
+    void ModelCheckerEnvironment::setLraNumberOfThreads(uint64_t value) {
+        lraNumberOfThreads = value;
+    }
+    
+    uint64_t const& ModelCheckerEnvironment::getLraDirectSolverThreshold() const {
+        return lraDirectSolverThreshold;
+    }
+    
+    void ModelCheckerEnvironment::setLraDirectSolverThreshold(uint64_t value) {
+        lraDirectSolverThreshold = value;
+    }
+    
+    uint64_t const& ModelCheckerEnvironment::getGraphAnalysisNumberOfThreads() const {
+        return graphAnalysisNumberOfThreads;
+    }
+    
+    void ModelCheckerEnvironment::setGraphAnalysisNumberOfThreads(uint64_t value) {
+        graphAnalysisNumberOfThreads = value;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/environment/Environment.h"
+
+namespace storm {
+    
+    class ModelCheckerEnvironment {
+    public:
+        
+        ModelCheckerEnvironment();
+        ~ModelCheckerEnvironment();
+        
+        uint64_t const& getLraNumberOfThreads() const;
+        void setLraNumberOfThreads(uint64_t value);
+        
+        uint64_t const& getLraDirectSolverThreshold() const;
+        void setLraDirectSolverThreshold(uint64_t value);
+        
+        uint64_t const& getGraphAnalysisNumberOfThreads() const;
+        void setGraphAnalysisNumberOfThreads(uint64_t value);
+    
+    private:
+        uint64_t lraNumberOfThreads;
+        uint64_t lraDirectSolverThreshold;
+        uint64_t graphAnalysisNumberOfThreads;
+    };
+}
+
@@ -11,6 +11,9 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        compactLayout = multiplierSettings.isCompactLayoutSet();
+        numberOfThreads = multiplierSettings.getNumberOfThreads();
+        vectorInstructionSet = multiplierSettings.getVectorInstructionSet();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +33,28 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool MultiplierEnvironment::isCompactLayoutSet() const {
+        return compactLayout;
+    }
+    
+    void MultiplierEnvironment::setCompactLayout(bool value) {
+        compactLayout = value;
+    }
+    
+    uint64_t const& MultiplierEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void MultiplierEnvironment::setNumberOfThreads(uint64_t value) {
+        numberOfThreads = value;
+    }
+    
+    storm::storage::kernels::VectorInstructionSet const& MultiplierEnvironment::getVectorInstructionSet() const {
+        return vectorInstructionSet;
+    }
+    
+    void MultiplierEnvironment::setVectorInstructionSet(storm::storage::kernels::VectorInstructionSet value) {
+        vectorInstructionSet = value;
+    }
+    
 }
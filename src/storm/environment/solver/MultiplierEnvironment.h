@@ -2,6 +2,7 @@
 
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
 
 namespace storm {
     
@@ -15,9 +16,21 @@ namespace storm {
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
         
+        bool isCompactLayoutSet() const;
+        void setCompactLayout(bool value);
+        
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        
+        storm::storage::kernels::VectorInstructionSet const& getVectorInstructionSet() const;
+        void setVectorInstructionSet(storm::storage::kernels::VectorInstructionSet value);
+        
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool compactLayout;
+        uint64_t numberOfThreads;
+        storm::storage::kernels::VectorInstructionSet vectorInstructionSet;
     };
 }
 
@@ -15,6 +15,9 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingEquationSolverTypeSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        numberOfThreads = topologicalSettings.getNumberOfThreads();
+        sccBatchSize = topologicalSettings.getSccBatchSize();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +52,22 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        numberOfThreads = value;
+    }
+    
+    uint64_t const& TopologicalSolverEnvironment::getSccBatchSize() const {
+        return sccBatchSize;
+    }
+    
+    void TopologicalSolverEnvironment::setSccBatchSize(uint64_t value) {
+        sccBatchSize = value;
+    }
+    
 
 
 }
@@ -0,0 +1,271 @@
+#include "storm/generator/ExpressionBytecode.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+
+#include "storm/storage/expressions/Expressions.h"
+
+namespace storm {
+    namespace generator {
+        
+        bool ExpressionBytecode::evaluateAsBool(CompressedState const& state) const {
+            return evaluate(state) == 1.0;
+        }
+        
+        int_fast64_t ExpressionBytecode::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int_fast64_t>(evaluate(state));
+        }
+        
+        double ExpressionBytecode::evaluateAsDouble(CompressedState const& state) const {
+            return evaluate(state);
+        }
+        
+        uint64_t ExpressionBytecode::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+        
+        double ExpressionBytecode::evaluate(CompressedState const& state) const {
+            double* r = registers.data();
+            uint64_t programCounter = 0;
+            uint64_t const numberOfInstructions = instructions.size();
+            while (programCounter < numberOfInstructions) {
+                Instruction const& instruction = instructions[programCounter];
+                ++programCounter;
+                switch (instruction.opCode) {
+                    case OpCode::LoadConstant: r[instruction.target] = instruction.constant; break;
+                    case OpCode::LoadBoolean: r[instruction.target] = state.get(instruction.first) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: r[instruction.target] = static_cast<double>(state.getAsInt(instruction.first, instruction.second)) + instruction.constant; break;
+                    case OpCode::Plus: r[instruction.target] = r[instruction.first] + r[instruction.second]; break;
+                    case OpCode::Minus: r[instruction.target] = r[instruction.first] - r[instruction.second]; break;
+                    case OpCode::Times: r[instruction.target] = r[instruction.first] * r[instruction.second]; break;
+                    case OpCode::Divide: r[instruction.target] = r[instruction.first] / r[instruction.second]; break;
+                    case OpCode::Min: r[instruction.target] = std::min(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Max: r[instruction.target] = std::max(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Power: r[instruction.target] = std::pow(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Equal: r[instruction.target] = r[instruction.first] == r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: r[instruction.target] = r[instruction.first] != r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Less: r[instruction.target] = r[instruction.first] < r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: r[instruction.target] = r[instruction.first] <= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: r[instruction.target] = r[instruction.first] > r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: r[instruction.target] = r[instruction.first] >= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Not: r[instruction.target] = r[instruction.first] == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::Negate: r[instruction.target] = -r[instruction.first]; break;
+                    case OpCode::Floor: r[instruction.target] = std::floor(r[instruction.first]); break;
+                    case OpCode::Ceil: r[instruction.target] = std::ceil(r[instruction.first]); break;
+                    case OpCode::JumpIfFalse:
+                        if (r[instruction.first] == 0.0) {
+                            programCounter = instruction.second;
+                        }
+                        break;
+                    case OpCode::JumpIfTrue:
+                        if (r[instruction.first] != 0.0) {
+                            programCounter = instruction.second;
+                        }
+                        break;
+                    case OpCode::Jump: programCounter = instruction.second; break;
+                }
+            }
+            return r[0];
+        }
+        
+        ExpressionBytecodeCompiler::ExpressionBytecodeCompiler(VariableInformation const& variableInformation, bool approximateRationals) : numberOfRegisters(0), approximateRationals(approximateRationals) {
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToLoadInstruction[booleanVariable.variable] = Instruction{OpCode::LoadBoolean, 0, booleanVariable.bitOffset, 0, 0.0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitWidth == 0) {
+                    variableToLoadInstruction[integerVariable.variable] = Instruction{OpCode::LoadConstant, 0, 0, 0, static_cast<double>(integerVariable.lowerBound)};
+                } else {
+                    variableToLoadInstruction[integerVariable.variable] = Instruction{OpCode::LoadInteger, 0, integerVariable.bitOffset, integerVariable.bitWidth, static_cast<double>(integerVariable.lowerBound)};
+                }
+            }
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                if (locationVariable.bitWidth == 0) {
+                    variableToLoadInstruction[locationVariable.variable] = Instruction{OpCode::LoadConstant, 0, 0, 0, 0.0};
+                } else {
+                    variableToLoadInstruction[locationVariable.variable] = Instruction{OpCode::LoadInteger, 0, locationVariable.bitOffset, locationVariable.bitWidth, 0.0};
+                }
+            }
+        }
+        
+        boost::optional<ExpressionBytecode> ExpressionBytecodeCompiler::compile(storm::expressions::Expression const& expression) {
+            instructions.clear();
+            numberOfRegisters = 1;
+            bool success = boost::any_cast<bool>(expression.getBaseExpression().accept(*this, static_cast<uint32_t>(0)));
+            if (!success) {
+                return boost::none;
+            }
+            
+            ExpressionBytecode result;
+            result.instructions = std::move(instructions);
+            result.registers.resize(numberOfRegisters);
+            instructions = std::vector<Instruction>();
+            return result;
+        }
+        
+        uint64_t ExpressionBytecodeCompiler::emit(OpCode opCode, uint32_t target, uint64_t first, uint64_t second, double constant) {
+            numberOfRegisters = std::max(numberOfRegisters, target + 1);
+            instructions.push_back(Instruction{opCode, target, first, second, constant});
+            return instructions.size() - 1;
+        }
+        
+        bool ExpressionBytecodeCompiler::compileBinary(OpCode opCode, storm::expressions::BinaryExpression const& expression, uint32_t target) {
+            if (!boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, target))) {
+                return false;
+            }
+            if (!boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, target + 1))) {
+                return false;
+            }
+            emit(opCode, target, target, target + 1);
+            return true;
+        }
+        
+        bool ExpressionBytecodeCompiler::isCompilable(storm::expressions::BaseExpression const& expression) const {
+            return approximateRationals || !expression.hasRationalType();
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
+            if (!isCompilable(expression)) {
+                return false;
+            }
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            if (!boost::any_cast<bool>(expression.getCondition()->accept(*this, target))) {
+                return false;
+            }
+            uint64_t jumpToElse = emit(OpCode::JumpIfFalse, target, target);
+            if (!boost::any_cast<bool>(expression.getThenExpression()->accept(*this, target))) {
+                return false;
+            }
+            uint64_t jumpToEnd = emit(OpCode::Jump, target);
+            instructions[jumpToElse].second = instructions.size();
+            if (!boost::any_cast<bool>(expression.getElseExpression()->accept(*this, target))) {
+                return false;
+            }
+            instructions[jumpToEnd].second = instructions.size();
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: return compileBinary(OpCode::NotEqual, expression, target);
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: return compileBinary(OpCode::Equal, expression, target);
+                default: break;
+            }
+            
+            // The remaining connectives are evaluated lazily, i.e. the second operand is only evaluated if the first
+            // one does not determine the result.
+            if (!boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, target))) {
+                return false;
+            }
+            uint64_t jumpToEnd = 0;
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                    jumpToEnd = emit(OpCode::JumpIfFalse, target, target);
+                    break;
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                    jumpToEnd = emit(OpCode::JumpIfTrue, target, target);
+                    break;
+                default:
+                    // Implies: if the (negated) first operand is true, so is the implication.
+                    emit(OpCode::Not, target, target);
+                    jumpToEnd = emit(OpCode::JumpIfTrue, target, target);
+                    break;
+            }
+            if (!boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, target))) {
+                return false;
+            }
+            instructions[jumpToEnd].second = instructions.size();
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            if (!isCompilable(expression)) {
+                return false;
+            }
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: return compileBinary(OpCode::Plus, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: return compileBinary(OpCode::Minus, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: return compileBinary(OpCode::Times, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: return compileBinary(OpCode::Divide, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: return compileBinary(OpCode::Min, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: return compileBinary(OpCode::Max, expression, target);
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: return compileBinary(OpCode::Power, expression, target);
+            }
+            return false;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            switch (expression.getRelationType()) {
+                case storm::expressions::BinaryRelationExpression::RelationType::Equal: return compileBinary(OpCode::Equal, expression, target);
+                case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: return compileBinary(OpCode::NotEqual, expression, target);
+                case storm::expressions::BinaryRelationExpression::RelationType::Less: return compileBinary(OpCode::Less, expression, target);
+                case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: return compileBinary(OpCode::LessOrEqual, expression, target);
+                case storm::expressions::BinaryRelationExpression::RelationType::Greater: return compileBinary(OpCode::Greater, expression, target);
+                case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: return compileBinary(OpCode::GreaterOrEqual, expression, target);
+            }
+            return false;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const& data) {
+            if (!isCompilable(expression)) {
+                return false;
+            }
+            auto loadIt = variableToLoadInstruction.find(expression.getVariable());
+            if (loadIt == variableToLoadInstruction.end()) {
+                return false;
+            }
+            Instruction const& load = loadIt->second;
+            emit(load.opCode, boost::any_cast<uint32_t>(data), load.first, load.second, load.constant);
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            if (!boost::any_cast<bool>(expression.getOperand()->accept(*this, target))) {
+                return false;
+            }
+            emit(OpCode::Not, target, target);
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            if (!isCompilable(expression)) {
+                return false;
+            }
+            uint32_t target = boost::any_cast<uint32_t>(data);
+            if (!boost::any_cast<bool>(expression.getOperand()->accept(*this, target))) {
+                return false;
+            }
+            switch (expression.getOperatorType()) {
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: emit(OpCode::Negate, target, target); break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: emit(OpCode::Floor, target, target); break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: emit(OpCode::Ceil, target, target); break;
+            }
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) {
+            emit(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValue() ? 1.0 : 0.0);
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) {
+            emit(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, static_cast<double>(expression.getValue()));
+            return true;
+        }
+        
+        boost::any ExpressionBytecodeCompiler::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) {
+            if (!approximateRationals) {
+                return false;
+            }
+            emit(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValueAsDouble());
+            return true;
+        }
+    
+    }
+}
@@ -0,0 +1,160 @@
+#ifndef STORM_GENERATOR_EXPRESSIONBYTECODE_H_
+#define STORM_GENERATOR_EXPRESSIONBYTECODE_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class BinaryExpression;
+    }
+    
+    namespace generator {
+        
+        struct VariableInformation;
+        class ExpressionBytecodeCompiler;
+        
+        /*!
+         * An expression that was compiled to a compact register-based bytecode, which is evaluated directly on
+         * compressed states, i.e. the values of variables are read from their bit offsets in the state instead of
+         * unpacking the state into an expression evaluator first.
+         *
+         * All values are represented by doubles (where booleans are represented by zero and one), which yields the
+         * same results as the (exprtk-based) evaluator that is used by the next-state generators otherwise. As
+         * evaluation uses mutable registers, a bytecode object must not be evaluated by multiple threads at once.
+         */
+        class ExpressionBytecode {
+        public:
+            /*!
+             * Evaluates the expression in the given state.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+            int_fast64_t evaluateAsInt(CompressedState const& state) const;
+            double evaluateAsDouble(CompressedState const& state) const;
+            
+            /*!
+             * Retrieves the number of instructions of the bytecode.
+             */
+            uint64_t getNumberOfInstructions() const;
+        
+        private:
+            friend class ExpressionBytecodeCompiler;
+            
+            enum class OpCode : uint8_t {
+                // Loads a constant into the target register.
+                LoadConstant,
+                // Loads the boolean stored at bit offset (first) into the target register.
+                LoadBoolean,
+                // Loads the integer stored at bit offset (first) with bit width (second) plus the lower bound (constant).
+                LoadInteger,
+                Plus, Minus, Times, Divide, Min, Max, Power,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                Not, Negate, Floor, Ceil,
+                // Continues at instruction (second) if register (first) holds false or true, respectively.
+                JumpIfFalse, JumpIfTrue,
+                // Continues at instruction (second).
+                Jump
+            };
+            
+            struct Instruction {
+                OpCode opCode;
+                uint32_t target;
+                uint64_t first;
+                uint64_t second;
+                double constant;
+            };
+            
+            double evaluate(CompressedState const& state) const;
+            
+            // The instructions of the bytecode.
+            std::vector<Instruction> instructions;
+            
+            // The registers used during evaluation. The result is found in the first register.
+            mutable std::vector<double> registers;
+        };
+        
+        /*!
+         * Compiles expressions over the variables of a given variable information to bytecode.
+         */
+        class ExpressionBytecodeCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            /*!
+             * Creates a compiler for expressions over the variables of the given variable information. The compiled
+             * expressions may only be evaluated on states that are packed according to this variable information.
+             *
+             * @param variableInformation The information about the variables stored in the states.
+             * @param approximateRationals If false, expressions with a subexpression of rational type (rational
+             * literals, divisions etc.) are not compiled, because the bytecode evaluates them in floating point
+             * arithmetic. This is required for exact and parametric builds, in which e.g. the guard x*0.1 = 0.3 has to
+             * be evaluated exactly.
+             */
+            ExpressionBytecodeCompiler(VariableInformation const& variableInformation, bool approximateRationals = true);
+            
+            /*!
+             * Compiles the given expression.
+             *
+             * @param expression The expression to compile.
+             * @return The compiled expression or nothing if the expression refers to variables that are not stored in
+             * the compressed states (e.g. undefined constants or transient variables) or if it involves rationals
+             * that may not be approximated.
+             */
+            boost::optional<ExpressionBytecode> compile(storm::expressions::Expression const& expression);
+            
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+        
+        private:
+            typedef ExpressionBytecode::OpCode OpCode;
+            typedef ExpressionBytecode::Instruction Instruction;
+            
+            /*!
+             * Emits the given instruction and returns its index.
+             */
+            uint64_t emit(OpCode opCode, uint32_t target, uint64_t first = 0, uint64_t second = 0, double constant = 0.0);
+            
+            /*!
+             * Compiles the given binary operation, i.e. evaluates the operands to the target register and the one
+             * following it and combines them into the target register.
+             */
+            bool compileBinary(OpCode opCode, storm::expressions::BinaryExpression const& expression, uint32_t target);
+            
+            /*!
+             * Retrieves whether the given (numerical) subexpression may be compiled, i.e. whether it does not have
+             * rational type or rationals may be approximated.
+             */
+            bool isCompilable(storm::expressions::BaseExpression const& expression) const;
+            
+            // For each variable stored in the states, the instruction that loads its value (except for the target register).
+            std::unordered_map<storm::expressions::Variable, Instruction> variableToLoadInstruction;
+            
+            // The instructions of the expression that is currently compiled.
+            std::vector<Instruction> instructions;
+            
+            // The number of registers needed by the expression that is currently compiled.
+            uint32_t numberOfRegisters;
+            
+            // Whether subexpressions of rational type may be evaluated in floating point arithmetic.
+            bool approximateRationals;
+        };
+    
+    }
+}
+
+#endif /* STORM_GENERATOR_EXPRESSIONBYTECODE_H_ */
@@ -0,0 +1,213 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/VariableInformation.h"
+
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+namespace storm {
+    namespace generator {
+        
+        GuardIndex::GuardIndex(uint64_t numberOfGuards) : discriminating(false), bitOffset(0), bitWidth(0) {
+            for (uint64_t guard = 0; guard < numberOfGuards; ++guard) {
+                allGuards.push_back(guard);
+            }
+            candidates.push_back(allGuards);
+        }
+        
+        GuardIndex::GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation, uint64_t maximalNumberOfValues) : GuardIndex(guards.size()) {
+            if (guards.size() < 2) {
+                return;
+            }
+            
+            // Gather the bounds that each guard imposes on the variables.
+            std::vector<Bounds> guardBounds;
+            guardBounds.reserve(guards.size());
+            for (auto const& guard : guards) {
+                guardBounds.emplace_back();
+                gatherBounds(guard.getBaseExpression(), guardBounds.back());
+            }
+            
+            // Collects, for each value of the given variable, the guards that are compatible with it.
+            auto computeCandidates = [&guardBounds] (storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound) {
+                std::vector<std::vector<uint64_t>> result(upperBound - lowerBound + 1);
+                for (uint64_t guard = 0; guard < guardBounds.size(); ++guard) {
+                    auto boundsIt = guardBounds[guard].find(variable);
+                    int_fast64_t lower = lowerBound;
+                    int_fast64_t upper = upperBound;
+                    if (boundsIt != guardBounds[guard].end()) {
+                        lower = std::max(lower, boundsIt->second.first);
+                        upper = std::min(upper, boundsIt->second.second);
+                    }
+                    for (int_fast64_t value = lower; value <= upper; ++value) {
+                        result[value - lowerBound].push_back(guard);
+                    }
+                }
+                return result;
+            };
+            
+            // Computes the number of candidates per value that an index over the given variable yields on average.
+            auto rateVariable = [&guardBounds] (storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound) -> double {
+                uint64_t numberOfValues = upperBound - lowerBound + 1;
+                uint64_t totalCandidates = 0;
+                for (auto const& bounds : guardBounds) {
+                    auto boundsIt = bounds.find(variable);
+                    if (boundsIt == bounds.end()) {
+                        totalCandidates += numberOfValues;
+                    } else {
+                        int_fast64_t lower = std::max(lowerBound, boundsIt->second.first);
+                        int_fast64_t upper = std::min(upperBound, boundsIt->second.second);
+                        if (lower <= upper) {
+                            totalCandidates += upper - lower + 1;
+                        }
+                    }
+                }
+                return static_cast<double>(totalCandidates) / static_cast<double>(numberOfValues);
+            };
+            
+            // Pick the variable that yields the fewest candidates on average.
+            double bestRating = static_cast<double>(guards.size());
+            boost::optional<storm::expressions::Variable> bestVariable;
+            int_fast64_t bestLowerBound = 0;
+            int_fast64_t bestUpperBound = 0;
+            uint64_t bestBitOffset = 0;
+            uint64_t bestBitWidth = 0;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                double rating = rateVariable(booleanVariable.variable, 0, 1);
+                if (rating < bestRating) {
+                    bestRating = rating;
+                    bestVariable = booleanVariable.variable;
+                    bestLowerBound = 0;
+                    bestUpperBound = 1;
+                    bestBitOffset = booleanVariable.bitOffset;
+                    bestBitWidth = 1;
+                }
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                // Variables with a single value are not stored in the states and cannot discriminate the guards.
+                if (integerVariable.bitWidth == 0 || static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) >= maximalNumberOfValues) {
+                    continue;
+                }
+                double rating = rateVariable(integerVariable.variable, integerVariable.lowerBound, integerVariable.upperBound);
+                if (rating < bestRating) {
+                    bestRating = rating;
+                    bestVariable = integerVariable.variable;
+                    bestLowerBound = integerVariable.lowerBound;
+                    bestUpperBound = integerVariable.upperBound;
+                    bestBitOffset = integerVariable.bitOffset;
+                    bestBitWidth = integerVariable.bitWidth;
+                }
+            }
+            
+            if (bestVariable) {
+                discriminating = true;
+                bitOffset = bestBitOffset;
+                bitWidth = bestBitWidth;
+                candidates = computeCandidates(bestVariable.get(), bestLowerBound, bestUpperBound);
+            }
+        }
+        
+        std::vector<uint64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+            if (!discriminating) {
+                return candidates.front();
+            }
+            
+            // The values of variables are stored shifted by their lower bound, so they can be used as indices directly.
+            // Variables without bits are never picked as discriminating variable, but their only value is zero anyway.
+            uint64_t value = 0;
+            if (bitWidth == 1) {
+                value = static_cast<uint64_t>(state.get(bitOffset));
+            } else if (bitWidth > 1) {
+                value = state.getAsInt(bitOffset, bitWidth);
+            }
+            if (value < candidates.size()) {
+                return candidates[value];
+            }
+            return allGuards;
+        }
+        
+        bool GuardIndex::isDiscriminating() const {
+            return discriminating;
+        }
+        
+        void GuardIndex::restrict(Bounds& bounds, storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound) {
+            auto boundsIt = bounds.find(variable);
+            if (boundsIt == bounds.end()) {
+                bounds.emplace(variable, std::make_pair(lowerBound, upperBound));
+            } else {
+                boundsIt->second.first = std::max(boundsIt->second.first, lowerBound);
+                boundsIt->second.second = std::min(boundsIt->second.second, upperBound);
+            }
+        }
+        
+        void GuardIndex::gatherBounds(storm::expressions::BaseExpression const& expression, Bounds& bounds) {
+            int_fast64_t const minimalValue = std::numeric_limits<int_fast64_t>::min();
+            int_fast64_t const maximalValue = std::numeric_limits<int_fast64_t>::max();
+            
+            if (expression.isVariableExpression() && expression.hasBooleanType()) {
+                restrict(bounds, expression.asVariableExpression().getVariable(), 1, 1);
+            } else if (expression.isUnaryBooleanFunctionExpression() && expression.getOperator() == storm::expressions::OperatorType::Not) {
+                auto const& operand = *expression.getOperand(0);
+                if (operand.isVariableExpression()) {
+                    restrict(bounds, operand.asVariableExpression().getVariable(), 0, 0);
+                }
+            } else if (expression.isBinaryBooleanFunctionExpression()) {
+                storm::expressions::OperatorType operatorType = expression.getOperator();
+                if (operatorType == storm::expressions::OperatorType::And) {
+                    gatherBounds(*expression.getOperand(0), bounds);
+                    gatherBounds(*expression.getOperand(1), bounds);
+                } else if (operatorType == storm::expressions::OperatorType::Or) {
+                    // A variable is only constrained by a disjunction if it is constrained by both disjuncts, in which
+                    // case the bounds are given by the union of the two intervals.
+                    Bounds firstBounds;
+                    Bounds secondBounds;
+                    gatherBounds(*expression.getOperand(0), firstBounds);
+                    gatherBounds(*expression.getOperand(1), secondBounds);
+                    for (auto const& firstEntry : firstBounds) {
+                        auto secondIt = secondBounds.find(firstEntry.first);
+                        if (secondIt != secondBounds.end()) {
+                            restrict(bounds, firstEntry.first, std::min(firstEntry.second.first, secondIt->second.first), std::max(firstEntry.second.second, secondIt->second.second));
+                        }
+                    }
+                }
+            } else if (expression.isBinaryRelationExpression()) {
+                auto const& relation = expression.asBinaryRelationExpression();
+                auto const* variableOperand = relation.getFirstOperand().get();
+                auto const* constantOperand = relation.getSecondOperand().get();
+                storm::expressions::OperatorType operatorType = relation.getOperator();
+                if (!variableOperand->isVariableExpression()) {
+                    // Bring the relation into the form 'variable op constant'.
+                    std::swap(variableOperand, constantOperand);
+                    switch (operatorType) {
+                        case storm::expressions::OperatorType::Less: operatorType = storm::expressions::OperatorType::Greater; break;
+                        case storm::expressions::OperatorType::LessOrEqual: operatorType = storm::expressions::OperatorType::GreaterOrEqual; break;
+                        case storm::expressions::OperatorType::Greater: operatorType = storm::expressions::OperatorType::Less; break;
+                        case storm::expressions::OperatorType::GreaterOrEqual: operatorType = storm::expressions::OperatorType::LessOrEqual; break;
+                        default: break;
+                    }
+                }
+                if (!variableOperand->isVariableExpression() || !variableOperand->hasIntegerType() || constantOperand->containsVariables() || !constantOperand->hasIntegerType()) {
+                    return;
+                }
+                
+                storm::expressions::Variable const& variable = variableOperand->asVariableExpression().getVariable();
+                int_fast64_t constant = constantOperand->evaluateAsInt();
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::Equal: restrict(bounds, variable, constant, constant); break;
+                    case storm::expressions::OperatorType::Less: restrict(bounds, variable, minimalValue, constant - 1); break;
+                    case storm::expressions::OperatorType::LessOrEqual: restrict(bounds, variable, minimalValue, constant); break;
+                    case storm::expressions::OperatorType::Greater: restrict(bounds, variable, constant + 1, maximalValue); break;
+                    case storm::expressions::OperatorType::GreaterOrEqual: restrict(bounds, variable, constant, maximalValue); break;
+                    default: break;
+                }
+            }
+        }
+    
+    }
+}
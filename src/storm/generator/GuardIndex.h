@@ -0,0 +1,93 @@
+#ifndef STORM_GENERATOR_GUARDINDEX_H_
+#define STORM_GENERATOR_GUARDINDEX_H_
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+    
+    namespace generator {
+        
+        struct VariableInformation;
+        
+        /*!
+         * An index over a list of guards that, given a state, yields the guards that may possibly be satisfied in the
+         * state. For this, the index picks a discriminating (boolean or bounded integer) variable for which the guards
+         * contain equality or interval tests (as conjuncts) and precomputes, for every value of the variable, the
+         * guards that are compatible with it. Looking up the candidates then only requires reading the value of the
+         * variable from the compressed state.
+         *
+         * The candidates are always a superset of the satisfied guards, so the guards of the candidates still need
+         * to be evaluated. The candidates are ordered like the guards.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an index that yields all guards (of the given number) as candidates.
+             */
+            GuardIndex(uint64_t numberOfGuards = 0);
+            
+            /*!
+             * Creates an index over the given guards.
+             *
+             * @param guards The guards to index.
+             * @param variableInformation The information about how the variables are packed into states.
+             * @param maximalNumberOfValues The maximal number of values an integer variable may have to be used as the
+             * discriminating variable.
+             */
+            GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation, uint64_t maximalNumberOfValues = 1024);
+            
+            /*!
+             * Retrieves the positions of the guards that may be satisfied in the given state.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const;
+            
+            /*!
+             * Retrieves whether the index discriminates the guards by some variable, i.e. whether it does not
+             * trivially yield all guards.
+             */
+            bool isDiscriminating() const;
+        
+        private:
+            typedef std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> Bounds;
+            
+            /*!
+             * Restricts the bounds of the given variable to the given interval.
+             */
+            static void restrict(Bounds& bounds, storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound);
+            
+            /*!
+             * Gathers bounds on variables that hold in all states that satisfy the given expression. Variables that are
+             * not contained in the result are not constrained (as far as this simple analysis can tell).
+             */
+            static void gatherBounds(storm::expressions::BaseExpression const& expression, Bounds& bounds);
+            
+            // Whether the candidates depend on a discriminating variable.
+            bool discriminating;
+            
+            // The bit offset and width of the discriminating variable in the compressed states.
+            uint64_t bitOffset;
+            uint64_t bitWidth;
+            
+            // For each (shifted) value of the discriminating variable, the candidates. If the index is not
+            // discriminating, there is just one entry containing all guards.
+            std::vector<std::vector<uint64_t>> candidates;
+            
+            // All guards, which serve as candidates for values outside of the range of the variable.
+            std::vector<uint64_t> allGuards;
+        };
+    
+    }
+}
+
+#endif /* STORM_GENERATOR_GUARDINDEX_H_ */
@@ -57,6 +57,10 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(model.getManager());
             
+            // Compile the expressions that are evaluated in every state.
+            this->compileExpressions();
+            this->buildEdgeSetInformation();
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& variable : model.getGlobalVariables()) {
                     if (variable.isTransient()) {
@@ -115,6 +119,62 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            ExpressionBytecodeCompiler compiler = this->createExpressionCompiler();
+            for (auto const& outputAndEdges : edges) {
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            storm::jani::Edge const& edge = *indexAndEdge.second;
+                            if (edgeBytecode.find(&edge) != edgeBytecode.end()) {
+                                continue;
+                            }
+                            
+                            EdgeBytecode& bytecode = edgeBytecode[&edge];
+                            bytecode.guard = this->compileExpression(compiler, edge.getGuard());
+                            if (edge.hasRate()) {
+                                bytecode.rate = this->compileExpression(compiler, edge.getRate());
+                            }
+                            for (auto const& destination : edge.getDestinations()) {
+                                bytecode.probabilities.push_back(this->compileExpression(compiler, destination.getProbability()));
+                                bytecode.assignments.emplace_back();
+                                for (auto const& assignment : destination.getOrderedAssignments().getNonTransientAssignments()) {
+                                    bytecode.assignments.back().push_back(this->compileExpression(compiler, assignment.getAssignedExpression()));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::buildEdgeSetInformation() {
+            uint64_t numberOfDiscriminatingIndices = 0;
+            for (auto const& outputAndEdges : edges) {
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        std::vector<storm::expressions::Expression> guards;
+                        std::vector<EdgeBytecode const*> bytecode;
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            guards.push_back(indexAndEdge.second->getGuard());
+                            bytecode.push_back(&edgeBytecode.at(indexAndEdge.second));
+                        }
+                        auto insertionResult = edgeSetInformation.emplace(&locationAndEdges.second, EdgeSetInformation{GuardIndex(guards, this->variableInformation), std::move(bytecode)});
+                        numberOfDiscriminatingIndices += insertionResult.first->second.guardIndex.isDiscriminating() ? 1 : 0;
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Found discriminating variables for " << numberOfDiscriminatingIndices << " of " << edgeSetInformation.size() << " edge sets.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+            // The model was already preprocessed, so we can use the delegate constructor directly.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(this->model, this->options, false));
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType JaniNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (model.getModelType()) {
@@ -230,7 +290,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        CompressedState JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::jani::EdgeDestination const& destination, storm::generator::LocationVariableInformation const& locationVariable) {
+        CompressedState JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::jani::EdgeDestination const& destination, std::vector<boost::optional<ExpressionBytecode>> const& assignmentBytecode, storm::generator::LocationVariableInformation const& locationVariable) {
             CompressedState newState(state);
             
             // Update the location of the state.
@@ -241,21 +301,22 @@ namespace storm {
             auto assignmentIte = destination.getOrderedAssignments().getNonTransientAssignments().end();
             
             // Iterate over all boolean assignments and carry them out.
+            auto bytecodeIt = assignmentBytecode.begin();
             auto boolIt = this->variableInformation.booleanVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getAssignedExpression().hasBooleanType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getAssignedExpression().hasBooleanType(); ++assignmentIt, ++bytecodeIt) {
                 while (assignmentIt->getExpressionVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getAssignedExpression()));
+                newState.set(boolIt->bitOffset, this->evaluateBooleanExpression(*bytecodeIt, assignmentIt->getAssignedExpression()));
             }
             
             // Iterate over all integer assignments and carry them out.
             auto integerIt = this->variableInformation.integerVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getAssignedExpression().hasIntegerType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getAssignedExpression().hasIntegerType(); ++assignmentIt, ++bytecodeIt) {
                 while (assignmentIt->getExpressionVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getAssignedExpression());
+                int_fast64_t assignedValue = this->evaluateIntegerExpression(*bytecodeIt, assignmentIt->getAssignedExpression());
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << assignmentIt->getExpressionVariable().getName() << " := " << assignmentIt->getAssignedExpression() << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getExpressionVariable().getName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << assignmentIt->getExpressionVariable().getName() << " := " << assignmentIt->getAssignedExpression() << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getExpressionVariable().getName() << "'.");
@@ -278,6 +339,11 @@ namespace storm {
             // Retrieve the locations from the state.
             std::vector<uint64_t> locations = getLocations(*this->state);
             
+            // Reward and terminal state expressions are not compiled to bytecode, so they are evaluated by the evaluator.
+            if (!rewardVariables.empty() || !this->terminalStates.empty()) {
+                this->unpackStateIntoEvaluatorIfNecessary();
+            }
+            
             // First, construct the state rewards, as we may return early if there are no choices later and we already
             // need the state rewards then.
             std::vector<ValueType> stateRewards(this->rewardVariables.size(), storm::utility::zero<ValueType>());
@@ -363,26 +429,25 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback) {
+        Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, EdgeBytecode const& bytecode, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback) {
             // Determine the exit rate if it's a Markovian edge.
             boost::optional<ValueType> exitRate = boost::none;
             if (edge.hasRate()) {
-                exitRate = this->evaluator->asRational(edge.getRate());
+                exitRate = this->evaluateRationalExpression(bytecode.rate, edge.getRate());
             }
             
             Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
             
             // Iterate over all updates of the current command.
             ValueType probabilitySum = storm::utility::zero<ValueType>();
+            uint64_t destinationIndex = 0;
             for (auto const& destination : edge.getDestinations()) {
-                ValueType probability = this->evaluator->asRational(destination.getProbability());
+                ValueType probability = this->evaluateRationalExpression(bytecode.probabilities[destinationIndex], destination.getProbability());
                 
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    auto newState = applyUpdate(state, destination, this->variableInformation.locationVariables[automatonIndex]);
-                    
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, destination, this->variableInformation.locationVariables[automatonIndex]));
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, destination, bytecode.assignments[destinationIndex], this->variableInformation.locationVariables[automatonIndex]));
                     
                     // Update the choice by adding the probability/target state to it.
                     probability = exitRate ? exitRate.get() * probability : probability;
@@ -392,6 +457,7 @@ namespace storm {
                         probabilitySum += probability;
                     }
                 }
+                ++destinationIndex;
             }
             
             // Create the state-action reward for the newly created choice.
@@ -414,7 +480,7 @@ namespace storm {
                 checkGlobalVariableWritesValid(edgeCombination);
             }
             
-            std::vector<EdgeSetWithIndices::const_iterator> iteratorList(edgeCombination.size());
+            std::vector<typename EnabledEdgeSet::const_iterator> iteratorList(edgeCombination.size());
             
             // Initialize the list of iterators.
             for (size_t i = 0; i < edgeCombination.size(); ++i) {
@@ -433,24 +499,26 @@ namespace storm {
                 
                 EdgeIndexSet edgeIndices;
                 for (uint_fast64_t i = 0; i < iteratorList.size(); ++i) {
-                    auto const& indexAndEdge = *iteratorList[i];
+                    EnabledEdge const& enabledEdge = *iteratorList[i];
                     
                     if (this->getOptions().isBuildChoiceOriginsSet()) {
-                        edgeIndices.insert(model.encodeAutomatonAndEdgeIndices(edgeCombination[i].first, indexAndEdge.first));
+                        edgeIndices.insert(model.encodeAutomatonAndEdgeIndices(edgeCombination[i].first, enabledEdge.index));
                     }
                     
-                    storm::jani::Edge const& edge = *indexAndEdge.second;
+                    storm::jani::Edge const& edge = *enabledEdge.edge;
+                    EdgeBytecode const& bytecode = *enabledEdge.bytecode;
                     
+                    uint64_t destinationIndex = 0;
                     for (auto const& destination : edge.getDestinations()) {
                         for (auto const& stateProbability : currentDistribution) {
                             // Compute the new state under the current update and add it to the set of new target states.
-                            CompressedState newTargetState = applyUpdate(stateProbability.getState(), destination, this->variableInformation.locationVariables[edgeCombination[i].first]);
+                            CompressedState newTargetState = applyUpdate(stateProbability.getState(), destination, bytecode.assignments[destinationIndex], this->variableInformation.locationVariables[edgeCombination[i].first]);
                             
                             // If the new state was already found as a successor state, update the probability
                             // and otherwise insert it.
-                            ValueType probability = stateProbability.getValue() * this->evaluator->asRational(destination.getProbability());
+                            ValueType probability = stateProbability.getValue() * this->evaluateRationalExpression(bytecode.probabilities[destinationIndex], destination.getProbability());
                             if (edge.hasRate()) {
-                                probability *= this->evaluator->asRational(edge.getRate());
+                                probability *= this->evaluateRationalExpression(bytecode.rate, edge.getRate());
                             }
                             if (probability != storm::utility::zero<ValueType>()) {
                                 nextDistribution.add(newTargetState, probability);
@@ -460,6 +528,7 @@ namespace storm {
                         // Create the state-action reward for the newly created choice.
                         auto valueIt = stateActionRewards.begin();
                         performTransientAssignments(edge.getAssignments().getTransientAssignments(), [&valueIt] (ValueType const& value) { *valueIt += value; ++valueIt; } );
+                        ++destinationIndex;
                     }
                     
                     nextDistribution.compress();
@@ -533,12 +602,15 @@ namespace storm {
 
                     auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
                     if (edgesIt != nonsychingEdges.second.end()) {
-                        for (auto const& indexAndEdge : edgesIt->second) {
-                            if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                        EdgeSetInformation const& information = edgeSetInformation.at(&edgesIt->second);
+                        for (uint64_t candidate : information.guardIndex.getCandidates(state)) {
+                            auto const& indexAndEdge = edgesIt->second[candidate];
+                            EdgeBytecode const& bytecode = *information.bytecode[candidate];
+                            if (!this->evaluateBooleanExpression(bytecode.guard, indexAndEdge.second->getGuard())) {
                                 continue;
                             }
                         
-                            Choice<ValueType> choice = expandNonSynchronizingEdge(*indexAndEdge.second, outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(), automatonIndex, state, stateToIdCallback);
+                            Choice<ValueType> choice = expandNonSynchronizingEdge(*indexAndEdge.second, bytecode, outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(), automatonIndex, state, stateToIdCallback);
 
                             if (this->getOptions().isBuildChoiceOriginsSet()) {
                                 EdgeIndexSet edgeIndex { model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first) };
@@ -557,18 +629,21 @@ namespace storm {
                     bool productiveCombination = true;
                     for (auto const& automatonAndEdges : outputAndEdges.second) {
                         uint64_t automatonIndex = automatonAndEdges.first;
-                        EdgeSetWithIndices enabledEdgesOfAutomaton;
+                        EnabledEdgeSet enabledEdgesOfAutomaton;
                         
                         bool atLeastOneEdge = false;
                         auto edgesIt = automatonAndEdges.second.find(locations[automatonIndex]);
                         if (edgesIt != automatonAndEdges.second.end()) {
-                            for (auto const& indexAndEdge : edgesIt->second) {
-                                if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                            EdgeSetInformation const& information = edgeSetInformation.at(&edgesIt->second);
+                            for (uint64_t candidate : information.guardIndex.getCandidates(state)) {
+                                auto const& indexAndEdge = edgesIt->second[candidate];
+                                EdgeBytecode const* bytecode = information.bytecode[candidate];
+                                if (!this->evaluateBooleanExpression(bytecode->guard, indexAndEdge.second->getGuard())) {
                                     continue;
                                 }
                             
                                 atLeastOneEdge = true;
-                                enabledEdgesOfAutomaton.emplace_back(indexAndEdge);
+                                enabledEdgesOfAutomaton.push_back(EnabledEdge{indexAndEdge.first, indexAndEdge.second, bytecode});
                             }
                         }
 
@@ -598,8 +673,8 @@ namespace storm {
         void JaniNextStateGenerator<ValueType, StateType>::checkGlobalVariableWritesValid(AutomataEdgeSets const& enabledEdges) const {
             std::map<storm::expressions::Variable, uint64_t> writtenGlobalVariables;
             for (auto edgeSetIt = enabledEdges.begin(), edgeSetIte = enabledEdges.end(); edgeSetIt != edgeSetIte; ++edgeSetIt) {
-                for (auto const& indexAndEdge : edgeSetIt->second) {
-                    for (auto const& globalVariable : indexAndEdge.second->getWrittenGlobalVariables()) {
+                for (auto const& enabledEdge : edgeSetIt->second) {
+                    for (auto const& globalVariable : enabledEdge.edge->getWrittenGlobalVariables()) {
                         auto it = writtenGlobalVariables.find(globalVariable);
                         
                         auto index = std::distance(enabledEdges.begin(), edgeSetIt);
@@ -3,6 +3,7 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/OrderedAssignments.h"
@@ -23,6 +24,8 @@ namespace storm {
             
             JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options = NextStateGeneratorOptions());
             
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+            
             virtual ModelType getModelType() const override;
             virtual bool isDeterministicModel() const override;
             virtual bool isDiscreteTimeModel() const override;
@@ -60,15 +63,43 @@ namespace storm {
              */
             JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options, bool flag);
             
+            /*!
+             * The bytecode of the expressions of an edge.
+             */
+            struct EdgeBytecode {
+                boost::optional<ExpressionBytecode> guard;
+                boost::optional<ExpressionBytecode> rate;
+                
+                // The bytecode of the probabilities of the destinations.
+                std::vector<boost::optional<ExpressionBytecode>> probabilities;
+                
+                // The bytecode of the non-transient assignments of the destinations.
+                std::vector<std::vector<boost::optional<ExpressionBytecode>>> assignments;
+            };
+            
+            /*!
+             * Compiles the guards, rates, probabilities and non-transient assignments of all edges to bytecode that
+             * can be evaluated without unpacking the states.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Builds the indices over the guards of the edge sets of all locations that are used to skip the
+             * evaluation of guards that can not be satisfied in a state and resolves the bytecode of their edges.
+             * The expressions need to be compiled before.
+             */
+            void buildEdgeSetInformation();
+            
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
              * @params state The state to which to apply the new values.
              * @params update The update to apply.
+             * @params assignmentBytecode The bytecode of the non-transient assignments of the update.
              * @params locationVariable The location variable that is being updated.
              * @return The resulting state.
              */
-            CompressedState applyUpdate(CompressedState const& state, storm::jani::EdgeDestination const& update, storm::generator::LocationVariableInformation const& locationVariable);
+            CompressedState applyUpdate(CompressedState const& state, storm::jani::EdgeDestination const& update, std::vector<boost::optional<ExpressionBytecode>> const& assignmentBytecode, storm::generator::LocationVariableInformation const& locationVariable);
             
             /*!
              * Retrieves all choices possible from the given state.
@@ -80,16 +111,26 @@ namespace storm {
             std::vector<Choice<ValueType>> getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
             /*!
-             * Retrieves the choice generated by the given edge.
+             * Retrieves the choice generated by the given edge (whose expressions are compiled to the given bytecode).
              */
-            Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
+            Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, EdgeBytecode const& bytecode, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
             typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
             typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
             typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
             typedef std::pair<boost::optional<uint64_t>, AutomataAndEdges> OutputAndEdges;
 
-            typedef std::pair<uint64_t, EdgeSetWithIndices> AutomatonAndEdgeSet;
+            /*!
+             * An edge that is enabled in the current state together with its index in the automaton and its bytecode.
+             */
+            struct EnabledEdge {
+                uint64_t index;
+                storm::jani::Edge const* edge;
+                EdgeBytecode const* bytecode;
+            };
+            typedef std::vector<EnabledEdge> EnabledEdgeSet;
+            
+            typedef std::pair<uint64_t, EnabledEdgeSet> AutomatonAndEdgeSet;
             typedef std::vector<AutomatonAndEdgeSet> AutomataEdgeSets;
             
             std::vector<Choice<ValueType>> expandSynchronizingEdgeCombination(AutomataEdgeSets const& edgeCombination, uint64_t outputActionIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
@@ -129,6 +170,24 @@ namespace storm {
             /// The vector storing the edges that need to be explored (synchronously or asynchronously).
             std::vector<OutputAndEdges> edges;
             
+            /// The bytecode of the expressions of all edges that need to be explored.
+            std::unordered_map<storm::jani::Edge const*, EdgeBytecode> edgeBytecode;
+            
+            /*!
+             * The information about a set of edges leaving a location that is needed to expand it in a state.
+             */
+            struct EdgeSetInformation {
+                // An index over the guards of the edges.
+                GuardIndex guardIndex;
+                
+                // For each edge of the set, its bytecode, so that it is resolved once per edge and not per state.
+                std::vector<EdgeBytecode const*> bytecode;
+            };
+            
+            /// For each set of edges leaving a location (that need to be explored), an index over their guards and
+            /// the bytecode of the edges.
+            std::unordered_map<EdgeSetWithIndices const*, EdgeSetInformation> edgeSetInformation;
+            
             /// The transient variables of reward models that need to be considered.
             std::vector<storm::expressions::Variable> rewardVariables;
             
@@ -9,6 +9,7 @@
 
 #include "storm/models/sparse/StateLabeling.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -16,12 +17,12 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), stateUnpackedIntoEvaluator(false) {
             // Intentionally left empty.
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), stateUnpackedIntoEvaluator(false) {
             // Intentionally left empty.
         }
         
@@ -37,11 +38,60 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-            
-            // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // Expressions that were compiled to bytecode are evaluated directly on the compressed state, so we only
+            // unpack the state into the evaluator once it is needed.
             this->state = &state;
+            stateUnpackedIntoEvaluator = false;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::unpackStateIntoEvaluatorIfNecessary() const {
+            if (!stateUnpackedIntoEvaluator) {
+                STORM_LOG_ASSERT(state != nullptr, "Expected a loaded state.");
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                stateUnpackedIntoEvaluator = true;
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::evaluateBooleanExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const {
+            if (bytecode) {
+                return bytecode->evaluateAsBool(*state);
+            }
+            unpackStateIntoEvaluatorIfNecessary();
+            return evaluator->asBool(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        int_fast64_t NextStateGenerator<ValueType, StateType>::evaluateIntegerExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const {
+            if (bytecode) {
+                return bytecode->evaluateAsInt(*state);
+            }
+            unpackStateIntoEvaluatorIfNecessary();
+            return evaluator->asInt(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType NextStateGenerator<ValueType, StateType>::evaluateRationalExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const {
+            if (bytecode) {
+                return storm::utility::convertNumber<ValueType>(bytecode->evaluateAsDouble(*state));
+            }
+            unpackStateIntoEvaluatorIfNecessary();
+            return evaluator->asRational(expression);
+        }
+        
+        template<typename ValueType, typename StateType>
+        ExpressionBytecodeCompiler NextStateGenerator<ValueType, StateType>::createExpressionCompiler() const {
+            return ExpressionBytecodeCompiler(variableInformation, std::is_same<ValueType, double>::value);
+        }
+        
+        template<typename ValueType, typename StateType>
+        boost::optional<ExpressionBytecode> NextStateGenerator<ValueType, StateType>::compileExpression(ExpressionBytecodeCompiler& compiler, storm::expressions::Expression const& expression) const {
+            if (!std::is_same<ValueType, double>::value && !expression.hasBooleanType() && !expression.hasIntegerType()) {
+                return boost::none;
+            }
+            return compiler.compile(expression);
         }
         
         template<typename ValueType, typename StateType>
@@ -49,6 +99,7 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
+            unpackStateIntoEvaluatorIfNecessary();
             return evaluator->asBool(expression);
         }
         
@@ -74,17 +125,19 @@ namespace storm {
                 result.addLabel(label.first);
             }
             
-            auto const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            stateStorage.forEachState([&] (CompressedState const& state, StateType const& index) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, index);
                     }
                 }
-            }
+            });
+            
+            // The evaluator no longer holds the values of the loaded state (if any).
+            stateUnpackedIntoEvaluator = false;
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -16,6 +16,7 @@
 
 #include "storm/generator/VariableInformation.h"
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/ExpressionBytecode.h"
 #include "storm/generator/StateBehavior.h"
 
 #include "storm/utility/ConstantsComparator.h"
@@ -46,6 +47,12 @@ namespace storm {
             
             virtual ~NextStateGenerator() = default;
             
+            /*!
+             * Creates a new generator for the same model and with the same options. As generators are not thread-safe,
+             * exploring the state space with multiple threads requires one generator per thread.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const = 0;
+            
             uint64_t getStateSize() const;
             virtual ModelType getModelType() const = 0;
             virtual bool isDeterministicModel() const = 0;
@@ -75,6 +82,34 @@ namespace storm {
             
             void postprocess(StateBehavior<ValueType, StateType>& result);
             
+            /*!
+             * Unpacks the currently loaded state into the evaluator unless this was already done. As states are only
+             * unpacked lazily, this needs to be called before using the evaluator directly.
+             */
+            void unpackStateIntoEvaluatorIfNecessary() const;
+            
+            /*!
+             * Evaluates the given expression in the currently loaded state. If the given bytecode is present, it is
+             * evaluated directly on the compressed state. Otherwise, the state is unpacked into the evaluator (if
+             * necessary) and the expression is evaluated by the evaluator.
+             */
+            bool evaluateBooleanExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const;
+            int_fast64_t evaluateIntegerExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const;
+            ValueType evaluateRationalExpression(boost::optional<ExpressionBytecode> const& bytecode, storm::expressions::Expression const& expression) const;
+            
+            /*!
+             * Creates a compiler for expressions over the variables of this generator. Unless the value type is double,
+             * the compiler refuses expressions with rational subexpressions, because the evaluation of bytecode is not
+             * exact.
+             */
+            ExpressionBytecodeCompiler createExpressionCompiler() const;
+            
+            /*!
+             * Compiles the given expression to bytecode operating on the compressed states of this generator. Rational
+             * expressions are only compiled if the value type is double, because the evaluation of bytecode is not exact.
+             */
+            boost::optional<ExpressionBytecode> compileExpression(ExpressionBytecodeCompiler& compiler, storm::expressions::Expression const& expression) const;
+            
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
             
@@ -93,6 +128,9 @@ namespace storm {
             /// The currently loaded state.
             CompressedState const* state;
             
+            /// Whether the currently loaded state was already unpacked into the evaluator.
+            mutable bool stateUnpackedIntoEvaluator;
+            
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
         };
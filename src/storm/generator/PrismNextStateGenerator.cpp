@@ -38,6 +38,10 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            // Compile the expressions that are evaluated in every state.
+            this->compileExpressions();
+            this->buildGuardIndices();
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -112,6 +116,91 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            // Determine the number of commands and updates.
+            uint_fast64_t numberOfCommands = 0;
+            uint_fast64_t numberOfUpdates = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    numberOfCommands = std::max(numberOfCommands, command.getGlobalIndex() + 1);
+                    for (auto const& update : command.getUpdates()) {
+                        numberOfUpdates = std::max(numberOfUpdates, update.getGlobalIndex() + 1);
+                    }
+                }
+            }
+            guardBytecode.resize(numberOfCommands);
+            likelihoodBytecode.resize(numberOfUpdates);
+            assignmentBytecode.resize(numberOfUpdates);
+            
+            ExpressionBytecodeCompiler compiler = this->createExpressionCompiler();
+            uint_fast64_t numberOfCompiledExpressions = 0;
+            uint_fast64_t numberOfExpressions = 0;
+            auto compile = [&] (storm::expressions::Expression const& expression) {
+                boost::optional<ExpressionBytecode> result = this->compileExpression(compiler, expression);
+                ++numberOfExpressions;
+                if (result) {
+                    ++numberOfCompiledExpressions;
+                }
+                return result;
+            };
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    guardBytecode[command.getGlobalIndex()] = compile(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        likelihoodBytecode[update.getGlobalIndex()] = compile(update.getLikelihoodExpression());
+                        std::vector<boost::optional<ExpressionBytecode>>& assignments = assignmentBytecode[update.getGlobalIndex()];
+                        for (auto const& assignment : update.getAssignments()) {
+                            assignments.push_back(compile(assignment.getExpression()));
+                        }
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Compiled " << numberOfCompiledExpressions << " of " << numberOfExpressions << " expressions to bytecode.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            auto indexCommands = [this] (storm::prism::Module const& module, std::vector<uint_fast64_t> const& commandIndices) {
+                std::vector<storm::expressions::Expression> guards;
+                for (auto commandIndex : commandIndices) {
+                    guards.push_back(module.getCommand(commandIndex).getGuardExpression());
+                }
+                return IndexedCommands({commandIndices, GuardIndex(guards, this->variableInformation)});
+            };
+            
+            uint_fast64_t numberOfDiscriminatingIndices = 0;
+            uint_fast64_t numberOfIndices = 0;
+            for (auto const& module : program.getModules()) {
+                std::vector<uint_fast64_t> unlabeledCommandIndices;
+                for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    if (!module.getCommand(commandIndex).isLabeled()) {
+                        unlabeledCommandIndices.push_back(commandIndex);
+                    }
+                }
+                unlabeledCommands.push_back(indexCommands(module, unlabeledCommandIndices));
+                
+                labeledCommands.emplace_back();
+                for (auto actionIndex : module.getSynchronizingActionIndices()) {
+                    std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                    labeledCommands.back().emplace(actionIndex, indexCommands(module, std::vector<uint_fast64_t>(commandIndices.begin(), commandIndices.end())));
+                }
+                
+                numberOfIndices += 1 + labeledCommands.back().size();
+                numberOfDiscriminatingIndices += unlabeledCommands.back().guardIndex.isDiscriminating() ? 1 : 0;
+                for (auto const& actionAndCommands : labeledCommands.back()) {
+                    numberOfDiscriminatingIndices += actionAndCommands.second.guardIndex.isDiscriminating() ? 1 : 0;
+                }
+            }
+            STORM_LOG_TRACE("Found discriminating variables for " << numberOfDiscriminatingIndices << " of " << numberOfIndices << " command sets.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            // The program was already preprocessed, so we can use the delegate constructor directly.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(this->program, this->options, false));
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -188,6 +277,11 @@ namespace storm {
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
             
+            // Reward and terminal state expressions are not compiled to bytecode, so they are evaluated by the evaluator.
+            if (!rewardModels.empty() || !this->terminalStates.empty()) {
+                this->unpackStateIntoEvaluatorIfNecessary();
+            }
+            
             // First, construct the state rewards, as we may return early if there are no choices later and we already
             // need the state rewards then.
             for (auto const& rewardModel : rewardModels) {
@@ -303,21 +397,22 @@ namespace storm {
             auto assignmentIte = update.getAssignments().end();
             
             // Iterate over all boolean assignments and carry them out.
+            auto bytecodeIt = assignmentBytecode[update.getGlobalIndex()].begin();
             auto boolIt = this->variableInformation.booleanVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++bytecodeIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                newState.set(boolIt->bitOffset, this->evaluateBooleanExpression(*bytecodeIt, assignmentIt->getExpression()));
             }
             
             // Iterate over all integer assignments and carry them out.
             auto integerIt = this->variableInformation.integerVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++bytecodeIt) {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = this->evaluateIntegerExpression(*bytecodeIt, assignmentIt->getExpression());
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
@@ -345,20 +440,22 @@ namespace storm {
                     continue;
                 }
                 
-                std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                auto commandsIt = labeledCommands[i].find(actionIndex);
                 
                 // If the module contains the action, but there is no command in the module that is labeled with
                 // this action, we don't have any feasible command combinations.
-                if (commandIndices.empty()) {
+                if (commandsIt == labeledCommands[i].end() || commandsIt->second.commandIndices.empty()) {
                     return boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>>();
                 }
+                IndexedCommands const& indexedCommands = commandsIt->second;
                 
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
                 
-                // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-                for (uint_fast64_t commandIndex : commandIndices) {
-                    storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                // Look up the commands whose guards may hold according to the index and add them if the guard
+                // evaluates to true in the given state.
+                for (uint_fast64_t candidate : indexedCommands.guardIndex.getCandidates(*this->state)) {
+                    storm::prism::Command const& command = module.getCommand(indexedCommands.commandIndices[candidate]);
+                    if (this->evaluateBooleanExpression(guardBytecode[command.getGlobalIndex()], command.getGuardExpression())) {
                         commands.push_back(command);
                     }
                 }
@@ -384,15 +481,13 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
                 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
-                    storm::prism::Command const& command = module.getCommand(j);
-                    
-                    // Only consider unlabeled commands.
-                    if (command.isLabeled()) continue;
+                // Iterate over the unlabeled commands whose guards may hold according to the index.
+                IndexedCommands const& indexedCommands = unlabeledCommands[i];
+                for (uint_fast64_t candidate : indexedCommands.guardIndex.getCandidates(state)) {
+                    storm::prism::Command const& command = module.getCommand(indexedCommands.commandIndices[candidate]);
                     
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!this->evaluateBooleanExpression(guardBytecode[command.getGlobalIndex()], command.getGuardExpression())) {
                         continue;
                     }
                     
@@ -410,7 +505,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = this->evaluateRationalExpression(likelihoodBytecode[update.getGlobalIndex()], update.getLikelihoodExpression());
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -481,7 +576,7 @@ namespace storm {
                                 storm::prism::Update const& update = command.getUpdate(j);
                                 
                                 for (auto const& stateProbability : currentDistribution) {
-                                    ValueType probability = stateProbability.getValue() * this->evaluator->asRational(update.getLikelihoodExpression());
+                                    ValueType probability = stateProbability.getValue() * this->evaluateRationalExpression(likelihoodBytecode[update.getGlobalIndex()], update.getLikelihoodExpression());
 
                                     if (!storm::utility::isZero<ValueType>(probability)) {
                                         // Compute the new state under the current update and add it to the set of new target states.
@@ -1,9 +1,12 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <unordered_map>
+
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -18,6 +21,8 @@ namespace storm {
             
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options = NextStateGeneratorOptions());
 
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+            
             virtual ModelType getModelType() const override;
             virtual bool isDeterministicModel() const override;
             virtual bool isDiscreteTimeModel() const override;
@@ -34,6 +39,18 @@ namespace storm {
 
         private:
             void checkValid() const;
+            
+            /*!
+             * Compiles the guards, likelihoods and assigned expressions of all commands to bytecode that can be
+             * evaluated without unpacking the states.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Builds the indices over the guards of the commands of all modules that are used to skip the evaluation of
+             * guards that can not be satisfied in a state.
+             */
+            void buildGuardIndices();
 
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
@@ -93,6 +110,28 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // The bytecode of the guards of all commands (indexed by the global command index).
+            std::vector<boost::optional<ExpressionBytecode>> guardBytecode;
+            
+            // The bytecode of the likelihood expressions of all updates (indexed by the global update index).
+            std::vector<boost::optional<ExpressionBytecode>> likelihoodBytecode;
+            
+            // The bytecode of the assigned expressions of all updates (indexed by the global update index and then
+            // ordered like the assignments of the update).
+            std::vector<std::vector<boost::optional<ExpressionBytecode>>> assignmentBytecode;
+            
+            // A set of commands of a module (given by their indices within the module) with an index over their guards.
+            struct IndexedCommands {
+                std::vector<uint_fast64_t> commandIndices;
+                GuardIndex guardIndex;
+            };
+            
+            // For each module, its unlabeled commands.
+            std::vector<IndexedCommands> unlabeledCommands;
+            
+            // For each module, its commands labeled with a given action (indexed by the action index).
+            std::vector<std::unordered_map<uint_fast64_t, IndexedCommands>> labeledCommands;
         };
         
     }
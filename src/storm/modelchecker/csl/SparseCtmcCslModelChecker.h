@@ -2,6 +2,7 @@
 #define STORM_MODELCHECKER_SPARSECTMCCSLMODELCHECKER_H_
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcUniformizationCache.h"
 
 #include "storm/models/sparse/Ctmc.h"
 
@@ -33,6 +34,20 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+            
+            /*!
+             * Computes the probabilities to satisfy the given until formula within [0, t] for each of the given time
+             * bounds t. All time bounds are handled in a single sweep over the uniformized CTMC.
+             *
+             * @return The results for the individual time bounds (in the order of the given time bounds).
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitySeries(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask, std::vector<double> const& upperBounds);
+            
+            /*!
+             * Retrieves the cache holding the uniformized matrices of this model checker. It is shared by all
+             * time-bounded properties that are checked with this model checker.
+             */
+            helper::SparseCtmcUniformizationCache<ValueType> const& getUniformizationCache() const;
 
         private:
             template<typename CValueType = ValueType, typename std::enable_if<storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
@@ -40,7 +55,9 @@ namespace storm {
 
             template<typename CValueType = ValueType, typename std::enable_if<!storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
             bool canHandleImplementation(CheckTask<storm::logic::Formula, CValueType> const& checkTask) const;
-
+            
+            // The uniformized matrices that were computed for time-bounded properties.
+            std::shared_ptr<helper::SparseCtmcUniformizationCache<ValueType>> uniformizationCache;
         };
         
     } // namespace modelchecker
@@ -5,6 +5,9 @@
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
@@ -19,8 +22,10 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/numerical.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
@@ -30,10 +35,15 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<ValueType>* uniformizationCache) {
                 
                 uint_fast64_t numberOfStates = rateMatrix.getRowCount();
                 
+                // If no cache was given, we use one that only lives during this computation.
+                SparseCtmcUniformizationCache<ValueType> localUniformizationCache(rateMatrix, exitRates);
+                SparseCtmcUniformizationCache<ValueType>& cache = uniformizationCache != nullptr ? *uniformizationCache : localUniformizationCache;
+                STORM_LOG_ASSERT(&cache.getRateMatrix() == &rateMatrix, "The uniformization cache belongs to a different CTMC.");
+                
                 // If the time bounds are [0, inf], we rather call untimed reachability.
                 if (storm::utility::isZero(lowerBound) && upperBound == storm::utility::infinity<ValueType>()) {
                     return computeUntilProbabilities(env, std::move(goal), rateMatrix, backwardTransitions, exitRates, phiStates, psiStates, qualitative);
@@ -71,7 +81,7 @@ namespace storm {
                             STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                             
                             // Compute the uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                            storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = cache.getUniformizedMatrix(statesWithProbabilityGreater0NonPsi, uniformizationRate);
                             
                             // Compute the vector that is to be added as a compensation for removing the absorbing states.
                             std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -106,7 +116,7 @@ namespace storm {
                             STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                             
                             // Compute the uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                            storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = cache.getUniformizedMatrix(relevantStates, uniformizationRate);
                             
                             // Compute the transient probabilities.
                             subResult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult);
@@ -129,7 +139,7 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Compute the (first) uniformized matrix.
-                                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                                storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = cache.getUniformizedMatrix(statesWithProbabilityGreater0NonPsi, uniformizationRate);
                                 
                                 // Compute the vector that is to be added as a compensation for removing the absorbing states.
                                 std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -156,8 +166,8 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Finally, we compute the second set of transient probabilities.
-                                uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-                                newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
+                                storm::storage::SparseMatrix<ValueType> const& secondUniformizedMatrix = cache.getUniformizedMatrix(relevantStates, uniformizationRate);
+                                newSubresult = computeTransientProbabilities<ValueType>(env, secondUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
                                 
                                 // Fill in the correct values.
                                 result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
@@ -179,7 +189,7 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Finally, we compute the second set of transient probabilities.
-                                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
+                                storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = cache.getUniformizedMatrix(statesWithProbabilityGreater0, uniformizationRate);
                                 newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
                                 
                                 // Fill in the correct values.
@@ -197,7 +207,68 @@ namespace storm {
             }
             
             template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, double, double) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, double, double, SparseCtmcUniformizationCache<ValueType>*) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<ValueType>* uniformizationCache) {
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException, "Time bound " << upperBound << " is not a finite, non-negative number.");
+                }
+                
+                // The psi states are satisfied immediately for all time bounds.
+                std::vector<std::vector<ValueType>> result(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+                for (auto& values : result) {
+                    storm::utility::vector::setVectorValues(values, psiStates, storm::utility::one<ValueType>());
+                }
+                
+                // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+                // further computations.
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                if (statesWithProbabilityGreater0NonPsi.empty() || upperBounds.empty()) {
+                    return result;
+                }
+                
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                for (auto const& state : statesWithProbabilityGreater0NonPsi) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                // Compute the uniformized matrix (or take it from the cache).
+                SparseCtmcUniformizationCache<ValueType> localUniformizationCache(rateMatrix, exitRates);
+                SparseCtmcUniformizationCache<ValueType>& cache = uniformizationCache != nullptr ? *uniformizationCache : localUniformizationCache;
+                STORM_LOG_ASSERT(&cache.getRateMatrix() == &rateMatrix, "The uniformization cache belongs to a different CTMC.");
+                storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix = cache.getUniformizedMatrix(statesWithProbabilityGreater0NonPsi, uniformizationRate);
+                
+                // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+                
+                // Finally compute the transient probabilities for all time bounds at once.
+                std::vector<ValueType> timeBounds;
+                timeBounds.reserve(upperBounds.size());
+                for (auto const& upperBound : upperBounds) {
+                    timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+                }
+                std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                std::vector<std::vector<ValueType>> subresults = computeTransientProbabilitySeries(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values);
+                for (uint64_t index = 0; index < upperBounds.size(); ++index) {
+                    storm::utility::vector::setVectorValues(result[index], statesWithProbabilityGreater0NonPsi, subresults[index]);
+                }
+                return result;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitySeries(Environment const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&, SparseCtmcUniformizationCache<ValueType>*) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
@@ -373,6 +444,156 @@ namespace storm {
                                                          exitRateVector);
             }
             
+            template<typename ValueType>
+            bool isBetterPivot(ValueType const& candidate, ValueType const& pivot) {
+                return storm::utility::isZero(pivot) && !storm::utility::isZero(candidate);
+            }
+            
+            template<>
+            bool isBetterPivot(double const& candidate, double const& pivot) {
+                return std::abs(candidate) > std::abs(pivot);
+            }
+            
+            /*!
+             * Solves the given dense equation system by Gaussian elimination with partial pivoting. The matrix is
+             * stored row by row. Both the matrix and the right-hand side are modified in the process.
+             */
+            template<typename ValueType>
+            std::vector<ValueType> solveDenseEquationSystem(uint64_t dimension, std::vector<ValueType>& matrix, std::vector<ValueType>& rightHandSide) {
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    uint64_t pivotRow = column;
+                    for (uint64_t row = column + 1; row < dimension; ++row) {
+                        if (isBetterPivot(matrix[row * dimension + column], matrix[pivotRow * dimension + column])) {
+                            pivotRow = row;
+                        }
+                    }
+                    STORM_LOG_THROW(!storm::utility::isZero(matrix[pivotRow * dimension + column]), storm::exceptions::InvalidStateException, "The equation system of a BSCC is singular.");
+                    if (pivotRow != column) {
+                        std::swap_ranges(matrix.begin() + pivotRow * dimension + column, matrix.begin() + (pivotRow + 1) * dimension, matrix.begin() + column * dimension + column);
+                        std::swap(rightHandSide[pivotRow], rightHandSide[column]);
+                    }
+                    
+                    ValueType const& pivot = matrix[column * dimension + column];
+                    for (uint64_t row = column + 1; row < dimension; ++row) {
+                        ValueType& entry = matrix[row * dimension + column];
+                        if (storm::utility::isZero(entry)) {
+                            continue;
+                        }
+                        ValueType factor = entry / pivot;
+                        for (uint64_t otherColumn = column + 1; otherColumn < dimension; ++otherColumn) {
+                            matrix[row * dimension + otherColumn] -= factor * matrix[column * dimension + otherColumn];
+                        }
+                        rightHandSide[row] -= factor * rightHandSide[column];
+                        entry = storm::utility::zero<ValueType>();
+                    }
+                }
+                
+                std::vector<ValueType> solution(dimension, storm::utility::zero<ValueType>());
+                for (uint64_t row = dimension; row > 0; --row) {
+                    uint64_t currentRow = row - 1;
+                    ValueType value = rightHandSide[currentRow];
+                    for (uint64_t column = row; column < dimension; ++column) {
+                        value -= matrix[currentRow * dimension + column] * solution[column];
+                    }
+                    solution[currentRow] = value / matrix[currentRow * dimension + currentRow];
+                }
+                return solution;
+            }
+            
+            /*!
+             * Computes the stationary distribution of the given BSCC with a dense direct solver. The entries of the
+             * result correspond to the states of the BSCC in ascending order.
+             */
+            template<typename ValueType>
+            std::vector<ValueType> computeBsccStationaryDistributionDirect(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::StronglyConnectedComponent const& bscc, std::vector<uint64_t> const& stateToIndexInBscc) {
+                uint64_t dimension = bscc.size();
+                if (dimension == 1) {
+                    return std::vector<ValueType>(1, storm::utility::one<ValueType>());
+                }
+                
+                // Build the transposed equation system x * (P - I) = 0 in which the last equation is replaced by the
+                // constraint that the values sum to one.
+                std::vector<ValueType> matrix(dimension * dimension, storm::utility::zero<ValueType>());
+                for (auto const& state : bscc) {
+                    uint64_t column = stateToIndexInBscc[state];
+                    for (auto const& entry : probabilityMatrix.getRow(state)) {
+                        if (bscc.containsState(entry.getColumn())) {
+                            matrix[stateToIndexInBscc[entry.getColumn()] * dimension + column] += entry.getValue();
+                        }
+                    }
+                }
+                for (uint64_t row = 0; row < dimension - 1; ++row) {
+                    matrix[row * dimension + row] -= storm::utility::one<ValueType>();
+                }
+                std::fill(matrix.end() - dimension, matrix.end(), storm::utility::one<ValueType>());
+                
+                std::vector<ValueType> rightHandSide(dimension, storm::utility::zero<ValueType>());
+                rightHandSide.back() = storm::utility::one<ValueType>();
+                return solveDenseEquationSystem(dimension, matrix, rightHandSide);
+            }
+            
+            /*!
+             * Computes the stationary distribution of the given BSCC with a solver created by the given factory.
+             * The entries of the result correspond to the states of the BSCC in ascending order.
+             */
+            template<typename ValueType>
+            std::vector<ValueType> computeBsccStationaryDistributionIterative(Environment const& env, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::StronglyConnectedComponent const& bscc, std::vector<uint64_t> const& stateToIndexInBscc) {
+                ValueType one = storm::utility::one<ValueType>();
+                ValueType zero = storm::utility::zero<ValueType>();
+                uint64_t dimension = bscc.size();
+                
+                // Get the restriction of the probability matrix to the BSCC (with an entry on each diagonal position).
+                // Since in the fix point equation, we need to multiply the vector from the left, we convert this to a
+                // multiplication from the right by transposing the system.
+                storm::storage::SparseMatrixBuilder<ValueType> subsystemBuilder(dimension, dimension);
+                for (auto const& state : bscc) {
+                    uint64_t row = stateToIndexInBscc[state];
+                    bool insertedDiagonal = false;
+                    for (auto const& entry : probabilityMatrix.getRow(state)) {
+                        if (!bscc.containsState(entry.getColumn())) {
+                            continue;
+                        }
+                        uint64_t column = stateToIndexInBscc[entry.getColumn()];
+                        if (!insertedDiagonal && column >= row) {
+                            if (column > row) {
+                                subsystemBuilder.addNextValue(row, row, zero);
+                            }
+                            insertedDiagonal = true;
+                        }
+                        subsystemBuilder.addNextValue(row, column, entry.getValue());
+                    }
+                    if (!insertedDiagonal) {
+                        subsystemBuilder.addNextValue(row, row, zero);
+                    }
+                }
+                storm::storage::SparseMatrix<ValueType> subsystem = subsystemBuilder.build().transpose(false, true);
+                
+                // Now build the final equation system. We substitute the first row by the constraint that the values
+                // must sum to one and subtract 1 from the diagonal of all other rows.
+                storm::storage::SparseMatrixBuilder<ValueType> builder(dimension, dimension);
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    builder.addNextValue(0, column, one);
+                }
+                for (uint64_t row = 1; row < dimension; ++row) {
+                    for (auto const& entry : subsystem.getRow(row)) {
+                        if (entry.getColumn() == row) {
+                            builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
+                        } else {
+                            builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                        }
+                    }
+                }
+                
+                std::vector<ValueType> rightHandSide(dimension, zero);
+                rightHandSide.front() = one;
+                
+                // As initial guess, we take a uniform distribution over all states of the BSCC.
+                std::vector<ValueType> solution(dimension, one / storm::utility::convertNumber<ValueType>(dimension));
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, builder.build());
+                solver->solveEquations(env, solution, rightHandSide);
+                return solution;
+            }
+            
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeLongRunAverages(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, std::function<ValueType (storm::storage::sparse::state_type const& state)> const& valueGetter, std::vector<ValueType> const* exitRateVector){
                 uint_fast64_t numberOfStates = probabilityMatrix.getRowCount();
@@ -389,155 +610,97 @@ namespace storm {
                 // Prepare the vector holding the LRA values for each of the BSCCs.
                 std::vector<ValueType> bsccLra(bsccDecomposition.size(), zero);
                 
-                // First we check which states are in BSCCs.
+                // First we check which states are in BSCCs and where they are located within their BSCC.
                 storm::storage::BitVector statesInBsccs(numberOfStates);
-                storm::storage::BitVector firstStatesInBsccs(numberOfStates);
+                std::vector<uint_fast64_t> stateToBsccIndexMap(numberOfStates);
+                std::vector<uint64_t> stateToIndexInBscc(numberOfStates);
+                uint64_t directSolverThreshold = env.modelchecker().getLraDirectSolverThreshold();
+                std::vector<uint64_t> smallBsccs;
+                std::vector<uint64_t> largeBsccs;
                 
                 for (uint_fast64_t currentBsccIndex = 0; currentBsccIndex < bsccDecomposition.size(); ++currentBsccIndex) {
                     storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[currentBsccIndex];
                     
                     // Gather information for later use.
-                    bool first = true;
+                    uint64_t indexInBscc = 0;
                     for (auto const& state : bscc) {
                         statesInBsccs.set(state);
-                        if (first) {
-                            firstStatesInBsccs.set(state);
-                        }
-                        first = false;
+                        stateToBsccIndexMap[state] = currentBsccIndex;
+                        stateToIndexInBscc[state] = indexInBscc;
+                        ++indexInBscc;
+                    }
+                    
+                    if (bscc.size() <= std::max<uint64_t>(directSolverThreshold, 1)) {
+                        smallBsccs.push_back(currentBsccIndex);
+                    } else {
+                        largeBsccs.push_back(currentBsccIndex);
                     }
                 }
                 storm::storage::BitVector statesNotInBsccs = ~statesInBsccs;
                 
                 STORM_LOG_DEBUG("Found " << statesInBsccs.getNumberOfSetBits() << " states in BSCCs.");
                 
-                // Prepare a vector holding the index within all states that are in BSCCs for every state.
-                std::vector<uint_fast64_t> indexInStatesInBsccs;
-                
-                // Prepare a vector that maps the index within the set of all states in BSCCs to the index of the containing BSCC.
-                std::vector<uint_fast64_t> stateToBsccIndexMap;
+                // The solver factory is shared by the large BSCCs and the reachability computation.
+                storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                if (!largeBsccs.empty() || !statesNotInBsccs.empty()) {
+                    // Check solver requirements
+                    auto requirements = linearEquationSolverFactory.getRequirements(env);
+                    STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+                    // Check whether we have the right input format for the solver.
+                    STORM_LOG_THROW(linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem, storm::exceptions::FormatUnsupportedBySolverException, "The selected solver does not support the required format.");
+                }
                 
-                if (!statesInBsccs.empty()) {
-                    firstStatesInBsccs = firstStatesInBsccs % statesInBsccs;
-                    
-                    // Then we construct an equation system that yields the steady state probabilities for all states in BSCCs.
-                    storm::storage::SparseMatrix<ValueType> bsccEquationSystem = probabilityMatrix.getSubmatrix(false, statesInBsccs, statesInBsccs, true);
-                    
-                    // Since in the fix point equation, we need to multiply the vector from the left, we convert this to a
-                    // multiplication from the right by transposing the system.
-                    bsccEquationSystem = bsccEquationSystem.transpose(false, true);
-                    
-                    // Create an auxiliary structure that makes it easy to look up the indices within the set of BSCC states.
-                    uint_fast64_t lastIndex = 0;
-                    uint_fast64_t currentNumberOfSetBits = 0;
-                    indexInStatesInBsccs.reserve(probabilityMatrix.getRowCount());
-                    for (auto index : statesInBsccs) {
-                        while (lastIndex <= index) {
-                            indexInStatesInBsccs.push_back(currentNumberOfSetBits);
-                            ++lastIndex;
-                        }
-                        ++currentNumberOfSetBits;
-                    }
-                    
-                    stateToBsccIndexMap.resize(statesInBsccs.getNumberOfSetBits());
-                    for (uint_fast64_t currentBsccIndex = 0; currentBsccIndex < bsccDecomposition.size(); ++currentBsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[currentBsccIndex];
-                        for (auto const& state : bscc) {
-                            stateToBsccIndexMap[indexInStatesInBsccs[state]] = currentBsccIndex;
-                        }
-                    }
-                    
-                    // Now build the final equation system matrix, the initial guess and the right-hand side in one go.
-                    std::vector<ValueType> bsccEquationSystemRightSide(bsccEquationSystem.getColumnCount(), zero);
-                    storm::storage::SparseMatrixBuilder<ValueType> builder;
-                    for (uint_fast64_t row = 0; row < bsccEquationSystem.getRowCount(); ++row) {
-                        
-                        // If the current row is the first one belonging to a BSCC, we substitute it by the constraint that the
-                        // values for states of this BSCC must sum to one. However, in order to have a non-zero value on the
-                        // diagonal, we add the constraint of the BSCC that produces a 1 on the diagonal.
-                        if (firstStatesInBsccs.get(row)) {
-                            uint_fast64_t requiredBscc = stateToBsccIndexMap[row];
-                            storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[requiredBscc];
-                            
-                            for (auto const& state : bscc) {
-                                builder.addNextValue(row, indexInStatesInBsccs[state], one);
-                            }
-                            
-                            bsccEquationSystemRightSide[row] = one;
-                            
-                        } else {
-                            // Otherwise, we copy the row, and subtract 1 from the diagonal.
-                            for (auto& entry : bsccEquationSystem.getRow(row)) {
-                                if (entry.getColumn() == row) {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
-                                } else {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
-                                }
-                            }
-                        }
-                        
-                    }
-                    
-                    // Create the initial guess for the LRAs. We take a uniform distribution over all states in a BSCC.
-                    std::vector<ValueType> bsccEquationSystemSolution(bsccEquationSystem.getColumnCount(), zero);
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        for (auto const& state : bscc) {
-                            bsccEquationSystemSolution[indexInStatesInBsccs[state]] = one / bscc.size();
-                        }
-                    }
-                    
-                    bsccEquationSystem = builder.build();
-                    
-                    {
-                        // Check solver requirements
-                        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
-                        auto requirements = linearEquationSolverFactory.getRequirements(env);
-                        STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
-                        // Check whether we have the right input format for the solver.
-                        STORM_LOG_THROW(linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem, storm::exceptions::FormatUnsupportedBySolverException, "The selected solver does not support the required format.");
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(bsccEquationSystem));
-                        solver->solveEquations(env, bsccEquationSystemSolution, bsccEquationSystemRightSide);
-                    }
+                // Computes the LRA value of a BSCC from its steady state distribution.
+                auto computeBsccLra = [&] (uint64_t bsccIndex, std::vector<ValueType>&& distribution) {
+                    storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
                     
                     // If exit rates were given, we need to 'fix' the results to also account for the timing behaviour.
                     if (exitRateVector != nullptr) {
-                        std::vector<ValueType> bsccTotalValue(bsccDecomposition.size(), zero);
-                        for (auto stateIter = statesInBsccs.begin(); stateIter != statesInBsccs.end(); ++stateIter) {
-                            bsccTotalValue[stateToBsccIndexMap[indexInStatesInBsccs[*stateIter]]] += bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] * (one / (*exitRateVector)[*stateIter]);
-                        }
-                        
-                        for (auto stateIter = statesInBsccs.begin(); stateIter != statesInBsccs.end(); ++stateIter) {
-                            bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] = (bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] * (one / (*exitRateVector)[*stateIter])) / bsccTotalValue[stateToBsccIndexMap[indexInStatesInBsccs[*stateIter]]];
-                        }
-                    }
-                                        
-                    // Calculate LRA Value for each BSCC from steady state distribution in BSCCs.
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
+                        ValueType totalValue = zero;
+                        auto distributionIt = distribution.begin();
                         for (auto const& state : bscc) {
-                            bsccLra[stateToBsccIndexMap[indexInStatesInBsccs[state]]] += valueGetter(state) * bsccEquationSystemSolution[indexInStatesInBsccs[state]];
+                            *distributionIt *= one / (*exitRateVector)[state];
+                            totalValue += *distributionIt;
+                            ++distributionIt;
+                        }
+                        for (auto& value : distribution) {
+                            value /= totalValue;
                         }
                     }
                     
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
+                    ValueType lra = zero;
+                    auto distributionIt = distribution.begin();
+                    for (auto const& state : bscc) {
+                        lra += valueGetter(state) * *distributionIt;
+                        ++distributionIt;
                     }
+                    bsccLra[bsccIndex] = std::move(lra);
+                };
+                
+                // The small BSCCs are solved directly. As they are independent, they are distributed over a pool of
+                // threads (for rational functions, we stay sequential as their operations are not thread-safe).
+                STORM_LOG_DEBUG("Solving " << smallBsccs.size() << " BSCCs directly and " << largeBsccs.size() << " BSCCs with the linear equation solver.");
+                auto solveSmallBscc = [&] (uint64_t task) {
+                    uint64_t bsccIndex = smallBsccs[task];
+                    computeBsccLra(bsccIndex, computeBsccStationaryDistributionDirect(probabilityMatrix, bsccDecomposition[bsccIndex], stateToIndexInBscc));
+                };
+                uint64_t numberOfThreads = env.modelchecker().getLraNumberOfThreads();
+                if (std::is_same<ValueType, double>::value && numberOfThreads != 1 && smallBsccs.size() > 1) {
+                    storm::utility::getThreadPool().execute(smallBsccs.size(), solveSmallBscc, numberOfThreads);
                 } else {
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        // At this point, all BSCCs are known to contain exactly one state, which is why we can set all values
-                        // directly (based on whether or not the contained state is a psi state).
-                        bsccLra[bsccIndex] = valueGetter(*bscc.begin());
-                    }
-                    
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
+                    for (uint64_t task = 0; task < smallBsccs.size(); ++task) {
+                        solveSmallBscc(task);
                     }
                 }
                 
+                for (auto bsccIndex : largeBsccs) {
+                    computeBsccLra(bsccIndex, computeBsccStationaryDistributionIterative(env, linearEquationSolverFactory, probabilityMatrix, bsccDecomposition[bsccIndex], stateToIndexInBscc));
+                }
+                
+                for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
+                    STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
+                }
+                
                 std::vector<ValueType> rewardSolution;
                 if (!statesNotInBsccs.empty()) {
                     // Calculate LRA for states not in bsccs as expected reachability rewards.
@@ -552,7 +715,7 @@ namespace storm {
                         ValueType reward = zero;
                         for (auto entry : probabilityMatrix.getRow(state)) {
                             if (statesInBsccs.get(entry.getColumn())) {
-                                reward += entry.getValue() * bsccLra[stateToBsccIndexMap[indexInStatesInBsccs[entry.getColumn()]]];
+                                reward += entry.getValue() * bsccLra[stateToBsccIndexMap[entry.getColumn()]];
                             }
                         }
                         rewardRightSide.push_back(reward);
@@ -563,16 +726,8 @@ namespace storm {
                     
                     rewardSolution = std::vector<ValueType>(rewardEquationSystemMatrix.getColumnCount(), one);
                     
-                    {
-                        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
-                        // Check solver requirements
-                        auto requirements = linearEquationSolverFactory.getRequirements(env);
-                        STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
-                        // Check whether we have the right input format for the solver.
-                        STORM_LOG_THROW(linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem, storm::exceptions::FormatUnsupportedBySolverException, "The selected solver does not support the required format.");
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(rewardEquationSystemMatrix));
-                        solver->solveEquations(env, rewardSolution, rewardRightSide);
-                    }
+                    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(rewardEquationSystemMatrix));
+                    solver->solveEquations(env, rewardSolution, rewardRightSide);
                 }
                 
                 // Fill the result vector.
@@ -702,6 +857,61 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values) {
+                std::vector<std::vector<ValueType>> result(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+                
+                // Use Fox-Glynn to get the truncation points and the weights for each time bound.
+                ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults;
+                foxGlynnResults.reserve(timeBounds.size());
+                uint64_t lastIteration = 0;
+                for (auto const& timeBound : timeBounds) {
+                    ValueType lambda = timeBound * uniformizationRate;
+                    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult;
+                    if (storm::utility::isZero(lambda)) {
+                        // If no time can pass, the initial values are the result.
+                        foxGlynnResult.left = 0;
+                        foxGlynnResult.right = 0;
+                        foxGlynnResult.totalWeight = storm::utility::one<ValueType>();
+                        foxGlynnResult.weights.push_back(storm::utility::one<ValueType>());
+                    } else {
+                        foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+                        
+                        // Scale the weights so they add up to one.
+                        for (auto& element : foxGlynnResult.weights) {
+                            element /= foxGlynnResult.totalWeight;
+                        }
+                    }
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBound << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    lastIteration = std::max(lastIteration, foxGlynnResult.right);
+                    foxGlynnResults.push_back(std::move(foxGlynnResult));
+                }
+                
+                STORM_LOG_DEBUG("Starting " << lastIteration << " iterations for " << timeBounds.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                // Perform the matrix-vector multiplications once and add the current vector to the result of each time
+                // bound whose truncation points enclose the current iteration.
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                ValueType weight = storm::utility::zero<ValueType>();
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                for (uint64_t iteration = 0; iteration <= lastIteration; ++iteration) {
+                    if (iteration > 0) {
+                        multiplier->multiply(env, values, addVector, values);
+                    }
+                    
+                    for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                        auto const& foxGlynnResult = foxGlynnResults[index];
+                        if (foxGlynnResult.left <= iteration && iteration <= foxGlynnResult.right) {
+                            weight = foxGlynnResult.weights[iteration - foxGlynnResult.left];
+                            storm::utility::vector::applyPointwise(result[index], values, result[index], addAndScale);
+                        }
+                    }
+                }
+                
+                return result;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -731,7 +941,9 @@ namespace storm {
             }
             
             
-            template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<double>* uniformizationCache);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<double>* uniformizationCache);
             
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
@@ -752,10 +964,15 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values);
 
 #ifdef STORM_HAVE_CARL
-            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
-            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<storm::RationalNumber>* uniformizationCache);
+            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<storm::RationalFunction>* uniformizationCache);
+
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<storm::RationalNumber>* uniformizationCache);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<storm::RationalFunction>* uniformizationCache);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
@@ -3,6 +3,8 @@
 
 #include "storm/storage/BitVector.h"
 
+#include "storm/modelchecker/csl/helper/SparseCtmcUniformizationCache.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolveGoal.h"
 
@@ -19,10 +21,25 @@ namespace storm {
             class SparseCtmcCslHelper {
             public:
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
-                static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+                static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<ValueType>* uniformizationCache = nullptr);
 
                 template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
-                static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+                static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, SparseCtmcUniformizationCache<ValueType>* uniformizationCache = nullptr);
+                
+                /*!
+                 * Computes the probabilities to satisfy phi until psi within [0, t] for each of the given time bounds t.
+                 * All time bounds are handled by a single sweep over the uniformized CTMC.
+                 *
+                 * @param upperBounds The (finite) time bounds. They do not need to be sorted.
+                 * @param uniformizationCache If given, the uniformized matrix is taken from (and stored in) this cache.
+                 * @return The time series of results, i.e. the i-th entry holds the probabilities of all states for the
+                 * i-th time bound.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<ValueType>* uniformizationCache = nullptr);
+                
+                template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, SparseCtmcUniformizationCache<ValueType>* uniformizationCache = nullptr);
                 
                 template <typename ValueType>
                 static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
@@ -86,6 +103,22 @@ namespace storm {
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values);
                 
+                /*!
+                 * Computes the transient probabilities for several time bounds at once. The matrix-vector
+                 * multiplications are shared, i.e. the number of multiplications is determined by the largest time
+                 * bound and the Poisson weights of each time bound are accumulated along the way.
+                 *
+                 * @param uniformizedMatrix The uniformized transition matrix.
+                 * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+                 * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+                 * @param timeBounds The time bounds to use. They do not need to be sorted.
+                 * @param uniformizationRate The used uniformization rate.
+                 * @param values A vector mapping each state to an initial probability.
+                 * @return The vectors of transient probabilities (one for each time bound).
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTransientProbabilitySeries(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values);
+                
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
                  *
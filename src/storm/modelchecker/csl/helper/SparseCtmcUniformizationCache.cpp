@@ -0,0 +1,83 @@
+#include "storm/modelchecker/csl/helper/SparseCtmcUniformizationCache.h"
+
+#include <algorithm>
+
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+            storm::storage::SparseMatrix<ValueType> uniformize(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, ValueType const& uniformizationRate, std::vector<ValueType> const& exitRates) {
+                return SparseCtmcCslHelper::computeUniformizedMatrix(rateMatrix, maybeStates, uniformizationRate, exitRates);
+            }
+            
+            template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+            storm::storage::SparseMatrix<ValueType> uniformize(storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, ValueType const&, std::vector<ValueType> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Uniformization is unsupported for this value type.");
+            }
+            
+            template<typename ValueType>
+            SparseCtmcUniformizationCache<ValueType>::SparseCtmcUniformizationCache(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates, uint64_t capacity) : rateMatrix(rateMatrix), exitRates(exitRates), capacity(std::max<uint64_t>(capacity, 1)), useCounter(0), hits(0), misses(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseCtmcUniformizationCache<ValueType>::getRateMatrix() const {
+                return rateMatrix;
+            }
+            
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseCtmcUniformizationCache<ValueType>::getUniformizedMatrix(storm::storage::BitVector const& maybeStates, ValueType const& uniformizationRate) {
+                auto it = uniformizedMatrices.find(maybeStates);
+                if (it != uniformizedMatrices.end() && it->second.uniformizationRate == uniformizationRate) {
+                    ++hits;
+                    it->second.lastUse = ++useCounter;
+                    return it->second.matrix;
+                }
+                
+                ++misses;
+                // Drop the outdated or least recently used matrix before computing the new one, so it is not kept
+                // meanwhile.
+                if (it != uniformizedMatrices.end()) {
+                    uniformizedMatrices.erase(it);
+                } else if (uniformizedMatrices.size() >= capacity) {
+                    auto leastRecentlyUsedIt = std::min_element(uniformizedMatrices.begin(), uniformizedMatrices.end(), [] (typename std::map<storm::storage::BitVector, Entry>::value_type const& first, typename std::map<storm::storage::BitVector, Entry>::value_type const& second) { return first.second.lastUse < second.second.lastUse; });
+                    uniformizedMatrices.erase(leastRecentlyUsedIt);
+                }
+                
+                Entry entry = {uniformizationRate, uniformize(rateMatrix, maybeStates, uniformizationRate, exitRates), ++useCounter};
+                return uniformizedMatrices.emplace(maybeStates, std::move(entry)).first->second.matrix;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseCtmcUniformizationCache<ValueType>::getNumberOfHits() const {
+                return hits;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseCtmcUniformizationCache<ValueType>::getNumberOfMisses() const {
+                return misses;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseCtmcUniformizationCache<ValueType>::size() const {
+                return uniformizedMatrices.size();
+            }
+            
+            template class SparseCtmcUniformizationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseCtmcUniformizationCache<storm::RationalNumber>;
+            template class SparseCtmcUniformizationCache<storm::RationalFunction>;
+#endif
+        
+        }
+    }
+}
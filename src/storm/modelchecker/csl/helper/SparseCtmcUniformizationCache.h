@@ -0,0 +1,90 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            
+            /*!
+             * Stores the uniformized matrices of a CTMC, so that transient computations that are performed on the same
+             * sub-CTMC (for example for several time bounds of the same until formula) only need to uniformize once.
+             *
+             * The cache is bound to one rate matrix and exit rate vector, which need to outlive the cache. Only a
+             * bounded number of uniformized matrices is kept. If this number is exceeded, the least recently used
+             * matrix is dropped. The cache is not thread-safe.
+             */
+            template<typename ValueType>
+            class SparseCtmcUniformizationCache {
+            public:
+                /*!
+                 * Creates an empty cache for the given CTMC.
+                 *
+                 * @param capacity The maximal number of uniformized matrices that are kept (at least one).
+                 */
+                SparseCtmcUniformizationCache(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates, uint64_t capacity = 4);
+                
+                /*!
+                 * Retrieves the rate matrix the cache is bound to.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getRateMatrix() const;
+                
+                /*!
+                 * Retrieves the matrix representing the transitions of the uniformized CTMC restricted to the given
+                 * states (see SparseCtmcCslHelper::computeUniformizedMatrix). The returned matrix is only guaranteed to
+                 * remain valid until the next call to this method.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getUniformizedMatrix(storm::storage::BitVector const& maybeStates, ValueType const& uniformizationRate);
+                
+                /*!
+                 * Retrieves the number of uniformized matrices that could be taken from the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+                
+                /*!
+                 * Retrieves the number of uniformized matrices that had to be computed.
+                 */
+                uint64_t getNumberOfMisses() const;
+                
+                /*!
+                 * Retrieves the number of uniformized matrices that are currently kept.
+                 */
+                uint64_t size() const;
+            
+            private:
+                // The CTMC the cache is bound to.
+                storm::storage::SparseMatrix<ValueType> const& rateMatrix;
+                std::vector<ValueType> const& exitRates;
+                
+                struct Entry {
+                    // The rate that was used for uniformization.
+                    ValueType uniformizationRate;
+                    
+                    // The uniformized matrix.
+                    storm::storage::SparseMatrix<ValueType> matrix;
+                    
+                    // The time of the most recent use of the matrix.
+                    uint64_t lastUse;
+                };
+                
+                // The maximal number of uniformized matrices that are kept.
+                uint64_t capacity;
+                
+                // The uniformized matrices for each set of states.
+                std::map<storm::storage::BitVector, Entry> uniformizedMatrices;
+                
+                // A counter that is increased with every access and serves as the time of the accesses.
+                uint64_t useCounter;
+                
+                // Statistics about the use of the cache.
+                uint64_t hits;
+                uint64_t misses;
+            };
+        
+        }
+    }
+}
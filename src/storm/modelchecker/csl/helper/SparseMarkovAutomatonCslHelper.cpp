@@ -12,10 +12,12 @@
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/Expression.h"
@@ -633,26 +635,35 @@ namespace storm {
                 // Get some data members for convenience.
                 std::vector<uint64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
                 
-                // Now start with compute the long-run average for all end components in isolation.
-                std::vector<ValueType> lraValuesForEndComponents;
-                
-                // While doing so, we already gather some information for the following steps.
+                // Gather some information for the following steps.
                 std::vector<uint64_t> stateToMecIndexMap(numberOfStates);
                 storm::storage::BitVector statesInMecs(numberOfStates);
                 
                 for (uint64_t currentMecIndex = 0; currentMecIndex < mecDecomposition.size(); ++currentMecIndex) {
                     storm::storage::MaximalEndComponent const& mec = mecDecomposition[currentMecIndex];
-                    
-                    // Gather information for later use.
                     for (auto const& stateChoicesPair : mec) {
                         uint64_t state = stateChoicesPair.first;
                         
                         statesInMecs.set(state);
                         stateToMecIndexMap[state] = currentMecIndex;
                     }
-                    
-                    // Compute the LRA value for the current MEC.
-                    lraValuesForEndComponents.push_back(computeLraForMaximalEndComponent(env, dir, transitionMatrix, exitRateVector, markovianStates, rewardModel, mec));
+                }
+                
+                // Now compute the long-run average for all end components in isolation. As the end components are
+                // independent, they are distributed over a pool of threads if value iteration is used (the LP solvers
+                // and the operations on rational functions are not thread-safe).
+                std::vector<ValueType> lraValuesForEndComponents(mecDecomposition.size(), storm::utility::zero<ValueType>());
+                auto computeLraForMec = [&] (uint64_t mecIndex) {
+                    lraValuesForEndComponents[mecIndex] = computeLraForMaximalEndComponent(env, dir, transitionMatrix, exitRateVector, markovianStates, rewardModel, mecDecomposition[mecIndex]);
+                };
+                uint64_t numberOfThreads = env.modelchecker().getLraNumberOfThreads();
+                bool valueIteration = storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getLraMethod() == storm::solver::LraMethod::ValueIteration;
+                if (std::is_same<ValueType, double>::value && valueIteration && numberOfThreads != 1 && mecDecomposition.size() > 1) {
+                    storm::utility::getThreadPool().execute(mecDecomposition.size(), computeLraForMec, numberOfThreads);
+                } else {
+                    for (uint64_t mecIndex = 0; mecIndex < mecDecomposition.size(); ++mecIndex) {
+                        computeLraForMec(mecIndex);
+                    }
                 }
                 
                 // For fast transition rewriting, we build some auxiliary data structures.
@@ -6,16 +6,44 @@ namespace storm {
     namespace modelchecker {
         namespace exploration_detail {
             
+            // Raises (or lowers) the given value to the new value if that is greater (or less) than the current one.
+            template<typename ValueType>
+            bool increaseAtomically(std::atomic<ValueType>& value, ValueType const& newValue) {
+                ValueType oldValue = value.load(std::memory_order_relaxed);
+                while (oldValue < newValue) {
+                    if (value.compare_exchange_weak(oldValue, newValue, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            
+            template<typename ValueType>
+            bool decreaseAtomically(std::atomic<ValueType>& value, ValueType const& newValue) {
+                ValueType oldValue = value.load(std::memory_order_relaxed);
+                while (newValue < oldValue) {
+                    if (value.compare_exchange_weak(oldValue, newValue, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>::AtomicBounds::AtomicBounds(std::pair<ValueType, ValueType> const& values) : lower(values.first), upper(values.second) {
+                // Intentionally left empty.
+            }
+            
             template<typename StateType, typename ValueType>
             std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
                 ActionType index = explorationInformation.getRowGroup(state);
                 if (index == explorationInformation.getUnexploredMarker()) {
                     return std::make_pair(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                 } else {
-                    return boundsPerState[index];
+                    return std::make_pair(getLowerBoundForRowGroup(index), getUpperBoundForRowGroup(index));
                 }
             }
-                        
+            
             template<typename StateType, typename ValueType>
             ValueType Bounds<StateType, ValueType>::getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
                 ActionType index = explorationInformation.getRowGroup(state);
@@ -27,8 +55,8 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -42,27 +70,27 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            std::pair<ValueType, ValueType> const& Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
-                return boundsPerAction[action];
+            std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+                return std::make_pair(getLowerBoundForAction(action), getUpperBoundForAction(action));
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
                 if (direction == storm::OptimizationDirection::Maximize) {
                     return getUpperBoundForAction(action);
                 } else {
@@ -78,12 +106,12 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::initializeBoundsForNextState(std::pair<ValueType, ValueType> const& vals) {
-                boundsPerState.push_back(vals);
+                boundsPerState.emplace_back(vals);
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::initializeBoundsForNextAction(std::pair<ValueType, ValueType> const& vals) {
-                boundsPerAction.push_back(vals);
+                boundsPerAction.emplace_back(vals);
             }
             
             template<typename StateType, typename ValueType>
@@ -93,7 +121,7 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setLowerBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].first = value;
+                boundsPerState[group].lower.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -103,12 +131,13 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setUpperBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].second = value;
+                boundsPerState[group].upper.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
-                boundsPerAction[action] = values;
+                boundsPerAction[action].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerAction[action].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -119,31 +148,38 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForRowGroup(StateType const& rowGroup, std::pair<ValueType, ValueType> const& values) {
-                boundsPerState[rowGroup] = values;
+                boundsPerState[rowGroup].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerState[rowGroup].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setLowerBoundOfStateIfGreaterThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newLowerValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (boundsPerState[rowGroup].first < newLowerValue) {
-                    boundsPerState[rowGroup].first = newLowerValue;
-                    return true;
-                }
-                return false;
+                return setLowerBoundOfRowGroupIfGreaterThanOld(explorationInformation.getRowGroup(state), newLowerValue);
             }
             
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (newUpperValue < boundsPerState[rowGroup].second) {
-                    boundsPerState[rowGroup].second = newUpperValue;
-                    return true;
-                }
-                return false;
+                return setUpperBoundOfRowGroupIfLessThanOld(explorationInformation.getRowGroup(state), newUpperValue);
             }
             
-            template class Bounds<uint32_t, double>;
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue) {
+                return increaseAtomically(boundsPerState[rowGroup].lower, newLowerValue);
+            }
             
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue) {
+                return decreaseAtomically(boundsPerState[rowGroup].upper, newUpperValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            void Bounds<StateType, ValueType>::tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
+                increaseAtomically(boundsPerAction[action].lower, values.first);
+                decreaseAtomically(boundsPerAction[action].upper, values.second);
+            }
+            
+            template class Bounds<uint32_t, double>;
+        
         }
     }
 }
@@ -1,7 +1,8 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 
-#include <vector>
+#include <atomic>
+#include <deque>
 #include <utility>
 
 #include "storm/solver/OptimizationDirection.h"
@@ -11,10 +12,15 @@
 namespace storm {
     namespace modelchecker {
         namespace exploration_detail {
-         
+            
             template<typename StateType, typename ValueType>
             class ExplorationInformation;
             
+            /*!
+             * Stores the lower and upper bounds of states (or rather their row groups) and actions. The bounds may be
+             * read and tightened concurrently (without locks) by workers that sample paths. Adding new bounds and
+             * overwriting existing bounds (as opposed to tightening them) requires exclusive access.
+             */
             template<typename StateType, typename ValueType>
             class Bounds {
             public:
@@ -24,19 +30,19 @@ namespace storm {
                 
                 ValueType getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getLowerBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getLowerBoundForRowGroup(StateType const& rowGroup) const;
                 
                 ValueType getUpperBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getUpperBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getUpperBoundForRowGroup(StateType const& rowGroup) const;
                 
-                std::pair<ValueType, ValueType> const& getBoundsForAction(ActionType const& action) const;
+                std::pair<ValueType, ValueType> getBoundsForAction(ActionType const& action) const;
                 
-                ValueType const& getLowerBoundForAction(ActionType const& action) const;
+                ValueType getLowerBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getUpperBoundForAction(ActionType const& action) const;
+                ValueType getUpperBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
+                ValueType getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
                 
                 ValueType getDifferenceOfStateBounds(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
@@ -62,11 +68,28 @@ namespace storm {
                 
                 bool setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue);
                 
+                bool setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue);
+                
+                bool setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue);
+                
+                /*!
+                 * Sets the bounds of the action to the given values as far as this tightens the current bounds.
+                 */
+                void tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values);
+            
             private:
-                std::vector<std::pair<ValueType, ValueType>> boundsPerState;
-                std::vector<std::pair<ValueType, ValueType>> boundsPerAction;
+                struct AtomicBounds {
+                    AtomicBounds(std::pair<ValueType, ValueType> const& values);
+                    
+                    std::atomic<ValueType> lower;
+                    std::atomic<ValueType> upper;
+                };
+                
+                // The bounds are stored in deques, because they are never moved when new elements are appended.
+                std::deque<AtomicBounds> boundsPerState;
+                std::deque<AtomicBounds> boundsPerAction;
             };
-            
+        
         }
     }
 }
@@ -160,24 +160,16 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const {
-                bool result = numberExplorationStepsSinceLastPrecomputation > numberOfExplorationStepsUntilPrecomputation;
-                if (result) {
-                    numberExplorationStepsSinceLastPrecomputation = 0;
-                }
-                return result;
+            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveExplorationSteps(std::size_t numberExplorationStepsSinceLastPrecomputation) const {
+                return numberExplorationStepsSinceLastPrecomputation > numberOfExplorationStepsUntilPrecomputation;
             }
             
             template<typename StateType, typename ValueType>
-            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const {
+            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t numberOfSampledPathsSinceLastPrecomputation) const {
                 if (!numberOfSampledPathsUntilPrecomputation) {
                     return false;
                 } else {
-                    bool result = numberOfSampledPathsSinceLastPrecomputation > numberOfSampledPathsUntilPrecomputation.get();
-                    if (result) {
-                        numberOfSampledPathsSinceLastPrecomputation = 0;
-                    }
-                    return result;
+                    return numberOfSampledPathsSinceLastPrecomputation > numberOfSampledPathsUntilPrecomputation.get();
                 }
             }
             
@@ -84,9 +84,9 @@ namespace storm {
                 
                 bool minimize() const;
                 
-                bool performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const;
+                bool performPrecomputationExcessiveExplorationSteps(std::size_t numberExplorationStepsSinceLastPrecomputation) const;
                 
-                bool performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const;
+                bool performPrecomputationExcessiveSampledPaths(std::size_t numberOfSampledPathsSinceLastPrecomputation) const;
                 
                 bool useLocalPrecomputation() const;
                 
@@ -4,6 +4,7 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/Statistics.h"
+#include "storm/modelchecker/exploration/WorkerSynchronization.h"
 
 #include "storm/generator/CompressedState.h"
 
@@ -28,6 +29,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/prism.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -79,16 +81,60 @@ namespace storm {
             // Create a structure that holds the bounds for the states and actions.
             Bounds<StateType, ValueType> bounds;
             
+            // Now perform the actual sampling. The workers share the explored fragment of the system and the bounds,
+            // but each of them uses its own random number generator and keeps its own statistics.
+            uint64_t numberOfWorkers = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads();
+            if (numberOfWorkers != 1) {
+                numberOfWorkers = storm::utility::getNumberOfThreads(numberOfWorkers);
+            }
+            std::vector<Statistics<StateType, ValueType>> workerStats(numberOfWorkers);
+            std::vector<std::default_random_engine> workerRandomGenerators;
+            for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                workerRandomGenerators.emplace_back(randomGenerator());
+            }
+            
+            WorkerSynchronization synchronization;
+            auto sample = [&] (uint64_t worker) {
+                try {
+                    samplePaths(initialStateIndex, stateGeneration, explorationInformation, bounds, workerStats[worker], synchronization, workerRandomGenerators[worker]);
+                } catch (...) {
+                    // Stop the other workers before passing on the exception.
+                    synchronization.setDone();
+                    throw;
+                }
+            };
+            if (numberOfWorkers == 1) {
+                sample(0);
+            } else {
+                STORM_LOG_DEBUG("Sampling paths with " << numberOfWorkers << " workers.");
+                storm::utility::getThreadPool().execute(numberOfWorkers, sample);
+            }
+            
+            Statistics<StateType, ValueType> stats = workerStats.front();
+            for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+                stats.aggregate(workerStats[worker]);
+            }
+            
+            // Show statistics if required.
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                stats.printToStream(std::cout, explorationInformation);
+            }
+            
+            return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::samplePaths(StateType const& initialStateIndex, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, WorkerSynchronization& synchronization, std::default_random_engine& randomGenerator) const {
             // Create a stack that is used to track the path we sampled.
             StateActionStack stack;
             
-            // Now perform the actual sampling.
-            Statistics<StateType, ValueType> stats;
-            bool convergenceCriterionMet = false;
-            while (!convergenceCriterionMet) {
-                bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
+            while (!synchronization.isDone()) {
+                // Sampling a path and updating the bounds along it only requires shared access.
+                std::shared_lock<WorkerSynchronization> sharedLock(synchronization);
+                bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats, sharedLock, randomGenerator);
                 
                 stats.sampledPath();
+                uint64_t sampledPathsSinceLastPrecomputation = synchronization.sampledPath();
                 stats.updateMaxPathLength(stack.size());
                 
                 // If a terminal state was found, we update the probabilities along the path contained in the stack.
@@ -106,45 +152,68 @@ namespace storm {
                 STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", " << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
                 ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
                 STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-                convergenceCriterionMet = comparator.isZero(difference);
+                if (comparator.isZero(difference)) {
+                    synchronization.setDone();
+                }
                 
                 // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-                if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                if (!synchronization.isDone() && explorationInformation.performPrecomputationExcessiveSampledPaths(sampledPathsSinceLastPrecomputation)) {
+                    sharedLock.unlock();
+                    std::unique_lock<WorkerSynchronization> exclusiveLock(synchronization);
+                    
+                    // Another worker may have performed the precomputation in the meantime.
+                    if (explorationInformation.performPrecomputationExcessiveSampledPaths(synchronization.getNumberOfSampledPathsSinceLastPrecomputation())) {
+                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                        synchronization.finishPrecomputation();
+                    }
                 }
             }
-            
-            // Show statistics if required.
-            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                stats.printToStream(std::cout, explorationInformation);
-            }
-            
-            return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
         }
         
         template<typename ModelType, typename StateType>
-        bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+        bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::shared_lock<WorkerSynchronization>& sharedLock, std::default_random_engine& randomGenerator) const {
+            WorkerSynchronization& synchronization = *sharedLock.mutex();
+            
+            // If the explored fragment is changed by a precomputation (of another worker) while the path is sampled,
+            // the actions on the stack may no longer exist, so we need to discard the path.
+            uint64_t version = synchronization.getVersion();
+            
             // Start the search from the initial state.
             stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
             
             // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
             bool foundTerminalState = false;
             while (!foundTerminalState) {
-                StateType const& currentStateId = stack.back().first;
+                StateType currentStateId = stack.back().first;
                 STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
                 
                 // If the state is not yet explored, we need to retrieve its behaviors.
-                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
-                    STORM_LOG_TRACE("State was not yet explored.");
-                    
-                    // Explore the previously unexplored state.
-                    storm::generator::CompressedState const& compressedState = unexploredIt->second;
-                    foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
-                    if (foundTerminalState) {
-                        STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
+                if (explorationInformation.isUnexplored(currentStateId)) {
+                    // Exploring the state changes the explored fragment, which requires exclusive access.
+                    sharedLock.unlock();
+                    {
+                        std::unique_lock<WorkerSynchronization> exclusiveLock(synchronization);
+                        
+                        // Another worker may have explored the state in the meantime.
+                        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                        if (synchronization.getVersion() != version) {
+                            // The path is discarded below.
+                        } else if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                            STORM_LOG_TRACE("State was not yet explored.");
+                            
+                            // Explore the previously unexplored state.
+                            storm::generator::CompressedState const& compressedState = unexploredIt->second;
+                            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+                            if (foundTerminalState) {
+                                STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
+                            }
+                            explorationInformation.removeUnexploredState(unexploredIt);
+                        } else if (explorationInformation.isTerminal(currentStateId)) {
+                            STORM_LOG_TRACE("Found terminal state " << currentStateId << " that was explored by another worker.");
+                            foundTerminalState = true;
+                        }
                     }
-                    explorationInformation.removeUnexploredState(unexploredIt);
+                    sharedLock.lock();
                 } else {
                     // If the state was already explored, we check whether it is a terminal state or not.
                     if (explorationInformation.isTerminal(currentStateId)) {
@@ -155,24 +224,41 @@ namespace storm {
                 
                 // Notify the stats about the performed exploration step.
                 stats.explorationStep();
+                uint64_t explorationStepsSinceLastPrecomputation = synchronization.explorationStep();
+                
+                if (synchronization.getVersion() != version) {
+                    STORM_LOG_TRACE("Aborting the search, because the explored fragment was changed by another worker.");
+                    stack.clear();
+                    return false;
+                }
                 
                 // If the state was not a terminal state, we continue the path search and sample the next state.
                 if (!foundTerminalState) {
                     // At this point, we can be sure that the state was expanded and that we can sample according to the
                     // probabilities in the matrix.
-                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
                     stack.back().second = chosenAction;
                     STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
                     
-                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
                     STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
                     
                     // Put the successor state and a dummy action on top of the stack.
                     stack.emplace_back(successor, 0);
                     
-                    // If the number of exploration steps exceeds a certain threshold, do a precomputation.
-                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
-                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                    // If the number of exploration steps exceeds a certain threshold, do a precomputation. If another
+                    // worker performed it in the meantime, the explored fragment changed as well, so the search is
+                    // aborted in any case.
+                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps(explorationStepsSinceLastPrecomputation)) {
+                        sharedLock.unlock();
+                        {
+                            std::unique_lock<WorkerSynchronization> exclusiveLock(synchronization);
+                            if (explorationInformation.performPrecomputationExcessiveExplorationSteps(synchronization.getNumberOfExplorationStepsSinceLastPrecomputation())) {
+                                performPrecomputation(stack, explorationInformation, bounds, stats);
+                                synchronization.finishPrecomputation();
+                            }
+                        }
+                        sharedLock.lock();
                         
                         STORM_LOG_TRACE("Aborting the search after precomputation.");
                         stack.clear();
@@ -287,7 +373,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& randomGenerator) const {
             // Determine the values of all available actions.
             std::vector<std::pair<ActionType, ValueType>> actionValues;
             StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -325,7 +411,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const {
             std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
             if (row.size() == 1) {
                 return row.front().getColumn();
@@ -494,7 +580,7 @@ namespace storm {
                 if (state == sink) {
                     continue;
                 }
-
+                
                 StateType originalState = relevantStates[state];
                 bounds.setLowerBoundForState(originalState, explorationInformation, storm::utility::one<ValueType>());
                 explorationInformation.addTerminalState(originalState);
@@ -625,8 +711,9 @@ namespace storm {
             // Compute the new lower/upper values of the action.
             std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds);
             
-            // And set them as the current value.
-            bounds.setBoundsForAction(action, newBoundsForAction);
+            // And set them as the current value. As other workers may update the bounds concurrently, we only ever
+            // tighten the bounds (which is sound as all bounds computed along the way are valid).
+            bounds.tightenBoundsForAction(action, newBoundsForAction);
             
             // Check if we need to update the values for the states.
             if (explorationInformation.maximize()) {
@@ -638,7 +725,7 @@ namespace storm {
                         newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
                     }
                     
-                    bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+                    bounds.setUpperBoundOfRowGroupIfLessThanOld(rowGroup, newBoundsForAction.second);
                 }
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
@@ -650,7 +737,7 @@ namespace storm {
                         newBoundsForAction.first = std::min(newBoundsForAction.first, min);
                     }
                     
-                    bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+                    bounds.setLowerBoundOfRowGroupIfGreaterThanOld(rowGroup, newBoundsForAction.first);
                 }
             }
         }
@@ -11,7 +11,7 @@ namespace storm {
             template<typename StateType, typename ValueType>
             class ExplorationInformation;
             
-            // A struct that keeps track of certain statistics during the exploration.
+            // A struct that keeps track of certain statistics during the exploration (of one or more workers).
             template<typename StateType, typename ValueType>
             struct Statistics {
                 Statistics();
@@ -22,12 +22,15 @@ namespace storm {
                 
                 void updateMaxPathLength(std::size_t const& currentPathLength);
                 
+                /*!
+                 * Adds the statistics of another worker to these statistics.
+                 */
+                void aggregate(Statistics const& other);
+                
                 void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
                 std::size_t pathsSampled;
-                std::size_t pathsSampledSinceLastPrecomputation;
                 std::size_t explorationSteps;
-                std::size_t explorationStepsSinceLastPrecomputation;
                 std::size_t maxPathLength;
                 std::size_t numberOfTargetStates;
                 std::size_t numberOfExploredStates;
@@ -35,8 +38,9 @@ namespace storm {
                 std::size_t ecDetections;
                 std::size_t failedEcDetections;
                 std::size_t totalNumberOfEcDetected;
+                std::size_t numberOfWorkers;
             };
-            
+        
         }
     }
 }
@@ -0,0 +1,66 @@
+#include "storm/modelchecker/exploration/WorkerSynchronization.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            WorkerSynchronization::WorkerSynchronization() : version(0), done(false), sampledPathsSinceLastPrecomputation(0), explorationStepsSinceLastPrecomputation(0) {
+                // Intentionally left empty.
+            }
+            
+            void WorkerSynchronization::lock() {
+                // Block new shared accesses at the gate until all current ones are released.
+                std::lock_guard<std::mutex> gateLock(gate);
+                mutex.lock();
+            }
+            
+            void WorkerSynchronization::unlock() {
+                mutex.unlock();
+            }
+            
+            void WorkerSynchronization::lock_shared() {
+                std::lock_guard<std::mutex> gateLock(gate);
+                mutex.lock_shared();
+            }
+            
+            void WorkerSynchronization::unlock_shared() {
+                mutex.unlock_shared();
+            }
+            
+            uint64_t WorkerSynchronization::getVersion() const {
+                return version.load();
+            }
+            
+            void WorkerSynchronization::finishPrecomputation() {
+                ++version;
+                sampledPathsSinceLastPrecomputation.store(0);
+                explorationStepsSinceLastPrecomputation.store(0);
+            }
+            
+            uint64_t WorkerSynchronization::sampledPath() {
+                return ++sampledPathsSinceLastPrecomputation;
+            }
+            
+            uint64_t WorkerSynchronization::explorationStep() {
+                return ++explorationStepsSinceLastPrecomputation;
+            }
+            
+            uint64_t WorkerSynchronization::getNumberOfSampledPathsSinceLastPrecomputation() const {
+                return sampledPathsSinceLastPrecomputation.load();
+            }
+            
+            uint64_t WorkerSynchronization::getNumberOfExplorationStepsSinceLastPrecomputation() const {
+                return explorationStepsSinceLastPrecomputation.load();
+            }
+            
+            bool WorkerSynchronization::isDone() const {
+                return done.load();
+            }
+            
+            void WorkerSynchronization::setDone() {
+                done.store(true);
+            }
+        
+        }
+    }
+}
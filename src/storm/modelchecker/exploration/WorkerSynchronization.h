@@ -0,0 +1,97 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_WORKERSYNCHRONIZATION_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_WORKERSYNCHRONIZATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            /*!
+             * Coordinates the workers that sample paths concurrently. Sampling paths and updating the bounds along
+             * them only requires shared access (the bounds are updated atomically), whereas changing the explored
+             * fragment of the system (exploring states or collapsing MECs during a precomputation) requires exclusive
+             * access. Workers requesting exclusive access take precedence over workers requesting shared access, so
+             * exploration can not be starved by sampling.
+             *
+             * The methods are named such that the object can be used with std::unique_lock and std::shared_lock.
+             */
+            class WorkerSynchronization {
+            public:
+                WorkerSynchronization();
+                
+                void lock();
+                void unlock();
+                void lock_shared();
+                void unlock_shared();
+                
+                /*!
+                 * Retrieves the current version of the explored fragment. It is increased by each precomputation,
+                 * which may change the row groups and actions (e.g. by collapsing MECs), such that paths that were
+                 * sampled in an older version need to be discarded.
+                 */
+                uint64_t getVersion() const;
+                
+                /*!
+                 * Increases the version of the explored fragment and resets the numbers of sampled paths and
+                 * exploration steps since the last precomputation. This is to be called after a precomputation and
+                 * requires exclusive access.
+                 */
+                void finishPrecomputation();
+                
+                /*!
+                 * Counts a sampled path (of any worker) and retrieves the number of paths sampled since the last
+                 * precomputation, including this one.
+                 */
+                uint64_t sampledPath();
+                
+                /*!
+                 * Counts an exploration step (of any worker) and retrieves the number of exploration steps performed
+                 * since the last precomputation, including this one.
+                 */
+                uint64_t explorationStep();
+                
+                /*!
+                 * Retrieves the number of paths sampled (by all workers) since the last precomputation.
+                 */
+                uint64_t getNumberOfSampledPathsSinceLastPrecomputation() const;
+                
+                /*!
+                 * Retrieves the number of exploration steps performed (by all workers) since the last precomputation.
+                 */
+                uint64_t getNumberOfExplorationStepsSinceLastPrecomputation() const;
+                
+                /*!
+                 * Retrieves whether the workers are to stop sampling.
+                 */
+                bool isDone() const;
+                
+                /*!
+                 * Signals the workers to stop sampling.
+                 */
+                void setDone();
+            
+            private:
+                // Ensures that workers requesting shared access wait while some worker requests exclusive access.
+                std::mutex gate;
+                
+                // The mutex protecting the explored fragment.
+                std::shared_timed_mutex mutex;
+                
+                std::atomic<uint64_t> version;
+                std::atomic<bool> done;
+                
+                // The thresholds for precomputations refer to the paths and steps of all workers, so they are counted
+                // jointly.
+                std::atomic<uint64_t> sampledPathsSinceLastPrecomputation;
+                std::atomic<uint64_t> explorationStepsSinceLastPrecomputation;
+            };
+        
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_WORKERSYNCHRONIZATION_H_ */
@@ -60,9 +60,9 @@ namespace storm {
             boost::optional<std::vector<ValueType>> resultHint;
             boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
             
-            bool computeOnlyMaybeStates;
+            bool computeOnlyMaybeStates = false;
             boost::optional<storm::storage::BitVector> maybeStates;
-            bool noEndComponentsInMaybeStates;
+            bool noEndComponentsInMaybeStates = false;
         };
         
     }
@@ -0,0 +1,75 @@
+#include "storm/modelchecker/hints/ResultHintCache.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace modelchecker {
+        
+        template<typename ValueType>
+        ResultHintCache<ValueType>::ResultHintCache(uint64_t capacity) : capacity(capacity), useCounter(0), hits(0), misses(0) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        std::shared_ptr<ExplicitModelCheckerHint<ValueType>> ResultHintCache<ValueType>::getHint(QueryType const& type, boost::optional<storm::OptimizationDirection> const& direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::string const& rewardModelName) {
+            auto entryIt = entries.find(Key(type, direction, phiStates, psiStates, rewardModelName));
+            if (entryIt == entries.end()) {
+                ++misses;
+                return nullptr;
+            }
+            Entry& entry = entryIt->second;
+            entry.lastUse = ++useCounter;
+            
+            auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+            hint->setResultHint(entry.values);
+            if (direction) {
+                hint->setSchedulerHint(entry.scheduler);
+            }
+            ++hits;
+            return hint;
+        }
+        
+        template<typename ValueType>
+        void ResultHintCache<ValueType>::insert(QueryType const& type, boost::optional<storm::OptimizationDirection> const& direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::string const& rewardModelName, std::vector<ValueType> const& values, storm::storage::Scheduler<ValueType> const* scheduler) {
+            if (capacity == 0) {
+                return;
+            }
+            
+            Entry& entry = entries[Key(type, direction, phiStates, psiStates, rewardModelName)];
+            entry.values = values;
+            if (scheduler != nullptr) {
+                entry.scheduler = *scheduler;
+            } else {
+                entry.scheduler = boost::none;
+            }
+            entry.lastUse = ++useCounter;
+            
+            if (entries.size() > capacity) {
+                auto leastRecentlyUsedIt = std::min_element(entries.begin(), entries.end(), [] (typename std::map<Key, Entry>::value_type const& first, typename std::map<Key, Entry>::value_type const& second) { return first.second.lastUse < second.second.lastUse; });
+                entries.erase(leastRecentlyUsedIt);
+            }
+        }
+        
+        template<typename ValueType>
+        uint64_t ResultHintCache<ValueType>::size() const {
+            return entries.size();
+        }
+        
+        template<typename ValueType>
+        uint64_t ResultHintCache<ValueType>::getNumberOfHits() const {
+            return hits;
+        }
+        
+        template<typename ValueType>
+        uint64_t ResultHintCache<ValueType>::getNumberOfMisses() const {
+            return misses;
+        }
+        
+        template class ResultHintCache<double>;
+        template class ResultHintCache<storm::RationalNumber>;
+        template class ResultHintCache<storm::RationalFunction>;
+    
+    }
+}
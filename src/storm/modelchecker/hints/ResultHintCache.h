@@ -0,0 +1,108 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+    namespace modelchecker {
+        
+        /*!
+         * Stores the results of the (unbounded) reachability queries that were checked on a sparse model, so that
+         * they can serve as hints for later queries on the same model. A result is reused for queries of the same
+         * type and optimization direction that refer to the same constraint and target states (and the same reward
+         * model), e.g. when a property is checked with a different bound. The result values are used as initial
+         * values of the solver and the schedulers as initial policies (for policy iteration). Results for the other
+         * optimization direction are not used, as they do not necessarily satisfy the requirements of the solvers
+         * on initial values or policies.
+         *
+         * Only a bounded number of results is kept. If this number is exceeded, the least recently used result is
+         * dropped. Whether a hint is actually applicable is decided by the model checking helpers. The cache is not
+         * thread-safe.
+         */
+        template<typename ValueType>
+        class ResultHintCache {
+        public:
+            enum class QueryType { UntilProbabilities, ReachabilityRewards };
+            
+            /*!
+             * Creates an empty cache.
+             *
+             * @param capacity The maximal number of results that are kept.
+             */
+            ResultHintCache(uint64_t capacity = 16);
+            
+            /*!
+             * Retrieves a hint for the given query that is obtained from the results of earlier compatible queries.
+             *
+             * @param type The type of the query.
+             * @param direction The optimization direction of the query (if any).
+             * @param phiStates The constraint states of the query (empty for reachability rewards).
+             * @param psiStates The target states of the query.
+             * @param rewardModelName The name of the reward model of the query (if any).
+             * @return The hint or nullptr, if there is no compatible result.
+             */
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> getHint(QueryType const& type, boost::optional<storm::OptimizationDirection> const& direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::string const& rewardModelName = "");
+            
+            /*!
+             * Stores the result of the given query.
+             *
+             * @param values The values of all states of the model.
+             * @param scheduler If given, a (deterministic, memoryless) scheduler that achieves the values.
+             */
+            void insert(QueryType const& type, boost::optional<storm::OptimizationDirection> const& direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::string const& rewardModelName, std::vector<ValueType> const& values, storm::storage::Scheduler<ValueType> const* scheduler = nullptr);
+            
+            /*!
+             * Retrieves the number of queries for which a hint could be provided.
+             */
+            uint64_t getNumberOfHits() const;
+            
+            /*!
+             * Retrieves the number of queries for which no hint could be provided.
+             */
+            uint64_t getNumberOfMisses() const;
+        
+            /*!
+             * Retrieves the number of results that are currently kept.
+             */
+            uint64_t size() const;
+        
+        private:
+            typedef std::tuple<QueryType, boost::optional<storm::OptimizationDirection>, storm::storage::BitVector, storm::storage::BitVector, std::string> Key;
+            
+            struct Entry {
+                // The most recent result for the query.
+                std::vector<ValueType> values;
+                
+                // The most recent scheduler for the query (if any).
+                boost::optional<storm::storage::Scheduler<ValueType>> scheduler;
+                
+                // The time of the most recent use of the result.
+                uint64_t lastUse;
+            };
+            
+            // The maximal number of results that are kept.
+            uint64_t capacity;
+            
+            // The stored results.
+            std::map<Key, Entry> entries;
+            
+            // A counter that is increased with every access and serves as the time of the accesses.
+            uint64_t useCounter;
+            
+            // Statistics about the use of the cache.
+            uint64_t hits;
+            uint64_t misses;
+        };
+    
+    }
+}
@@ -75,7 +75,19 @@ namespace storm {
             std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.getHint());
+            
+            // Unless the task provides a hint, we try to obtain one from the results of earlier queries.
+            bool useResultHintCache = resultHintCache && !checkTask.isQualitativeSet() && checkTask.getHint().isEmpty();
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> cachedHint;
+            if (useResultHintCache) {
+                cachedHint = resultHintCache->getHint(ResultHintCache<ValueType>::QueryType::UntilProbabilities, boost::none, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+            }
+            ModelCheckerHint const& hint = cachedHint ? *cachedHint : checkTask.getHint();
+            
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), hint);
+            if (useResultHintCache) {
+                resultHintCache->insert(ResultHintCache<ValueType>::QueryType::UntilProbabilities, boost::none, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), "", numericResult);
+            }
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
@@ -120,7 +132,20 @@ namespace storm {
             storm::logic::EventuallyFormula const& eventuallyFormula = checkTask.getFormula();
             std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
             ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.getHint());
+            
+            // Unless the task provides a hint, we try to obtain one from the results of earlier queries.
+            bool useResultHintCache = resultHintCache && !checkTask.isQualitativeSet() && checkTask.getHint().isEmpty();
+            std::string rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> cachedHint;
+            if (useResultHintCache) {
+                cachedHint = resultHintCache->getHint(ResultHintCache<ValueType>::QueryType::ReachabilityRewards, boost::none, storm::storage::BitVector(), subResult.getTruthValuesVector(), rewardModelName);
+            }
+            ModelCheckerHint const& hint = cachedHint ? *cachedHint : checkTask.getHint();
+            
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getRewardModel(rewardModelName), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), hint);
+            if (useResultHintCache) {
+                resultHintCache->insert(ResultHintCache<ValueType>::QueryType::ReachabilityRewards, boost::none, storm::storage::BitVector(), subResult.getTruthValuesVector(), rewardModelName, numericResult);
+            }
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
 
@@ -169,6 +194,11 @@ namespace storm {
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
+        template<typename SparseDtmcModelType>
+        void SparseDtmcPrctlModelChecker<SparseDtmcModelType>::setResultHintCache(std::shared_ptr<ResultHintCache<ValueType>> const& resultHintCache) {
+            this->resultHintCache = resultHintCache;
+        }
+        
         template class SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>>;
 
 #ifdef STORM_HAVE_CARL
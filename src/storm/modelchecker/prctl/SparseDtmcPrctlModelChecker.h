@@ -6,6 +6,7 @@
 #include "storm/utility/solver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/storage/StronglyConnectedComponent.h"
+#include "storm/modelchecker/hints/ResultHintCache.h"
 
 namespace storm {
     namespace modelchecker {
@@ -32,7 +33,17 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeConditionalRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::ConditionalFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
+            
+            /*!
+             * Sets the cache from which hints for the unbounded reachability queries are taken and in which their
+             * results are stored. This allows later (compatible) queries on the same model to start from the results
+             * of earlier ones.
+             */
+            void setResultHintCache(std::shared_ptr<ResultHintCache<ValueType>> const& resultHintCache);
 
+        private:
+            // The cache for the results of earlier queries (if any).
+            std::shared_ptr<ResultHintCache<ValueType>> resultHintCache;
         };
         
     } // namespace modelchecker
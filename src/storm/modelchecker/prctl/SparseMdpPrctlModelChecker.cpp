@@ -17,11 +17,14 @@
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 
 #include "storm/solver/SolveGoal.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
@@ -35,6 +38,11 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename SparseMdpModelType>
+        SparseMdpPrctlModelChecker<SparseMdpModelType>::SparseMdpPrctlModelChecker(SparseMdpModelType const& model, std::shared_ptr<helper::SparseMdpQualitativeAnalysisCache<ValueType>> const& qualitativeAnalysisCache) : SparsePropositionalModelChecker<SparseMdpModelType>(model), qualitativeAnalysisCache(qualitativeAnalysisCache) {
+            STORM_LOG_THROW(!qualitativeAnalysisCache || &qualitativeAnalysisCache->getTransitionMatrix() == &model.getTransitionMatrix(), storm::exceptions::InvalidArgumentException, "The qualitative analysis cache does not belong to the given model.");
+        }
+        
         template<typename SparseMdpModelType>
         bool SparseMdpPrctlModelChecker<SparseMdpModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
             storm::logic::Formula const& formula = checkTask.getFormula();
@@ -71,7 +79,7 @@ namespace storm {
                 std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
                 ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
                 ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-                std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeStepBoundedUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), pathFormula.getNonStrictUpperBound<uint64_t>(), checkTask.getHint());
+                std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeStepBoundedUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), pathFormula.getNonStrictUpperBound<uint64_t>(), checkTask.getHint());
                 return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
             }
         }
@@ -94,7 +102,21 @@ namespace storm {
             std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(), checkTask.getHint());
+            
+            // Unless the task provides a hint, we try to obtain one from the results of earlier queries. For policy
+            // iteration, we also keep the scheduler, which later queries can use as their initial policy.
+            bool useResultHintCache = resultHintCache && !checkTask.isQualitativeSet() && checkTask.getHint().isEmpty();
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> cachedHint;
+            if (useResultHintCache) {
+                cachedHint = resultHintCache->getHint(ResultHintCache<ValueType>::QueryType::UntilProbabilities, checkTask.getOptimizationDirection(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+            }
+            ModelCheckerHint const& hint = cachedHint ? *cachedHint : checkTask.getHint();
+            bool produceScheduler = checkTask.isProduceSchedulersSet() || (useResultHintCache && env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::PolicyIteration);
+            
+            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), produceScheduler, hint, qualitativeAnalysisCache.get());
+            if (useResultHintCache) {
+                resultHintCache->insert(ResultHintCache<ValueType>::QueryType::UntilProbabilities, checkTask.getOptimizationDirection(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), "", ret.values, ret.scheduler.get());
+            }
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
             if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
                 result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
@@ -108,7 +130,7 @@ namespace storm {
             STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
             std::unique_ptr<CheckResult> subResultPointer = this->check(env, pathFormula.getSubformula());
             ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet());
+            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), false, qualitativeAnalysisCache.get());
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret)));
         }
         
@@ -125,7 +147,7 @@ namespace storm {
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
 
-            return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+            return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
         }
         
         template<typename SparseMdpModelType>
@@ -165,7 +187,22 @@ namespace storm {
             STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
             std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
             ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(), checkTask.getHint());
+            
+            // Unless the task provides a hint, we try to obtain one from the results of earlier queries. For policy
+            // iteration, we also keep the scheduler, which later queries can use as their initial policy.
+            bool useResultHintCache = resultHintCache && !checkTask.isQualitativeSet() && checkTask.getHint().isEmpty();
+            std::string rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> cachedHint;
+            if (useResultHintCache) {
+                cachedHint = resultHintCache->getHint(ResultHintCache<ValueType>::QueryType::ReachabilityRewards, checkTask.getOptimizationDirection(), storm::storage::BitVector(), subResult.getTruthValuesVector(), rewardModelName);
+            }
+            ModelCheckerHint const& hint = cachedHint ? *cachedHint : checkTask.getHint();
+            bool produceScheduler = checkTask.isProduceSchedulersSet() || (useResultHintCache && env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::PolicyIteration);
+            
+            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), this->getModel().getRewardModel(rewardModelName), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), produceScheduler, hint, qualitativeAnalysisCache.get());
+            if (useResultHintCache) {
+                resultHintCache->insert(ResultHintCache<ValueType>::QueryType::ReachabilityRewards, checkTask.getOptimizationDirection(), storm::storage::BitVector(), subResult.getTruthValuesVector(), rewardModelName, ret.values, ret.scheduler.get());
+            }
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
             if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
                 result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
@@ -179,17 +216,38 @@ namespace storm {
 			STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
 			std::unique_ptr<CheckResult> subResultPointer = this->check(env, stateFormula);
 			ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(),  subResult.getTruthValuesVector());
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(),  subResult.getTruthValuesVector(), qualitativeAnalysisCache.get());
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 		}
         
         template<typename SparseMdpModelType>
         std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::computeLongRunAverageRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) {
             STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
-            std::vector<ValueType> result = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getUniqueRewardModel());
+            std::vector<ValueType> result = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getUniqueRewardModel(), qualitativeAnalysisCache.get());
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
         }
         
+        template<typename SparseMdpModelType>
+        std::shared_ptr<helper::SparseMdpQualitativeAnalysisCache<typename SparseMdpPrctlModelChecker<SparseMdpModelType>::ValueType>> const& SparseMdpPrctlModelChecker<SparseMdpModelType>::getQualitativeAnalysisCache() const {
+            return qualitativeAnalysisCache;
+        }
+        
+        template<typename SparseMdpModelType>
+        storm::storage::SparseMatrix<typename SparseMdpPrctlModelChecker<SparseMdpModelType>::ValueType> const& SparseMdpPrctlModelChecker<SparseMdpModelType>::getBackwardTransitions() {
+            if (qualitativeAnalysisCache) {
+                return qualitativeAnalysisCache->getBackwardTransitions();
+            }
+            if (!backwardTransitions) {
+                backwardTransitions = this->getModel().getBackwardTransitions();
+            }
+            return backwardTransitions.get();
+        }
+        
+        template<typename SparseMdpModelType>
+        void SparseMdpPrctlModelChecker<SparseMdpModelType>::setResultHintCache(std::shared_ptr<ResultHintCache<ValueType>> const& resultHintCache) {
+            this->resultHintCache = resultHintCache;
+        }
+        
         template<typename SparseMdpModelType>
         std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) {
             return multiobjective::performMultiObjectiveModelChecking(env, this->getModel(), checkTask.getFormula());
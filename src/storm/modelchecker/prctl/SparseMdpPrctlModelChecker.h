@@ -4,6 +4,8 @@
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpQualitativeAnalysisCache.h"
+#include "storm/modelchecker/hints/ResultHintCache.h"
 
 namespace storm {
     
@@ -18,6 +20,14 @@ namespace storm {
             
             explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model);
             
+            /*!
+             * Creates a model checker that stores the results of its graph analyses in the given cache. This allows
+             * several model checkers (e.g. for a batch of properties) to share these results. The cache needs to be
+             * created for the transition matrix of the given model. If no cache is given, the graph analyses are
+             * performed without a cache, just like for a model checker that was created without one.
+             */
+            SparseMdpPrctlModelChecker(SparseMdpModelType const& model, std::shared_ptr<helper::SparseMdpQualitativeAnalysisCache<ValueType>> const& qualitativeAnalysisCache);
+            
             // The implemented methods of the AbstractModelChecker interface.
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
             virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
@@ -32,6 +42,34 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
             
+            /*!
+             * Retrieves the cache holding the results of the graph analyses performed by this model checker. This is
+             * null unless a cache was passed to the constructor.
+             */
+            std::shared_ptr<helper::SparseMdpQualitativeAnalysisCache<ValueType>> const& getQualitativeAnalysisCache() const;
+            
+            /*!
+             * Sets the cache from which hints for the unbounded reachability queries are taken and in which their
+             * results are stored. This allows later (compatible) queries on the same model to start from the results
+             * of earlier ones.
+             */
+            void setResultHintCache(std::shared_ptr<ResultHintCache<ValueType>> const& resultHintCache);
+            
+        private:
+            /*!
+             * Retrieves the backward transitions of the model, either from the cache or (if there is none) from the
+             * model. In the latter case, they are computed upon the first call and kept from then on.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+            
+            // The cache for the results of graph analyses (prob0/prob1 state sets, backward transitions, MECs), if any.
+            std::shared_ptr<helper::SparseMdpQualitativeAnalysisCache<ValueType>> qualitativeAnalysisCache;
+            
+            // The backward transitions of the model if there is no cache (once they were computed).
+            boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+            
+            // The cache for the results of earlier queries (if any).
+            std::shared_ptr<ResultHintCache<ValueType>> resultHintCache;
         };
     } // namespace modelchecker
 } // namespace storm
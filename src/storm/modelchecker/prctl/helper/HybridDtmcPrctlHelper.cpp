@@ -9,6 +9,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/DdTranslationCache.h"
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
@@ -51,7 +52,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = maybeStates.createOdd();
+                        storm::dd::Odd odd = model.getTranslationCache().getOdd(maybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -89,14 +90,16 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-                        std::vector<ValueType> b = subvector.toVector(odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getTranslationCache().getMatrix(submatrix, maybeStates);
+                        std::shared_ptr<std::vector<ValueType> const> b = model.getTranslationCache().getVector(subvector, maybeStates);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                         
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        // The solver takes ownership of the matrix, unless the translation cache keeps it. In that case, the
+                        // solver shares it with the cache.
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::dd::isSharedTranslation(explicitSubmatrix) ? linearEquationSolverFactory.create(env, *explicitSubmatrix) : linearEquationSolverFactory.create(env, storm::dd::takeTranslation(std::move(explicitSubmatrix)));
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
-                        solver->solveEquations(env, x, b);
+                        solver->solveEquations(env, x, *b);
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
                         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -134,7 +137,7 @@ namespace storm {
                     
                     // Create the ODD for the translation between symbolic and explicit storage.
                     conversionWatch.start();
-                    storm::dd::Odd odd = maybeStates.createOdd();
+                    storm::dd::Odd odd = model.getTranslationCache().getOdd(maybeStates);
                     conversionWatch.stop();
                     
                     // Create the matrix and the vector for the equation system.
@@ -157,13 +160,13 @@ namespace storm {
                     
                     // Translate the symbolic matrix/vector to their explicit representations.
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-                    std::vector<ValueType> b = subvector.toVector(odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getTranslationCache().getMatrix(submatrix, maybeStates);
+                    std::shared_ptr<std::vector<ValueType> const> b = model.getTranslationCache().getVector(subvector, maybeStates);
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
-                    multiplier->repeatedMultiply(env, x, &b, stepBound);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitSubmatrix);
+                    multiplier->repeatedMultiply(env, x, b.get(), stepBound);
 
                     // Return a hybrid check result that stores the numerical values explicitly.
                     return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, psiStates.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -180,18 +183,18 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
                 
                 // Create the solution vector (and initialize it to the state rewards of the model).
-                std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
+                std::vector<ValueType> x = *model.getTranslationCache().getVector(rewardModel.getStateRewardVector(), model.getReachableStates());
                 
                 // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getTranslationCache().getMatrix(transitionMatrix, model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiply(env, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -212,17 +215,17 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
-                std::vector<ValueType> b = totalRewardVector.toVector(odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getTranslationCache().getMatrix(transitionMatrix, model.getReachableStates());
+                std::shared_ptr<std::vector<ValueType> const> b = model.getTranslationCache().getVector(totalRewardVector, model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-                multiplier->repeatedMultiply(env, x, &b, stepBound);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
+                multiplier->repeatedMultiply(env, x, b.get(), stepBound);
                 
                 // Return a hybrid check result that stores the numerical values explicitly.
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, x));
@@ -266,7 +269,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = maybeStates.createOdd();
+                        storm::dd::Odd odd = model.getTranslationCache().getOdd(maybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -309,8 +312,8 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-                        std::vector<ValueType> b = subvector.toVector(odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getTranslationCache().getMatrix(submatrix, maybeStates);
+                        std::shared_ptr<std::vector<ValueType> const> b = model.getTranslationCache().getVector(subvector, maybeStates);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -319,16 +322,17 @@ namespace storm {
                         if (oneStepTargetProbs) {
                             // FIXME: This will fail if we already converted the matrix to the equation problem format.
                             STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
-                            upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
+                            upperBounds = computeUpperRewardBounds(*explicitSubmatrix, *b, oneStepTargetProbs->toVector(odd));
                         }
                         
                         // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        // The solver takes ownership of the matrix, unless the translation cache keeps it (see above).
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::dd::isSharedTranslation(explicitSubmatrix) ? linearEquationSolverFactory.create(env, *explicitSubmatrix) : linearEquationSolverFactory.create(env, storm::dd::takeTranslation(std::move(explicitSubmatrix)));
                         solver->setLowerBound(storm::utility::zero<ValueType>());
                         if (upperBounds) {
                             solver->setUpperBounds(std::move(upperBounds.get()));
                         }
-                        solver->solveEquations(env, x, b);
+                        solver->solveEquations(env, x, *b);
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
                         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>()), maybeStates, odd, x));
@@ -342,12 +346,12 @@ namespace storm {
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeLongRunAverageProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& targetStates) {
                 // Create ODD for the translation.
                 storm::utility::Stopwatch conversionWatch(true);
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = model.getTransitionMatrix().toMatrix(odd, odd);
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getTranslationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, targetStates.toVector(odd));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, targetStates.toVector(odd));
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
 
@@ -355,12 +359,12 @@ namespace storm {
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeLongRunAverageRewards(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, RewardModelType const& rewardModel) {
                 // Create ODD for the translation.
                 storm::utility::Stopwatch conversionWatch(true);
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = model.getTransitionMatrix().toMatrix(odd, odd);
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getTranslationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, rewardModel.getTotalRewardVector(model.getTransitionMatrix(), model.getColumnVariables()).toVector(odd));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, rewardModel.getTotalRewardVector(model.getTransitionMatrix(), model.getColumnVariables()).toVector(odd));
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
             
@@ -6,6 +6,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/DdTranslationCache.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/utility/graph.h"
@@ -180,7 +181,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = extendedMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getTranslationCache().getOdd(extendedMaybeStates);
                         conversionWatch.stop();
                         
                         // Convert the maybe states BDD to an ADD.
@@ -198,7 +199,7 @@ namespace storm {
 
                             // Only translate the matrix for now.
                             conversionWatch.start();
-                            explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                            explicitRepresentation.first = storm::dd::takeTranslation(model.getTranslationCache().getMatrix(submatrix, model.getNondeterminismVariables(), extendedMaybeStates));
                             
                             // Get all original maybe states in the extended matrix.
                             solverRequirementsData.properMaybeStates = maybeStates.toVector(odd);
@@ -225,7 +226,7 @@ namespace storm {
                             
                             // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                             conversionWatch.start();
-                            explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                            explicitRepresentation = storm::dd::takeTranslation(model.getTranslationCache().getMatrixVector(submatrix, subvector, model.getNondeterminismVariables(), extendedMaybeStates));
                             conversionWatch.stop();
 
                             if (requirements.validInitialScheduler()) {
@@ -259,7 +260,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD containing only the propery maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getTranslationCache().getOdd(maybeStates);
                         }
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -302,7 +303,7 @@ namespace storm {
                     
                     // Create the ODD for the translation between symbolic and explicit storage.
                     conversionWatch.start();
-                    storm::dd::Odd odd = maybeStates.createOdd();
+                    storm::dd::Odd odd = model.getTranslationCache().getOdd(maybeStates);
                     conversionWatch.stop();
                     
                     // Create the matrix and the vector for the equation system.
@@ -325,12 +326,12 @@ namespace storm {
                     
                     // Translate the symbolic matrix/vector to their explicit representations.
                     conversionWatch.start();
-                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                    std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> explicitRepresentation = model.getTranslationCache().getMatrixVector(submatrix, subvector, model.getNondeterminismVariables(), maybeStates);
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
-                    multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation->first);
+                    multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation->second, stepBound);
                     
                     // Return a hybrid check result that stores the numerical values explicitly.
                     return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, psiStates.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -347,18 +348,18 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch;
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getTranslationCache().getMatrix(transitionMatrix, model.getNondeterminismVariables(), model.getReachableStates());
                 
                 // Create the solution vector (and initialize it to the state rewards of the model).
-                std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
+                std::vector<ValueType> x = *model.getTranslationCache().getVector(rewardModel.getStateRewardVector(), model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiplyAndReduce(env, dir, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -379,16 +380,16 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getTranslationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
-                std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
+                std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> explicitRepresentation = model.getTranslationCache().getMatrixVector(transitionMatrix, totalRewardVector, model.getNondeterminismVariables(), model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
-                    multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation->first);
+                    multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation->second, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, x));
@@ -576,7 +577,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = requiredMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getTranslationCache().getOdd(requiredMaybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -665,7 +666,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD that only contains proper maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getTranslationCache().getOdd(maybeStates);
                         }
 
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -0,0 +1,139 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpQualitativeAnalysisCache.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            
+            template<typename ValueType>
+            SparseMdpQualitativeAnalysisCache<ValueType>::SparseMdpQualitativeAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t capacity) : transitionMatrix(transitionMatrix), capacity(std::max<uint64_t>(capacity, 1)), useCounter(0), hits(0), misses(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseMdpQualitativeAnalysisCache<ValueType>::getTransitionMatrix() const {
+                return transitionMatrix;
+            }
+            
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseMdpQualitativeAnalysisCache<ValueType>::getBackwardTransitions() {
+                if (!backwardTransitions) {
+                    backwardTransitions = transitionMatrix.transpose(true);
+                }
+                return backwardTransitions.get();
+            }
+            
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> const& SparseMdpQualitativeAnalysisCache<ValueType>::getProb01(Environment const& env, bool minimize, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                StateSetsKey key(minimize, phiStates, psiStates);
+                if (auto cachedResult = find(prob01, key)) {
+                    return *cachedResult;
+                }
+                
+                storm::storage::SparseMatrix<ValueType> const& backward = getBackwardTransitions();
+                ++misses;
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+                if (minimize) {
+                    result = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward, phiStates, psiStates, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                } else {
+                    result = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward, phiStates, psiStates, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                }
+                return insert(prob01, std::move(key), std::move(result));
+            }
+            
+            template<typename ValueType>
+            storm::storage::BitVector const& SparseMdpQualitativeAnalysisCache<ValueType>::getProb0E(Environment const& env, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> key(phiStates, psiStates);
+                if (auto cachedResult = find(prob0E, key)) {
+                    return *cachedResult;
+                }
+                
+                storm::storage::SparseMatrix<ValueType> const& backward = getBackwardTransitions();
+                ++misses;
+                storm::storage::BitVector result = storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward, phiStates, psiStates, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                return insert(prob0E, std::move(key), std::move(result));
+            }
+            
+            template<typename ValueType>
+            storm::storage::BitVector const& SparseMdpQualitativeAnalysisCache<ValueType>::getProb1(Environment const& env, bool existential, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                StateSetsKey key(existential, phiStates, psiStates);
+                if (auto cachedResult = find(prob1, key)) {
+                    return *cachedResult;
+                }
+                
+                storm::storage::SparseMatrix<ValueType> const& backward = getBackwardTransitions();
+                ++misses;
+                storm::storage::BitVector result;
+                if (existential) {
+                    result = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward, phiStates, psiStates, boost::none, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                } else {
+                    result = storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward, phiStates, psiStates, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                }
+                return insert(prob1, std::move(key), std::move(result));
+            }
+            
+            template<typename ValueType>
+            storm::storage::MaximalEndComponentDecomposition<ValueType> const& SparseMdpQualitativeAnalysisCache<ValueType>::getMaximalEndComponentDecomposition(Environment const& env, storm::storage::BitVector const& subsystem) {
+                if (auto cachedResult = find(endComponentDecompositions, subsystem)) {
+                    return **cachedResult;
+                }
+                
+                storm::storage::SparseMatrix<ValueType> const& backward = getBackwardTransitions();
+                ++misses;
+                auto decomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, backward, subsystem, storm::utility::graph::getNumberOfGraphAnalysisThreads<ValueType>(env));
+                return *insert(endComponentDecompositions, storm::storage::BitVector(subsystem), std::move(decomposition));
+            }
+            
+            template<typename ValueType>
+            template<typename KeyType, typename ResultType>
+            ResultType* SparseMdpQualitativeAnalysisCache<ValueType>::find(std::map<KeyType, Entry<ResultType>>& results, KeyType const& key) {
+                auto it = results.find(key);
+                if (it == results.end()) {
+                    return nullptr;
+                }
+                ++hits;
+                it->second.lastUse = ++useCounter;
+                return &it->second.result;
+            }
+            
+            template<typename ValueType>
+            template<typename KeyType, typename ResultType>
+            ResultType& SparseMdpQualitativeAnalysisCache<ValueType>::insert(std::map<KeyType, Entry<ResultType>>& results, KeyType&& key, ResultType&& result) {
+                if (results.size() >= capacity) {
+                    auto leastRecentlyUsedIt = std::min_element(results.begin(), results.end(), [] (typename std::map<KeyType, Entry<ResultType>>::value_type const& first, typename std::map<KeyType, Entry<ResultType>>::value_type const& second) { return first.second.lastUse < second.second.lastUse; });
+                    results.erase(leastRecentlyUsedIt);
+                }
+                Entry<ResultType> entry = {std::move(result), ++useCounter};
+                return results.emplace(std::move(key), std::move(entry)).first->second.result;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseMdpQualitativeAnalysisCache<ValueType>::getNumberOfHits() const {
+                return hits;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseMdpQualitativeAnalysisCache<ValueType>::getNumberOfMisses() const {
+                return misses;
+            }
+            
+            template<typename ValueType>
+            uint64_t SparseMdpQualitativeAnalysisCache<ValueType>::size() const {
+                return prob01.size() + prob0E.size() + prob1.size() + endComponentDecompositions.size();
+            }
+            
+            template class SparseMdpQualitativeAnalysisCache<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseMdpQualitativeAnalysisCache<storm::RationalNumber>;
+            template class SparseMdpQualitativeAnalysisCache<storm::RationalFunction>;
+#endif
+        
+        }
+    }
+}
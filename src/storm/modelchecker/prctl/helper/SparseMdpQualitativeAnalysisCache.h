@@ -0,0 +1,148 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+
+namespace storm {
+    class Environment;
+    
+    namespace modelchecker {
+        namespace helper {
+            
+            /*!
+             * Stores the results of the graph analyses that are performed when checking properties on an MDP, so that
+             * they can be reused by subsequent properties on the same MDP. As properties frequently share their target
+             * (and constraint) states, this avoids repeating the computation of the backward transitions, the
+             * qualitative state sets and the end component decompositions for every property.
+             *
+             * The cache is bound to one transition matrix, which needs to outlive the cache. The cache owns the results
+             * it keeps. Only a bounded number of results of each kind is kept. If this number is exceeded, the least
+             * recently used result of that kind is dropped. Hence, a reference returned by one of the retrieving methods
+             * is only guaranteed to remain valid until the next call to a method retrieving a result of the same kind,
+             * and callers that need the result for longer have to copy it. The results that are missing are computed
+             * with the number of graph analysis threads of the environment passed to the retrieving method. The cache
+             * is not thread-safe.
+             *
+             * Model checkers only use such a cache if one is passed to them. The command line interface creates one per
+             * model if --modelchecker:qualitativecache is set.
+             */
+            template<typename ValueType>
+            class SparseMdpQualitativeAnalysisCache {
+            public:
+                /*!
+                 * Creates an empty cache for the given transition matrix.
+                 *
+                 * @param capacity The maximal number of results of each kind that are kept (at least one).
+                 */
+                SparseMdpQualitativeAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t capacity = 16);
+                
+                /*!
+                 * Retrieves the transition matrix the cache is bound to.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
+                
+                /*!
+                 * Retrieves the backward transitions of the transition matrix.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+                
+                /*!
+                 * Retrieves the states that have minimal (or maximal) probability 0 and 1, respectively, to satisfy
+                 * phi until psi.
+                 *
+                 * @param minimize If set, the states for minimal probabilities are retrieved.
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getProb01(Environment const& env, bool minimize, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                
+                /*!
+                 * Retrieves the states for which there exists a scheduler that reaches psi with probability 0 while
+                 * staying in phi.
+                 */
+                storm::storage::BitVector const& getProb0E(Environment const& env, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                
+                /*!
+                 * Retrieves the states that reach psi with probability 1 while staying in phi under some (if
+                 * existential is set) or all schedulers.
+                 */
+                storm::storage::BitVector const& getProb1(Environment const& env, bool existential, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                
+                /*!
+                 * Retrieves the maximal end component decomposition of the sub-MDP induced by the given states.
+                 */
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& getMaximalEndComponentDecomposition(Environment const& env, storm::storage::BitVector const& subsystem);
+                
+                /*!
+                 * Retrieves the number of qualitative analyses and decompositions that could be taken from the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+                
+                /*!
+                 * Retrieves the number of qualitative analyses and decompositions that had to be computed.
+                 */
+                uint64_t getNumberOfMisses() const;
+                
+                /*!
+                 * Retrieves the number of qualitative analyses and decompositions that are currently kept.
+                 */
+                uint64_t size() const;
+            
+            private:
+                typedef std::tuple<bool, storm::storage::BitVector, storm::storage::BitVector> StateSetsKey;
+                
+                template<typename ResultType>
+                struct Entry {
+                    // The cached result.
+                    ResultType result;
+                    
+                    // The time of the most recent use of the result.
+                    uint64_t lastUse;
+                };
+                
+                /*!
+                 * Looks up the result for the given key and marks it as used.
+                 *
+                 * @return The result or nullptr, if it is not in the cache.
+                 */
+                template<typename KeyType, typename ResultType>
+                ResultType* find(std::map<KeyType, Entry<ResultType>>& results, KeyType const& key);
+                
+                /*!
+                 * Stores the result for the given key, dropping the least recently used result (of this kind) if the
+                 * capacity is exceeded.
+                 */
+                template<typename KeyType, typename ResultType>
+                ResultType& insert(std::map<KeyType, Entry<ResultType>>& results, KeyType&& key, ResultType&& result);
+                
+                // The transition matrix the cache is bound to.
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+                
+                // The backward transitions (once they were computed).
+                boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+                
+                // The maximal number of results of each kind that are kept.
+                uint64_t capacity;
+                
+                // The cached results of the qualitative analyses.
+                std::map<StateSetsKey, Entry<std::pair<storm::storage::BitVector, storm::storage::BitVector>>> prob01;
+                std::map<std::pair<storm::storage::BitVector, storm::storage::BitVector>, Entry<storm::storage::BitVector>> prob0E;
+                std::map<StateSetsKey, Entry<storm::storage::BitVector>> prob1;
+                std::map<storm::storage::BitVector, Entry<std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>>>> endComponentDecompositions;
+                
+                // A counter that is increased with every access and serves as the time of the accesses.
+                uint64_t useCounter;
+                
+                // Statistics about the use of the cache.
+                uint64_t hits;
+                uint64_t misses;
+            };
+        
+        }
+    }
+}
@@ -13,6 +13,10 @@
 
 #include "storm/adapters/AddExpressionAdapter.h"
 
+#include "storm/storage/dd/DdTranslationCache.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/utility/macros.h"
@@ -24,6 +28,15 @@
 namespace storm {
     namespace models {
         namespace symbolic {
+            
+            namespace {
+                template<storm::dd::DdType Type, typename ValueType>
+                std::shared_ptr<storm::dd::DdTranslationCache<Type, ValueType>> createTranslationCache() {
+                    auto const& settings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+                    return std::make_shared<storm::dd::DdTranslationCache<Type, ValueType>>(settings.getTranslationCacheCapacity(), settings.getTranslationCacheMemoryLimit());
+                }
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             Model<Type, ValueType>::Model(storm::models::ModelType const& modelType,
                                           std::shared_ptr<storm::dd::DdManager<Type>> manager,
@@ -37,7 +50,7 @@ namespace storm {
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
                                           std::map<std::string, storm::expressions::Expression> labelToExpressionMap,
                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels) {
+            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels), translationCache(createTranslationCache<Type, ValueType>()) {
                 this->labelToBddMap.emplace("init", initialStates);
                 this->labelToBddMap.emplace("deadlock", deadlockStates);
             }
@@ -54,7 +67,7 @@ namespace storm {
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
                                           std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(nullptr), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToBddMap(labelToBddMap), rewardModels(rewardModels) {
+            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(nullptr), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToBddMap(labelToBddMap), rewardModels(rewardModels), translationCache(createTranslationCache<Type, ValueType>()) {
                 STORM_LOG_THROW(this->labelToBddMap.find("init") == this->labelToBddMap.end(), storm::exceptions::WrongFormatException, "Illegal custom label 'init'.");
                 STORM_LOG_THROW(this->labelToBddMap.find("deadlock") == this->labelToBddMap.end(), storm::exceptions::WrongFormatException, "Illegal custom label 'deadlock'.");
                 this->labelToBddMap.emplace("init", initialStates);
@@ -373,6 +386,11 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This value type does not support parameters.");
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::DdTranslationCache<Type, ValueType>& Model<Type, ValueType>::getTranslationCache() const {
+                return *translationCache;
+            }
+            
             template<>
             void Model<storm::dd::DdType::Sylvan, storm::RationalFunction>::addParameters(std::set<storm::RationalFunctionVariable> const& parameters) {
                 this->parameters.insert(parameters.begin(), parameters.end());
@@ -26,6 +26,9 @@ namespace storm {
         template<storm::dd::DdType Type>
         class DdManager;
         
+        template<storm::dd::DdType Type, typename ValueType>
+        class DdTranslationCache;
+        
     }
     
     namespace adapters {
@@ -327,6 +330,15 @@ namespace storm {
                 
                 std::set<storm::RationalFunctionVariable> const& getParameters() const;
                 
+                /*!
+                 * Retrieves the cache for translations of DDs of this model to explicit data structures. The cache is
+                 * shared by all copies of the model, so that engines working on the model can reuse translations across
+                 * properties.
+                 *
+                 * @return The translation cache.
+                 */
+                storm::dd::DdTranslationCache<Type, ValueType>& getTranslationCache() const;
+                
                 template<typename NewValueType>
                 typename std::enable_if<!std::is_same<ValueType, NewValueType>::value, std::shared_ptr<Model<Type, NewValueType>>>::type toValueType() const;
                 
@@ -431,6 +443,9 @@ namespace storm {
                 
                 // An empty variable set that can be used when references to non-existing sets need to be returned.
                 std::set<storm::expressions::Variable> emptyVariableSet;
+                
+                // The cache for translations of DDs to explicit data structures.
+                std::shared_ptr<storm::dd::DdTranslationCache<Type, ValueType>> translationCache;
             };
             
         } // namespace symbolic
@@ -0,0 +1,200 @@
+#include "storm/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "storm/parser/MappedFile.h"
+#include "storm/storage/sparse/BinaryModelFormat.h"
+#include "storm/storage/sparse/ModelComponents.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace parser {
+        
+        namespace {
+            /*!
+             * Reads the sections of the binary model format from the mapped file and checks that they do not exceed
+             * the file.
+             */
+            class BinaryReader {
+            public:
+                BinaryReader(MappedFile const& file, std::string const& filename) : current(file.getData()), end(file.getDataEnd()), filename(filename) {
+                    // Intentionally left empty.
+                }
+                
+                /*!
+                 * Retrieves a pointer to the given number of bytes at the current position and skips them (including
+                 * the padding).
+                 */
+                char const* readBytes(uint64_t numberOfBytes) {
+                    uint64_t paddedNumberOfBytes = numberOfBytes + (8 - numberOfBytes % 8) % 8;
+                    STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= paddedNumberOfBytes, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": unexpected end of file.");
+                    char const* result = current;
+                    current += paddedNumberOfBytes;
+                    return result;
+                }
+                
+                uint64_t readWord() {
+                    uint64_t result;
+                    std::memcpy(&result, readBytes(sizeof(uint64_t)), sizeof(uint64_t));
+                    return result;
+                }
+                
+                /*!
+                 * Retrieves a pointer to an array with the given number of elements. As all sections are aligned,
+                 * the array can be accessed directly in the mapped file.
+                 */
+                template<typename T>
+                T const* readArray(uint64_t numberOfElements) {
+                    STORM_LOG_THROW(numberOfElements <= static_cast<uint64_t>(end - current) / sizeof(T), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": unexpected end of file.");
+                    return reinterpret_cast<T const*>(readBytes(numberOfElements * sizeof(T)));
+                }
+                
+                template<typename T>
+                std::vector<T> readVector(uint64_t numberOfElements) {
+                    T const* data = readArray<T>(numberOfElements);
+                    return std::vector<T>(data, data + numberOfElements);
+                }
+                
+                std::string readName() {
+                    uint64_t length = readWord();
+                    STORM_LOG_THROW(length <= static_cast<uint64_t>(end - current), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": unexpected end of file.");
+                    return std::string(readBytes(length), length);
+                }
+                
+                storm::storage::BitVector readBits(uint64_t numberOfBits) {
+                    uint64_t const* words = readArray<uint64_t>((numberOfBits + 63) / 64);
+                    storm::storage::BitVector result(numberOfBits);
+                    for (uint64_t word = 0; word * 64 < numberOfBits; ++word) {
+                        result.setFromInt(word * 64, std::min<uint64_t>(64, numberOfBits - word * 64), words[word]);
+                    }
+                    return result;
+                }
+                
+                template<typename ValueType>
+                storm::storage::SparseMatrix<ValueType> readMatrix(uint64_t numberOfRows, uint64_t numberOfColumns, boost::optional<uint64_t> const& numberOfRowGroups) {
+                    typedef storm::storage::MatrixEntry<uint_fast64_t, ValueType> EntryType;
+                    static_assert(sizeof(EntryType) == sizeof(uint64_t) + sizeof(ValueType), "Unexpected layout of matrix entries.");
+                    
+                    // The number of indices is one larger than the number of rows (or row groups), so these must not be
+                    // the largest representable numbers.
+                    STORM_LOG_THROW(numberOfRows < std::numeric_limits<uint64_t>::max() && (!numberOfRowGroups || numberOfRowGroups.get() < std::numeric_limits<uint64_t>::max()), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": invalid dimensions.");
+                    uint64_t numberOfEntries = readWord();
+                    std::vector<uint_fast64_t> rowIndications = readVector<uint_fast64_t>(numberOfRows + 1);
+                    STORM_LOG_THROW(isValidPartition(rowIndications, numberOfEntries), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": inconsistent row indications.");
+                    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+                    if (numberOfRowGroups) {
+                        rowGroupIndices = readVector<uint_fast64_t>(numberOfRowGroups.get() + 1);
+                        STORM_LOG_THROW(isValidPartition(rowGroupIndices.get(), numberOfRows), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": inconsistent row groups.");
+                    }
+                    
+                    // The entries are stored in the layout of the matrix, so they are copied in one go.
+                    std::vector<EntryType> columnsAndValues = readVector<EntryType>(numberOfEntries);
+                    for (auto const& entry : columnsAndValues) {
+                        STORM_LOG_THROW(entry.getColumn() < numberOfColumns, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": column index out of range.");
+                    }
+                    
+                    return storm::storage::SparseMatrix<ValueType>(numberOfColumns, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+                }
+            
+            private:
+                /*!
+                 * Retrieves whether the given indices start at zero, end at the given number and never decrease, i.e.
+                 * whether they partition [0, end) into consecutive (possibly empty) ranges.
+                 */
+                static bool isValidPartition(std::vector<uint_fast64_t> const& indices, uint64_t end) {
+                    return !indices.empty() && indices.front() == 0 && indices.back() == end && std::is_sorted(indices.begin(), indices.end());
+                }
+                
+                char const* current;
+                char const* end;
+                std::string const& filename;
+            };
+        }
+        
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryModelParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            static_assert(std::is_same<ValueType, double>::value, "The binary model format only supports double values.");
+            static_assert(sizeof(uint_fast64_t) == sizeof(uint64_t), "Unexpected size of indices.");
+            namespace binary = storm::storage::sparse::binary;
+            
+            MappedFile file(filename.c_str());
+            BinaryReader reader(file, filename);
+            
+            binary::Header header;
+            std::memcpy(&header, reader.readBytes(sizeof(header)), sizeof(header));
+            STORM_LOG_THROW(std::memcmp(header.magic, binary::magic, sizeof(header.magic)) == 0, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": the file is not a binary model.");
+            STORM_LOG_THROW(header.byteOrderMark == binary::byteOrderMark, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": the file was written on a machine with different byte order.");
+            STORM_LOG_THROW(header.version == binary::version, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": version " << header.version << " of the format is not supported (expected version " << binary::version << ").");
+            STORM_LOG_THROW(header.valueSize == sizeof(ValueType), storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": unexpected size of values.");
+            
+            storm::models::ModelType type;
+            switch (static_cast<binary::ModelTypeCode>(header.modelType)) {
+                case binary::ModelTypeCode::Dtmc: type = storm::models::ModelType::Dtmc; break;
+                case binary::ModelTypeCode::Ctmc: type = storm::models::ModelType::Ctmc; break;
+                case binary::ModelTypeCode::Mdp: type = storm::models::ModelType::Mdp; break;
+                case binary::ModelTypeCode::MarkovAutomaton: type = storm::models::ModelType::MarkovAutomaton; break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": unknown model type.");
+            }
+            bool nondeterministic = (header.flags & binary::nondeterministicFlag) != 0;
+            boost::optional<uint64_t> numberOfRowGroups;
+            if (nondeterministic) {
+                numberOfRowGroups = header.numberOfStates;
+            } else {
+                STORM_LOG_THROW(header.numberOfStates == header.numberOfChoices, storm::exceptions::WrongFormatException, "Error while loading binary model from " << filename << ": the number of choices of a deterministic model must match the number of states.");
+            }
+            
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(reader.readMatrix<ValueType>(header.numberOfChoices, header.numberOfStates, numberOfRowGroups));
+            
+            components.stateLabeling = storm::models::sparse::StateLabeling(header.numberOfStates);
+            for (uint64_t label = 0; label < header.numberOfStateLabels; ++label) {
+                std::string name = reader.readName();
+                components.stateLabeling.addLabel(name, reader.readBits(header.numberOfStates));
+            }
+            if (header.flags & binary::choiceLabelingFlag) {
+                components.choiceLabeling = storm::models::sparse::ChoiceLabeling(header.numberOfChoices);
+                for (uint64_t label = 0; label < header.numberOfChoiceLabels; ++label) {
+                    std::string name = reader.readName();
+                    components.choiceLabeling.get().addLabel(name, reader.readBits(header.numberOfChoices));
+                }
+            }
+            if (header.flags & binary::exitRatesFlag) {
+                components.exitRates = reader.readVector<ValueType>(header.numberOfStates);
+            }
+            if (header.flags & binary::markovianStatesFlag) {
+                components.markovianStates = reader.readBits(header.numberOfStates);
+            }
+            // The matrix of CTMCs contains the rates.
+            components.rateTransitions = type == storm::models::ModelType::Ctmc;
+            
+            for (uint64_t rewardModel = 0; rewardModel < header.numberOfRewardModels; ++rewardModel) {
+                std::string name = reader.readName();
+                uint64_t rewardFlags = reader.readWord();
+                boost::optional<std::vector<ValueType>> stateRewards;
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+                if (rewardFlags & binary::stateRewardsFlag) {
+                    stateRewards = reader.readVector<ValueType>(header.numberOfStates);
+                }
+                if (rewardFlags & binary::stateActionRewardsFlag) {
+                    stateActionRewards = reader.readVector<ValueType>(header.numberOfChoices);
+                }
+                if (rewardFlags & binary::transitionRewardsFlag) {
+                    transitionRewards = reader.readMatrix<ValueType>(header.numberOfChoices, header.numberOfStates, numberOfRowGroups);
+                }
+                components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+            }
+            
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+        
+        template class BinaryModelParser<double>;
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,34 @@
+#ifndef STORM_PARSER_BINARYMODELPARSER_H_
+#define STORM_PARSER_BINARYMODELPARSER_H_
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+        
+        /*!
+         *	Loader for models in the binary model format (see storm/storage/sparse/BinaryModelFormat.h). The file is
+         *	memory-mapped and the components of the model are copied from the mapped arrays without any parsing.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryModelParser {
+        public:
+            
+            /*!
+             * Load a model in the binary format from a file and create the model.
+             *
+             * @param filename The file to be loaded.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+        };
+    
+    } // namespace parser
+} // namespace storm
+
+#endif /* STORM_PARSER_BINARYMODELPARSER_H_ */
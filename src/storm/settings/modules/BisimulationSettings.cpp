@@ -22,6 +22,9 @@ namespace storm {
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+            const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
+            const std::string BisimulationSettings::sparseThreadsOptionName = "sparsethreads";
+            const std::string BisimulationSettings::quotientThreadsOptionName = "quotthreads";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -49,11 +52,25 @@ namespace storm {
                                              .setDefaultValueString("finer").build())
                                 .build());
                 
-                std::vector<std::string> refinementModes = {"full", "changed"};
+                std::vector<std::string> refinementModes = {"full", "changed", "incremental"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true, "Sets which refinement mode to use.")
-                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use. 'incremental' only recomputes the parts of the signatures that belong to blocks that were split.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true, "Sets how the partition is refined in sparse bisimulation.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use. 'signature' splits all blocks at once in every round and can use multiple threads.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                             .setDefaultValueString("splitter").build())
+                                .build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseThreadsOptionName, true, "Sets the number of threads used by the signature-based refinement in sparse bisimulation.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 uses all hardware threads).").setDefaultValueUnsignedInteger(1).build())
+                                .build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, quotientThreadsOptionName, true, "Sets the number of threads used to build sparse quotients in symbolic bisimulation.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 uses all hardware threads).").setDefaultValueUnsignedInteger(1).build())
+                                .build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -126,10 +143,30 @@ namespace storm {
                     return RefinementMode::Full;
                 } else if (refinementModeAsString == "changed") {
                     return RefinementMode::ChangedStates;
+                } else if (refinementModeAsString == "incremental") {
+                    return RefinementMode::Incremental;
                 }
                 return RefinementMode::Full;
             }
 
+            storm::storage::bisimulation::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+                std::string modeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+                if (modeAsString == "splitter") {
+                    return storm::storage::bisimulation::SparseRefinementMode::Splitter;
+                } else if (modeAsString == "signature") {
+                    return storm::storage::bisimulation::SparseRefinementMode::Signature;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unknown sparse refinement mode '" << modeAsString << "'.");
+            }
+            
+            uint64_t BisimulationSettings::getSparseNumberOfThreads() const {
+                return this->getOption(sparseThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t BisimulationSettings::getQuotientNumberOfThreads() const {
+                return this->getOption(quotientThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
+#include "storm/storage/bisimulation/SparseRefinementMode.h"
 
 namespace storm {
     namespace settings {
@@ -23,7 +24,7 @@ namespace storm {
                 
                 enum class InitialPartitionMode { Regular, Finer };
                 
-                enum class RefinementMode { Full, ChangedStates };
+                enum class RefinementMode { Full, ChangedStates, Incremental };
                 
                 /*!
                  * Creates a new set of bisimulation settings.
@@ -89,6 +90,26 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves the mode in which the partition is refined by the sparse bisimulation.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                storm::storage::bisimulation::SparseRefinementMode getSparseRefinementMode() const;
+                
+                /*!
+                 * Retrieves the number of threads used by the signature-based sparse bisimulation (zero means that all
+                 * hardware threads are used).
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                uint64_t getSparseNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the number of threads used to build sparse quotients (zero means that all hardware threads
+                 * are used).
+                 * NOTE: only applies to symbolic bisimulation.
+                 */
+                uint64_t getQuotientNumberOfThreads() const;
                                 
                 virtual bool check() const override;
                 
@@ -106,6 +127,9 @@ namespace storm {
                 static const std::string initialPartitionOptionName;
                 static const std::string refinementModeOptionName;
                 static const std::string parallelismModeOptionName;
+                static const std::string sparseRefinementModeOptionName;
+                static const std::string sparseThreadsOptionName;
+                static const std::string quotientThreadsOptionName;
                 static const std::string exactArithmeticDdOptionName;
             };
         } // namespace modules
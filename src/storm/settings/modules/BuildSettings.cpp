@@ -21,6 +21,9 @@ namespace storm {
             const std::string jitOptionName = "jit";
             const std::string explorationOrderOptionName = "explorder";
             const std::string explorationOrderOptionShortName = "eo";
+            const std::string explorationThreadsOptionName = "explthreads";
+            const std::string outOfCoreOptionName = "outofcore";
+            const std::string outOfCoreMemoryOptionName = "outofcorememory";
             const std::string explorationChecksOptionName = "explchecks";
             const std::string explorationChecksOptionShortName = "ec";
             const std::string prismCompatibilityOptionName = "prismcompat";
@@ -29,6 +32,8 @@ namespace storm {
             const std::string fullModelBuildOptionName = "buildfull";
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
+            const std::string ddVariableOrderOptionName = "ddorder";
+            const std::string ddSiftingOptionName = "ddsift";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -41,7 +46,15 @@ namespace storm {
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName)
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false, "Sets the number of threads that explore the state space. Multiple threads are only used for breadth-first exploration.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreOptionName, false, "If set, the explicit model builder writes states and transitions to disk if they exceed the memory limit. This disables parallel exploration.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which the temporary files are created.").setDefaultValueString(".").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreMemoryOptionName, false, "Sets the amount of memory that the states and the transitions may occupy before they are written to disk.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false, "If set, the symbolic model builders order the DD variables according to the dependencies between the model variables rather than in declaration order.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddSiftingOptionName, false, "If set, the symbolic model builders improve the order of the DD variables by sifting after building the model. With CUDD, the DDs are reordered in place; otherwise, the model is rebuilt if the transition matrix gets at least 5% smaller.").build());
 
             }
 
@@ -85,9 +98,33 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
 
+            uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+                return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isOutOfCoreSet() const {
+                return this->getOption(outOfCoreOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getOutOfCoreDirectory() const {
+                return this->getOption(outOfCoreOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            uint64_t BuildSettings::getOutOfCoreMemoryLimit() const {
+                return this->getOption(outOfCoreMemoryOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+            }
+
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
+
+            bool BuildSettings::isDdVariableOrderSet() const {
+                return this->getOption(ddVariableOrderOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isDdSiftingSet() const {
+                return this->getOption(ddSiftingOptionName).getHasOptionBeenSet();
+            }
         }
 
 
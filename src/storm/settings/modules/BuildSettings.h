@@ -44,6 +44,35 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves the number of threads that are used to explore the state space.
+                 *
+                 * @return The number of threads (zero means the number of hardware threads).
+                 */
+                uint64_t getNumberOfExplorationThreads() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to write states and transitions to disk if they
+                 * exceed the memory limit.
+                 *
+                 * @return True iff the out-of-core mode was enabled.
+                 */
+                bool isOutOfCoreSet() const;
+
+                /*!
+                 * Retrieves the directory in which the out-of-core mode creates its temporary files.
+                 *
+                 * @return The directory.
+                 */
+                std::string getOutOfCoreDirectory() const;
+
+                /*!
+                 * Retrieves the amount of memory that the states and transitions may occupy in the out-of-core mode.
+                 *
+                 * @return The memory limit in megabytes.
+                 */
+                uint64_t getOutOfCoreMemoryLimit() const;
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
@@ -75,6 +104,21 @@ namespace storm {
                  */
                 bool isBuildStateValuationsSet() const;
 
+                /*!
+                 * Retrieves whether the symbolic model builders are to order the DD variables according to the
+                 * dependencies between the model variables.
+                 *
+                 * @return True iff the dependency-based variable order is to be used.
+                 */
+                bool isDdVariableOrderSet() const;
+
+                /*!
+                 * Retrieves whether the symbolic model builders are to improve the variable order by sifting.
+                 *
+                 * @return True iff the variable order is to be sifted.
+                 */
+                bool isDdSiftingSet() const;
+
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -72,6 +72,13 @@ namespace storm {
                  */
                 NextStateHeuristic getNextStateHeuristic() const;
                 
+                /*!
+                 * Retrieves the number of threads that sample paths concurrently.
+                 *
+                 * @return The number of threads (zero means the number of hardware threads).
+                 */
+                uint64_t getNumberOfThreads() const;
+                
                 /*!
                  * Retrieves the precision to use for numerical operations.
                  *
@@ -91,6 +98,7 @@ namespace storm {
                 static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
                 static const std::string nextStateHeuristicOptionName;
                 static const std::string precisionOptionName;
+                static const std::string numberOfThreadsOptionName;
                 static const std::string precisionOptionShortName;
             };
         } // namespace modules
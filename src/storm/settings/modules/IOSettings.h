@@ -63,6 +63,20 @@ namespace storm {
                  */
                 std::string getExportExplicitFilename() const;
                 
+                /*!
+                 * Retrieves whether the export-to-binary option was set
+                 *
+                 * @return True if the export-to-binary option was set
+                 */
+                bool isExportBinarySet() const;
+                
+                /*!
+                 * Retrieves the name of the file in which to write the model in the binary format, if the option was set.
+                 *
+                 * @return The name of the file in which to write the exported model.
+                 */
+                std::string getExportBinaryFilename() const;
+                
                 /*!
                  * Retrieves whether the cumulative density function for reward bounded properties should be exported
                  */
@@ -110,6 +124,20 @@ namespace storm {
                  */
                 std::string getExplicitDRNFilename() const;
                 
+                /*!
+                 * Retrieves whether the explicit option with the binary format was set.
+                 *
+                 * @return True if the explicit option with the binary format was set.
+                 */
+                bool isExplicitBinarySet() const;
+                
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the binary file that contains the model.
+                 */
+                std::string getExplicitBinaryFilename() const;
+                
                 /*!
                  * Retrieves whether the explicit option with IMCA was set.
                  *
@@ -270,12 +298,15 @@ namespace storm {
                 static const std::string exportDotOptionName;
                 static const std::string exportJaniDotOptionName;
                 static const std::string exportExplicitOptionName;
+                static const std::string exportBinaryOptionName;
                 static const std::string exportCdfOptionName;
                 static const std::string exportCdfOptionShortName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
+                static const std::string explicitBinaryOptionShortName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
                 static const std::string prismInputOptionName;
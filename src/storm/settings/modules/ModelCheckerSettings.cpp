@@ -14,15 +14,63 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::lraThreadsOptionName = "lra-threads";
+            const std::string ModelCheckerSettings::lraDirectThresholdOptionName = "lra-directthreshold";
+            const std::string ModelCheckerSettings::graphThreadsOptionName = "graph-threads";
+            const std::string ModelCheckerSettings::warmStartOptionName = "warmstart";
+            const std::string ModelCheckerSettings::warmStartCapacityOptionName = "warmstart-results";
+            const std::string ModelCheckerSettings::qualitativeCacheOptionName = "qualitativecache";
+            const std::string ModelCheckerSettings::translationCacheOptionName = "translationcache";
+            const std::string ModelCheckerSettings::translationCacheMemoryOptionName = "translationcache-memory";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, lraThreadsOptionName, true, "Sets the number of threads that compute the long-run averages of independent bottom SCCs or end components (0 means the number of hardware threads).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, lraDirectThresholdOptionName, true, "Sets the maximal size of a bottom SCC whose stationary distribution is computed with a dense direct solver.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of states.").setDefaultValueUnsignedInteger(64).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, graphThreadsOptionName, true, "Sets the number of threads used by the qualitative analyses (e.g. prob0/prob1) and the maximal end component decomposition of sparse models (1 means sequential, 0 means the number of hardware threads).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, warmStartOptionName, false, "If set, the results of earlier properties on the same (sparse) model are used as hints for later compatible properties.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, warmStartCapacityOptionName, true, "Sets how many results of earlier properties are kept as hints per model. The least recently used results are dropped first.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of results.").setDefaultValueUnsignedInteger(16).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, qualitativeCacheOptionName, true, "Sets how many results of each graph analysis (prob0/prob1 state sets and maximal end component decompositions) are kept per sparse MDP and shared among its properties (0 disables the cache).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of results.").setDefaultValueUnsignedInteger(0).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, translationCacheOptionName, true, "Sets how many translations of each kind (ODDs, explicit matrices and vectors) the hybrid engine keeps per symbolic model (0 disables the cache). The cache keeps the DDs it translated alive.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of translations.").setDefaultValueUnsignedInteger(0).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, translationCacheMemoryOptionName, true, "Sets the maximal amount of memory occupied by the translations the hybrid engine keeps per symbolic model (including an estimate for the DDs they were translated from). The least recently used translations are evicted first.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The amount of memory in megabytes.").setDefaultValueUnsignedInteger(1024).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
             
+            uint64_t ModelCheckerSettings::getLraNumberOfThreads() const {
+                return this->getOption(lraThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getLraDirectSolverThreshold() const {
+                return this->getOption(lraDirectThresholdOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getGraphAnalysisNumberOfThreads() const {
+                return this->getOption(graphThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool ModelCheckerSettings::isWarmStartSet() const {
+                return this->getOption(warmStartOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t ModelCheckerSettings::getWarmStartCapacity() const {
+                return this->getOption(warmStartCapacityOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getQualitativeAnalysisCacheCapacity() const {
+                return this->getOption(qualitativeCacheOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getTranslationCacheCapacity() const {
+                return this->getOption(translationCacheOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getTranslationCacheMemoryLimit() const {
+                return this->getOption(translationCacheMemoryOptionName).getArgumentByName("mb").getValueAsUnsignedInteger() * 1024 * 1024;
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -21,6 +21,63 @@ namespace storm {
                 ModelCheckerSettings();
                 
                 bool isFilterRewZeroSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that are used to compute the long-run average values of the
+                 * bottom SCCs (or maximal end components) in parallel.
+                 *
+                 * @return The number of threads (zero means the number of hardware threads).
+                 */
+                uint64_t getLraNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the maximal number of states of a bottom SCC whose stationary distribution is computed
+                 * with a dense direct solver (instead of the configured linear equation solver).
+                 */
+                uint64_t getLraDirectSolverThreshold() const;
+                
+                /*!
+                 * Retrieves the number of threads that are used by the qualitative analyses and the maximal end
+                 * component decomposition of sparse models.
+                 *
+                 * @return The number of threads (one means sequential, zero means the number of hardware threads).
+                 */
+                uint64_t getGraphAnalysisNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves whether the results of earlier properties are to be used as hints (initial values and
+                 * policies) for later compatible properties on the same sparse model.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isWarmStartSet() const;
+                
+                /*!
+                 * Retrieves the number of results of earlier properties that are kept as hints per sparse model.
+                 */
+                uint64_t getWarmStartCapacity() const;
+                
+                /*!
+                 * Retrieves the number of results of each graph analysis (e.g. prob0/prob1 state sets) that are kept
+                 * per sparse MDP, so that they can be reused by later properties.
+                 *
+                 * @return The number of results (zero, the default, disables the cache).
+                 */
+                uint64_t getQualitativeAnalysisCacheCapacity() const;
+                
+                /*!
+                 * Retrieves the number of translations of each kind (e.g. ODDs or explicit matrices) that the hybrid
+                 * engine keeps per symbolic model, so that they can be reused by later properties.
+                 *
+                 * @return The number of translations (zero, the default, disables the cache).
+                 */
+                uint64_t getTranslationCacheCapacity() const;
+                
+                /*!
+                 * Retrieves the maximal number of bytes that the explicit data structures kept by the translation cache
+                 * of a symbolic model (and the DDs they were translated from) may occupy.
+                 */
+                uint64_t getTranslationCacheMemoryLimit() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -28,6 +85,14 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string lraThreadsOptionName;
+                static const std::string lraDirectThresholdOptionName;
+                static const std::string graphThreadsOptionName;
+                static const std::string warmStartOptionName;
+                static const std::string warmStartCapacityOptionName;
+                static const std::string qualitativeCacheOptionName;
+                static const std::string translationCacheOptionName;
+                static const std::string translationCacheMemoryOptionName;
             };
 
         } // namespace modules
@@ -6,6 +6,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace settings {
@@ -13,12 +14,22 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::compactLayoutOptionName = "compact";
+            const std::string MultiplierSettings::threadCountOptionName = "threads";
+            const std::string MultiplierSettings::vectorInstructionSetOptionName = "simd";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> multiplierTypes = {"native", "inplace", "gmmxx"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactLayoutOptionName, true, "If set, the native multiplier stores the matrix with 32 bit column indices and separate column/value arrays whenever the number of columns admits it.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by the native multiplier.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(1).build()).build());
+                
+                std::vector<std::string> instructionSets = {"none", "auto", "avx2", "avx512"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, vectorInstructionSetOptionName, true, "Sets the vector instructions with which the native multiplier multiplies matrices with double values. By default, the best instruction set supported by the CPU is used. Any instruction set other than 'none' implies the compact layout and may change the results in the last bits, as the products of a row are summed up in a different order.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the instruction set ('auto' selects the best one supported by the CPU).").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(instructionSets)).setDefaultValueString("auto").build()).build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -35,6 +46,32 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isCompactLayoutSet() const {
+                return this->getOption(compactLayoutOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t MultiplierSettings::getNumberOfThreads() const {
+                return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
+            storm::storage::kernels::VectorInstructionSet MultiplierSettings::getVectorInstructionSet() const {
+                std::string name = this->getOption(vectorInstructionSetOptionName).getArgumentByName("name").getValueAsString();
+                storm::storage::kernels::VectorInstructionSet result = storm::storage::kernels::VectorInstructionSet::Scalar;
+                if (name == "none") {
+                    return storm::storage::kernels::VectorInstructionSet::Scalar;
+                } else if (name == "auto") {
+                    return storm::storage::kernels::getVectorInstructionSet();
+                } else if (name == "avx2") {
+                    result = storm::storage::kernels::VectorInstructionSet::Avx2;
+                } else if (name == "avx512") {
+                    result = storm::storage::kernels::VectorInstructionSet::Avx512;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown instruction set '" << name << "'.");
+                }
+                STORM_LOG_THROW(storm::storage::kernels::isSupported(result), storm::exceptions::NotSupportedException, "The instruction set '" << name << "' is not supported by this CPU.");
+                return result;
+            }
         }
     }
 }
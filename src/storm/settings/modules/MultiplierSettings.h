@@ -5,6 +5,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
 
 namespace storm {
     namespace settings {
@@ -22,11 +23,37 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether the native multiplier is to use the compact layout with 32 bit column indices
+                 * (whenever the matrix dimensions admit it).
+                 *
+                 * @return True iff the compact layout is to be used.
+                 */
+                bool isCompactLayoutSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that the native multiplier is to use.
+                 *
+                 * @return The number of threads (zero means that the number of hardware threads is used).
+                 */
+                uint64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the vector instruction set with which the native multiplier is to multiply matrices with
+                 * double values. Any instruction set other than the scalar one implies the compact layout.
+                 *
+                 * @return The instruction set (scalar if no vectorized kernels are to be used).
+                 */
+                storm::storage::kernels::VectorInstructionSet getVectorInstructionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string compactLayoutOptionName;
+                static const std::string threadCountOptionName;
+                static const std::string vectorInstructionSetOptionName;
             };
             
         }
@@ -61,6 +61,20 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves the number of threads that solve independent SCCs concurrently.
+                 *
+                 * @return The number of threads (zero means the number of hardware threads).
+                 */
+                uint64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the number of states up to which SCCs are solved together as one parallel task.
+                 *
+                 * @return The batch size.
+                 */
+                uint64_t getSccBatchSize() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +84,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string threadsOptionName;
+                static const std::string sccBatchSizeOptionName;
             };
             
         } // namespace modules
@@ -7,6 +7,8 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/solver/helper/OptimisticValueIterationHelper.h"
+
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
 
@@ -49,7 +51,7 @@ namespace storm {
                 } else {
                     STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
                 }
-            } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
+            } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::OptimisticValueIteration && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
                 if (env.solver().minMax().isMethodSetFromDefault()) {
                     STORM_LOG_INFO("Selecting 'sound value iteration' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
                     method = MinMaxMethod::SoundValueIteration;
@@ -57,7 +59,7 @@ namespace storm {
                     STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
                 }
             }
-            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
+            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::IntervalIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
             return method;
         }
         
@@ -80,6 +82,9 @@ namespace storm {
                 case MinMaxMethod::SoundValueIteration:
                     result = solveEquationsSoundValueIteration(env, dir, x, b);
                     break;
+                case MinMaxMethod::OptimisticValueIteration:
+                    result = solveEquationsOptimisticValueIteration(env, dir, x, b);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
             }
@@ -265,6 +270,13 @@ namespace storm {
                     requirements.requireNoEndComponents();
                 }
                 requirements.requireBounds(false);
+            } else if (method == MinMaxMethod::OptimisticValueIteration) {
+                // Optimistic value iteration approaches the solution from below. Verifying the guessed upper bounds
+                // requires a unique solution, but no a priori upper bounds.
+                if (!this->hasUniqueSolution()) {
+                    requirements.requireNoEndComponents();
+                }
+                requirements.requireLowerBounds();
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unsupported technique for iterative MinMax linear equation solver.");
             }
@@ -666,6 +678,58 @@ namespace storm {
             return status == SolverStatus::Converged;
         }
         
+        /*!
+         * This version of value iteration is sound, because it verifies that the values obtained by standard value
+         * iteration (from below) plus the precision are an upper bound of the solution. This technique is due to
+         * Hartmanns and Kaminski (Optimistic Value Iteration, CAV 2020).
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            if (!auxiliaryRowGroupVector) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            }
+            if (!auxiliaryRowGroupVector2) {
+                auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            }
+            
+            // The iterations start from the lower bound.
+            this->createLowerBoundsVector(x);
+            
+            storm::solver::Multiplier<ValueType> const& multiplier = *this->multiplierA;
+            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper([&env, &multiplier, &dir, &b] (std::vector<ValueType> const& currentX, std::vector<ValueType>& newX) { multiplier.multiplyAndReduce(env, dir, currentX, &b, newX); }, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getMaximalNumberOfIterations());
+            if (this->hasUpperBound()) {
+                helper.setUpperBound(this->getUpperBound(true));
+            }
+            if (this->hasRelevantValues()) {
+                helper.setRelevantValues(&this->getRelevantValues());
+            }
+            if (this->hasCustomTerminationCondition()) {
+                helper.setTerminationCondition(&this->getTerminationCondition());
+            }
+            
+            this->startMeasureProgress();
+            SolverStatus status = helper.solve(x, *auxiliaryRowGroupVector, *auxiliaryRowGroupVector2);
+            this->showProgressIterative(helper.getNumberOfIterations());
+            reportStatus(status, helper.getNumberOfIterations());
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->multiplierA->multiplyAndReduce(env, dir, x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -21,6 +21,16 @@ namespace storm {
         Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
             // Intentionally left empty.
         }
+        
+        template<typename ValueType>
+        Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType>&& matrix) : ownedMatrix(std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix))), matrix(*ownedMatrix) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        Multiplier<ValueType>::~Multiplier() {
+            // Intentionally left empty.
+        }
     
         template<typename ValueType>
         void Multiplier<ValueType>::clearCache() const {
@@ -67,6 +77,16 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) {
+            switch (env.solver().multiplier().getType()) {
+                case MultiplierType::Gmmxx:
+                    return std::make_unique<GmmxxMultiplier<ValueType>>(std::move(matrix));
+                case MultiplierType::Native:
+                    return std::make_unique<NativeMultiplier<ValueType>>(env, std::move(matrix));
+            }
+        }
+        
         template class Multiplier<double>;
         template class MultiplierFactory<double>;
         
@@ -23,7 +23,12 @@ namespace storm {
             
             Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
             
-            virtual ~Multiplier() = default;
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix.
+             */
+            Multiplier(storm::storage::SparseMatrix<ValueType>&& matrix);
+            
+            virtual ~Multiplier();
             
             /*
              * Clears the currently cached data of this multiplier in order to free some memory.
@@ -134,6 +139,10 @@ namespace storm {
             
         protected:
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
+            
+            // The matrix if it is owned by this multiplier. It is declared before the reference to the matrix, because
+            // the reference is bound to it.
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> ownedMatrix;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
         
@@ -145,6 +154,12 @@ namespace storm {
 
             std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix);
             
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix. Multipliers that use a different
+             * representation of the matrix can then release the storage of the original one.
+             */
+            std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix);
+            
             
         };
         
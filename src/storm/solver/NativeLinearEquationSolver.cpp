@@ -10,6 +10,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -623,6 +624,50 @@ namespace storm {
             return converged;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (OptimisticValueIteration)");
+            
+            // Prepare the solution vectors.
+            if (!this->cachedRowVector) {
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            if (!this->cachedRowVector2) {
+                this->cachedRowVector2 = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            // The iterations start from the lower bound.
+            this->createLowerBoundsVector(x);
+            
+            storm::solver::Multiplier<ValueType> const& multiplier = *this->multiplier;
+            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper([&env, &multiplier, &b] (std::vector<ValueType> const& currentX, std::vector<ValueType>& newX) { multiplier.multiply(env, currentX, &b, newX); }, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), env.solver().native().getMaximalNumberOfIterations());
+            if (this->hasUpperBound()) {
+                helper.setUpperBound(this->getUpperBound(true));
+            }
+            if (this->hasRelevantValues()) {
+                helper.setRelevantValues(&this->getRelevantValues());
+            }
+            if (this->hasCustomTerminationCondition()) {
+                helper.setTerminationCondition(&this->getTerminationCondition());
+            }
+            
+            this->startMeasureProgress();
+            SolverStatus status = helper.solve(x, *this->cachedRowVector, *this->cachedRowVector2);
+            this->showProgressIterative(helper.getNumberOfIterations());
+            
+            this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, helper.getNumberOfIterations());
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             return solveEquationsRationalSearchHelper<double>(env, x, b);
@@ -908,7 +953,7 @@ namespace storm {
                 } else {
                     STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
                 }
-            } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration && method != NativeLinearEquationSolverMethod::RationalSearch) {
+            } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration && method != NativeLinearEquationSolverMethod::OptimisticValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration && method != NativeLinearEquationSolverMethod::RationalSearch) {
                 if (env.solver().native().isMethodSetFromDefault()) {
                     method = NativeLinearEquationSolverMethod::SoundValueIteration;
                     STORM_LOG_INFO("Selecting '" + toString(method) + "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
@@ -935,6 +980,8 @@ namespace storm {
                     return this->solveEquationsPower(env, x, b);
                 case NativeLinearEquationSolverMethod::SoundValueIteration:
                     return this->solveEquationsSoundValueIteration(env, x, b);
+                case NativeLinearEquationSolverMethod::OptimisticValueIteration:
+                    return this->solveEquationsOptimisticValueIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::IntervalIteration:
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
@@ -947,7 +994,7 @@ namespace storm {
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
-            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration) {
+            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration) {
                 return LinearEquationSolverProblemFormat::FixedPointSystem;
             } else {
                 return LinearEquationSolverProblemFormat::EquationSystem;
@@ -964,6 +1011,8 @@ namespace storm {
                 requirements.requireLowerBounds();
             } else if (method == NativeLinearEquationSolverMethod::SoundValueIteration) {
                 requirements.requireBounds(false);
+            } else if (method == NativeLinearEquationSolverMethod::OptimisticValueIteration) {
+                requirements.requireLowerBounds();
             }
             return requirements;
         }
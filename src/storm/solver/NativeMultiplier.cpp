@@ -7,27 +7,80 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
         
+        // The number of chunks per thread for the parallel multiplication. Having more chunks than threads
+        // compensates for rows whose cost is not reflected by their number of entries.
+        static const uint64_t chunksPerThread = 8;
+        
         template<typename ValueType>
-        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), entriesDropped(false) {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        NativeMultiplier<ValueType>::NativeMultiplier(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) : Multiplier<ValueType>(std::move(matrix)), entriesDropped(false) {
+            if (getCompactMatrix(env)) {
+                // As the compact representation is used from now on (regardless of the environments passed to later
+                // calls), the entries of the original matrix are dropped.
+                std::vector<uint64_t> rowIndications(this->ownedMatrix->getRowCount() + 1, 0);
+                boost::optional<std::vector<uint64_t>> rowGroupIndices;
+                if (!this->ownedMatrix->hasTrivialRowGrouping()) {
+                    rowGroupIndices = this->ownedMatrix->getRowGroupIndices();
+                }
+                *this->ownedMatrix = storm::storage::SparseMatrix<ValueType>(this->ownedMatrix->getColumnCount(), std::move(rowIndications), std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>>(), std::move(rowGroupIndices));
+                entriesDropped = true;
+            }
+        }
+        
         template<typename ValueType>
         bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
-            return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-            return false;
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                return true;
+            }
 #endif
+            return env.solver().multiplier().getNumberOfThreads() != 1;
+        }
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::useCompactLayout(Environment const& env) const {
+            // The vectorized kernels only exist for double values and they operate on the compact layout.
+            return env.solver().multiplier().isCompactLayoutSet() || (std::is_same<ValueType, double>::value && env.solver().multiplier().getVectorInstructionSet() != storm::storage::kernels::VectorInstructionSet::Scalar);
+        }
+        
+        template<typename ValueType>
+        storm::storage::CompactSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getCompactMatrix(Environment const& env) const {
+            if (!compactMatrix && useCompactLayout(env) && storm::storage::CompactSparseMatrix<ValueType>::isApplicable(this->matrix)) {
+                compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix, env.solver().multiplier().getVectorInstructionSet());
+            }
+            return compactMatrix.get();
+        }
+        
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& NativeMultiplier<ValueType>::getRegularMatrix() const {
+            STORM_LOG_THROW(!entriesDropped, storm::exceptions::IllegalFunctionCallException, "The entries of the regular matrix were dropped in favor of the compact matrix.");
+            return this->matrix;
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            // If the entries of the matrix were dropped, the compact representation is the only one left.
+            if (!entriesDropped) {
+                compactMatrix.reset();
+            }
+            Multiplier<ValueType>::clearCache();
         }
         
         template<typename ValueType>
@@ -42,7 +95,9 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddParallel(x, b, *target);
+                multAddParallel(env, x, b, *target);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyWithVectorForward(x, *target, b, 0, compact->getRowCount());
             } else {
                 multAdd(x, b, *target);
             }
@@ -53,7 +108,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
-            this->matrix.multiplyWithVectorBackward(x, x, b);
+            if (parallelize(env)) {
+                multAddGaussSeidelParallel(env, x, b);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyWithVectorBackward(x, x, b);
+            } else {
+                getRegularMatrix().multiplyWithVectorBackward(x, x, b);
+            }
         }
         
         template<typename ValueType>
@@ -68,7 +129,9 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+                multAddReduceParallel(env, dir, rowGroupIndices, x, b, *target, choices);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, *target, choices, 0, rowGroupIndices.size() - 1);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -79,60 +142,258 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
-            this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            if (parallelize(env)) {
+                multAddReduceGaussSeidelParallel(env, dir, rowGroupIndices, x, b, choices);
+            } else if (auto compact = getCompactMatrix(env)) {
+                compact->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else {
+                getRegularMatrix().multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            }
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
-            for (auto const& entry : this->matrix.getRow(rowIndex)) {
+            if (compactMatrix) {
+                compactMatrix->multiplyRow(rowIndex, x, value);
+                return;
+            }
+            for (auto const& entry : getRegularMatrix().getRow(rowIndex)) {
                 value += entry.getValue() * x[entry.getColumn()];
             }
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
-            for (auto const& entry : this->matrix.getRow(rowIndex)) {
+            if (compactMatrix) {
+                compactMatrix->multiplyRow(rowIndex, x1, val1);
+                compactMatrix->multiplyRow(rowIndex, x2, val2);
+                return;
+            }
+            for (auto const& entry : getRegularMatrix().getRow(rowIndex)) {
                 val1 += entry.getValue() * x1[entry.getColumn()];
                 val2 += entry.getValue() * x2[entry.getColumn()];
             }
         }
-
-
+        
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-            this->matrix.multiplyWithVector(x, result, b);
+            getRegularMatrix().multiplyWithVector(x, result, b);
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-            this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            getRegularMatrix().multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+        }
+        
+        template<typename ValueType>
+        std::vector<uint64_t> NativeMultiplier<ValueType>::getChunks(std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfChunks) const {
+            auto const& matrix = this->matrix;
+            auto compact = compactMatrix.get();
+            // Every row also gets a weight of one to account for the rows without entries.
+            auto entriesBefore = [&matrix, compact] (uint64_t row) { return compact ? compact->getRowIndications()[row] : static_cast<uint64_t>(matrix.begin(row) - matrix.begin()); };
+            if (rowGroupIndices) {
+                return storm::utility::partitionByWeight(rowGroupIndices->size() - 1, numberOfChunks, [&entriesBefore, rowGroupIndices] (uint64_t group) { uint64_t row = (*rowGroupIndices)[group]; return entriesBefore(row) + row; });
+            } else {
+                return storm::utility::partitionByWeight(matrix.getRowCount(), numberOfChunks, [&entriesBefore] (uint64_t row) { return entriesBefore(row) + row; });
+            }
         }
         
         template<typename ValueType>
-        void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+        void NativeMultiplier<ValueType>::multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            auto compact = getCompactMatrix(env);
 #ifdef STORM_HAVE_INTELTBB
-            this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(x, b, result);
+            if (!compact && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                getRegularMatrix().multiplyWithVectorParallel(x, result, b);
+                return;
+            }
 #endif
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().multiplier().getNumberOfThreads());
+            std::vector<uint64_t> chunks = getChunks(nullptr, numberOfThreads * chunksPerThread);
+            storm::utility::getThreadPool().execute(chunks.size() - 1, [&] (uint64_t chunk) {
+                if (compact) {
+                    compact->multiplyWithVectorForward(x, result, b, chunks[chunk], chunks[chunk + 1]);
+                } else {
+                    multAddRange(x, b, result, chunks[chunk], chunks[chunk + 1]);
+                }
+            }, numberOfThreads);
         }
-                
+        
         template<typename ValueType>
-        void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+        void NativeMultiplier<ValueType>::multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            auto compact = getCompactMatrix(env);
 #ifdef STORM_HAVE_INTELTBB
-            this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+            if (!compact && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                getRegularMatrix().multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+                return;
+            }
 #endif
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().multiplier().getNumberOfThreads());
+            std::vector<uint64_t> chunks = getChunks(&rowGroupIndices, numberOfThreads * chunksPerThread);
+            storm::utility::getThreadPool().execute(chunks.size() - 1, [&] (uint64_t chunk) {
+                if (compact) {
+                    compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, result, choices, chunks[chunk], chunks[chunk + 1]);
+                } else {
+                    multAddReduceRange(dir, rowGroupIndices, x, b, result, choices, chunks[chunk], chunks[chunk + 1]);
+                }
+            }, numberOfThreads);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddGaussSeidelParallel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            STORM_LOG_ASSERT(this->matrix.getRowCount() == this->matrix.getColumnCount(), "Expecting square matrix.");
+            auto compact = getCompactMatrix(env);
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().multiplier().getNumberOfThreads());
+            std::vector<uint64_t> blocks = getChunks(nullptr, numberOfThreads);
+            if (this->cachedVector) {
+                *this->cachedVector = x;
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x);
+            }
+            std::vector<ValueType> const& previousX = *this->cachedVector;
+            storm::utility::getThreadPool().execute(blocks.size() - 1, [&] (uint64_t block) {
+                multAddGaussSeidelRange(compact, x, previousX, b, blocks[block], blocks[block + 1]);
+            }, numberOfThreads);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceGaussSeidelParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices) const {
+            auto compact = getCompactMatrix(env);
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().multiplier().getNumberOfThreads());
+            std::vector<uint64_t> blocks = getChunks(&rowGroupIndices, numberOfThreads);
+            if (this->cachedVector) {
+                *this->cachedVector = x;
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x);
+            }
+            std::vector<ValueType> const& previousX = *this->cachedVector;
+            storm::utility::getThreadPool().execute(blocks.size() - 1, [&] (uint64_t block) {
+                multAddReduceGaussSeidelRange(compact, dir, rowGroupIndices, x, previousX, b, choices, blocks[block], blocks[block + 1]);
+            }, numberOfThreads);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddRange(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t startRow, uint64_t endRow) const {
+            auto const& matrix = getRegularMatrix();
+            auto elementIt = matrix.begin(startRow);
+            for (uint64_t row = startRow; row < endRow; ++row) {
+                ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                for (auto elementIte = matrix.end(row); elementIt != elementIte; ++elementIt) {
+                    newValue += elementIt->getValue() * x[elementIt->getColumn()];
+                }
+                result[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t startGroup, uint64_t endGroup) const {
+            auto const& matrix = getRegularMatrix();
+            for (uint64_t group = startGroup; group < endGroup; ++group) {
+                uint64_t row = rowGroupIndices[group];
+                uint64_t rowEnd = rowGroupIndices[group + 1];
+                uint64_t choice = 0;
+                ValueType currentValue = storm::utility::zero<ValueType>();
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (row < rowEnd) {
+                    currentValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        currentValue += entry.getValue() * x[entry.getColumn()];
+                    }
+                    for (++row; row < rowEnd; ++row) {
+                        ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                        for (auto const& entry : matrix.getRow(row)) {
+                            newValue += entry.getValue() * x[entry.getColumn()];
+                        }
+                        if ((dir == OptimizationDirection::Minimize && newValue < currentValue) || (dir == OptimizationDirection::Maximize && newValue > currentValue)) {
+                            currentValue = newValue;
+                            choice = row - rowGroupIndices[group];
+                        }
+                    }
+                }
+                
+                result[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddGaussSeidelRange(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType>& x, std::vector<ValueType> const& previousX, std::vector<ValueType> const* b, uint64_t startRow, uint64_t endRow) const {
+            for (uint64_t row = endRow; row > startRow;) {
+                --row;
+                ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                multiplyRowBlockwise(compact, row, x, previousX, startRow, endRow, newValue);
+                x[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceGaussSeidelRange(storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const& previousX, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, uint64_t startGroup, uint64_t endGroup) const {
+            for (uint64_t group = endGroup; group > startGroup;) {
+                --group;
+                uint64_t rowStart = rowGroupIndices[group];
+                uint64_t row = rowGroupIndices[group + 1];
+                uint64_t choice = 0;
+                ValueType currentValue = storm::utility::zero<ValueType>();
+                
+                // Only multiply and reduce if there is at least one row in the group. As in the sequential version,
+                // the rows are processed backwards.
+                bool first = true;
+                while (row > rowStart) {
+                    --row;
+                    ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    multiplyRowBlockwise(compact, row, x, previousX, startGroup, endGroup, newValue);
+                    if (first || (dir == OptimizationDirection::Minimize && newValue < currentValue) || (dir == OptimizationDirection::Maximize && newValue > currentValue)) {
+                        currentValue = newValue;
+                        choice = row - rowStart;
+                        first = false;
+                    }
+                }
+                
+                x[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = choice;
+                }
+            }
         }
 
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyRowBlockwise(storm::storage::CompactSparseMatrix<ValueType> const* compact, uint64_t row, std::vector<ValueType> const& x, std::vector<ValueType> const& previousX, uint64_t blockStart, uint64_t blockEnd, ValueType& value) const {
+            // Values of other blocks might be written concurrently, so we take them from the previous iteration.
+            if (compact) {
+                auto const& columns = compact->getColumns();
+                auto const& values = compact->getValues();
+                for (uint64_t entry = compact->getRowIndications()[row], entryEnd = compact->getRowIndications()[row + 1]; entry < entryEnd; ++entry) {
+                    uint64_t column = columns[entry];
+                    value += values[entry] * ((column >= blockStart && column < blockEnd) ? x[column] : previousX[column]);
+                }
+            } else {
+                for (auto const& entry : getRegularMatrix().getRow(row)) {
+                    uint64_t column = entry.getColumn();
+                    value += entry.getValue() * ((column >= blockStart && column < blockEnd) ? x[column] : previousX[column]);
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multAddReduceRange(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint64_t>*, uint64_t, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multAddReduceGaussSeidelRange(storm::storage::CompactSparseMatrix<storm::RationalFunction> const*, storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<uint64_t>*, uint64_t, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
         template class NativeMultiplier<storm::RationalFunction>;
 #endif
-        
+    
     }
 }
@@ -3,6 +3,7 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 namespace storm {
     namespace storage {
@@ -15,7 +16,19 @@ namespace storm {
         template<typename ValueType>
         class NativeMultiplier : public Multiplier<ValueType> {
         public:
+            /*!
+             * Creates a multiplier for the given matrix. As the matrix is kept by the caller, using the compact layout
+             * requires an additional copy of the entries, which is created upon the first multiplication.
+             */
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix. If the environment requests the compact
+             * layout and it is applicable, the compact representation is created right away and only the dimensions
+             * and the row grouping of the original matrix are kept. All later operations then use the compact
+             * representation, even if the environment passed to them does not request it.
+             */
+            NativeMultiplier(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix);
             virtual ~NativeMultiplier() = default;
             
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
@@ -24,17 +37,73 @@ namespace storm {
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
 
         private:
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves whether the environment requests the compact layout, either explicitly or by selecting a
+             * vector instruction set (for which the kernels operate on the compact layout).
+             */
+            bool useCompactLayout(Environment const& env) const;
+            
+            /*!
+             * Retrieves the compact representation of the matrix if it is requested by the environment and applicable
+             * to the matrix. The representation is created on the first call and used for all operations from then on.
+             * Its forward multiplications use the vector instruction set selected by the environment at that time.
+             *
+             * @return The compact matrix or null if the regular matrix is to be used.
+             */
+            storm::storage::CompactSparseMatrix<ValueType> const* getCompactMatrix(Environment const& env) const;
+            
+            /*!
+             * Retrieves the regular matrix for operations that read its entries. This must only be called if the
+             * compact representation is not used. Throws if the entries of the matrix were dropped, as reading the
+             * remaining (empty) rows would silently yield wrong results.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getRegularMatrix() const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
-            void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
-            void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            void multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+            /*!
+             * Performs a block-parallel Gauss-Seidel multiplication. The rows (row groups) are split into one block
+             * per thread. Within a block, the updated values are used as soon as they are available (like in the
+             * sequential Gauss-Seidel multiplication) while the values of other blocks are taken from the previous
+             * iteration.
+             */
+            void multAddGaussSeidelParallel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const;
+            void multAddReduceGaussSeidelParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices = nullptr) const;
+            
+            // Helpers that process a range of rows (row groups) of the regular matrix layout.
+            void multAddRange(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t startRow, uint64_t endRow) const;
+            void multAddReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t startGroup, uint64_t endGroup) const;
+            
+            // Helpers that process a range of rows (row groups) of the compact (if given) or the regular matrix layout.
+            void multAddGaussSeidelRange(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType>& x, std::vector<ValueType> const& previousX, std::vector<ValueType> const* b, uint64_t startRow, uint64_t endRow) const;
+            void multAddReduceGaussSeidelRange(storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const& previousX, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, uint64_t startGroup, uint64_t endGroup) const;
+            
+            /*!
+             * Multiplies the given row with the values of x for the columns in [blockStart, blockEnd) and the values
+             * of previousX for all other columns and adds the result to the given value.
+             */
+            void multiplyRowBlockwise(storm::storage::CompactSparseMatrix<ValueType> const* compact, uint64_t row, std::vector<ValueType> const& x, std::vector<ValueType> const& previousX, uint64_t blockStart, uint64_t blockEnd, ValueType& value) const;
+            
+            /*!
+             * Splits the rows (if rowGroupIndices is null) or the given row groups into the given number of chunks
+             * with roughly the same number of entries. The entries are counted in the compact layout if it is used.
+             */
+            std::vector<uint64_t> getChunks(std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfChunks) const;
+            
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactMatrix;
             
+            // Whether the entries of the (owned) matrix were dropped, such that only the compact matrix is left.
+            bool entriesDropped;
         };
         
     }
@@ -18,6 +18,8 @@ namespace storm {
                     return "intervaliteration";
                 case MinMaxMethod::SoundValueIteration:
                     return "soundvalueiteration";
+                case MinMaxMethod::OptimisticValueIteration:
+                    return "optimisticvalueiteration";
                 case MinMaxMethod::TopologicalCuda:
                     return "topologicalcuda";
             }
@@ -96,6 +98,8 @@ namespace storm {
                     return "Power";
                 case NativeLinearEquationSolverMethod::SoundValueIteration:
                     return "SoundValueIteration";
+                case NativeLinearEquationSolverMethod::OptimisticValueIteration:
+                    return "OptimisticValueIteration";
                 case NativeLinearEquationSolverMethod::IntervalIteration:
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
@@ -72,20 +72,17 @@ namespace storm {
             storm::dd::Add<DdType, ValueType> localX = x;
             uint64_t iterations = 0;
             
+            // When minimizing, the illegal choices are masked by adding infinity to their values. As the mask does
+            // not change, we add it to b once instead of in every iteration.
+            bool maximize = dir == storm::solver::OptimizationDirection::Maximize;
+            storm::dd::Add<DdType, ValueType> offset = maximize ? b : b + illegalMaskAdd;
+            
             // Value iteration loop.
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && iterations < maximalIterations) {
-                // Compute tmp = A * x + b
+                // Compute tmp = min/max(A * x + b) in one DD operation.
                 storm::dd::Add<DdType, ValueType> localXAsColumn = localX.swapVariables(this->rowColumnMetaVariablePairs);
-                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(localXAsColumn, this->columnMetaVariables);
-                tmp += b;
-                
-                if (dir == storm::solver::OptimizationDirection::Minimize) {
-                    tmp += illegalMaskAdd;
-                    tmp = tmp.minAbstract(this->choiceVariables);
-                } else {
-                    tmp = tmp.maxAbstract(this->choiceVariables);
-                }
+                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrixAndAbstract(localXAsColumn, this->columnMetaVariables, offset, this->choiceVariables, maximize);
                 
                 // Now check if the process already converged within our precision.
                 if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
@@ -107,14 +104,11 @@ namespace storm {
         template<storm::dd::DdType DdType, typename ValueType>
         bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::isSolution(OptimizationDirection dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
-            storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(xAsColumn, this->columnMetaVariables);
-            tmp += b;
-            
+            storm::dd::Add<DdType, ValueType> tmp;
             if (dir == storm::solver::OptimizationDirection::Minimize) {
-                tmp += illegalMaskAdd;
-                tmp = tmp.minAbstract(this->choiceVariables);
+                tmp = this->A.multiplyMatrixAndAbstract(xAsColumn, this->columnMetaVariables, b + illegalMaskAdd, this->choiceVariables, false);
             } else {
-                tmp = tmp.maxAbstract(this->choiceVariables);
+                tmp = this->A.multiplyMatrixAndAbstract(xAsColumn, this->columnMetaVariables, b, this->choiceVariables, true);
             }
             
             return x == tmp;
@@ -395,22 +389,18 @@ namespace storm {
         storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::multiply(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const* b, uint_fast64_t n) const {
             storm::dd::Add<DdType, ValueType> xCopy = x;
             
+            bool maximize = dir == storm::solver::OptimizationDirection::Maximize;
+            storm::dd::Add<DdType, ValueType> offset = b != nullptr ? *b : this->A.getDdManager().template getAddZero<ValueType>();
+            if (!maximize) {
+                // This is a hack and only here because of the lack of a suitable minAbstract/maxAbstract function
+                // that can properly deal with a restriction of the choices.
+                offset += illegalMaskAdd;
+            }
+            
             // Perform matrix-vector multiplication while the bound is met.
             for (uint_fast64_t i = 0; i < n; ++i) {
                 xCopy = xCopy.swapVariables(this->rowColumnMetaVariablePairs);
-                xCopy = this->A.multiplyMatrix(xCopy, this->columnMetaVariables);
-                if (b != nullptr) {
-                    xCopy += *b;
-                }
-                
-                if (dir == storm::solver::OptimizationDirection::Minimize) {
-                    // This is a hack and only here because of the lack of a suitable minAbstract/maxAbstract function
-                    // that can properly deal with a restriction of the choices.
-                    xCopy += illegalMaskAdd;
-                    xCopy = xCopy.minAbstract(this->choiceVariables);
-                } else {
-                    xCopy = xCopy.maxAbstract(this->choiceVariables);
-                }
+                xCopy = this->A.multiplyMatrixAndAbstract(xCopy, this->columnMetaVariables, offset, this->choiceVariables, maximize);
             }
             
             return xCopy;
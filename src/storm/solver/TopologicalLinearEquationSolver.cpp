@@ -1,8 +1,15 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
+#include "storm-config.h"
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -78,16 +85,29 @@ namespace storm {
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
             } else {
-                storm::storage::BitVector sccAsBitVector(x.size(), false);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.isTrivial()) {
-                        returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-                    } else {
-                        sccAsBitVector.clear();
-                        for (auto const& state : scc) {
-                            sccAsBitVector.set(state, true);
+                bool solveInParallel = env.solver().topological().getNumberOfThreads() != 1;
+#ifdef STORM_HAVE_CARL
+                if (solveInParallel && std::is_same<ValueType, storm::RationalFunction>::value) {
+                    // Arithmetic on rational functions is not thread-safe.
+                    STORM_LOG_WARN("Solving SCCs in parallel is not supported for rational functions. Falling back to sequential solving.");
+                    solveInParallel = false;
+                }
+#endif
+                if (solveInParallel) {
+                    returnValue = solveSccsInParallel(env, sccSolverEnvironment, x, b);
+                } else {
+                    storm::storage::BitVector sccAsBitVector(x.size(), false);
+                    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+                        auto scc = this->sortedSccDecomposition->getScc(sccIndex);
+                        if (scc.isTrivial()) {
+                            returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                        } else {
+                            sccAsBitVector.clear();
+                            for (auto const& state : scc) {
+                                sccAsBitVector.set(state, true);
+                            }
+                            returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->sccSolver) && returnValue;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
                     }
                 }
             }
@@ -104,14 +124,46 @@ namespace storm {
         
         template<typename ValueType>
         void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
-            // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A);
+            // Obtain the scc decomposition. The SCCs are already sorted (reverse) topologically.
             if (needLongestChainSize) {
                 this->longestSccChainSize = 0;
-                this->sortedSccDecomposition->sortTopologically(*this->A, &(this->longestSccChainSize.get()));
+                this->sortedSccDecomposition = std::make_unique<storm::storage::CompactSccDecomposition<ValueType>>(*this->A, false, false, &(this->longestSccChainSize.get()));
             } else {
-                this->sortedSccDecomposition->sortTopologically(*this->A);
+                this->sortedSccDecomposition = std::make_unique<storm::storage::CompactSccDecomposition<ValueType>>(*this->A);
+            }
+        }
+        
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& env, storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->sccScheduler) {
+                this->sccScheduler = std::make_unique<storm::solver::helper::ParallelSccScheduler>(*this->A, *this->sortedSccDecomposition, env.solver().topological().getSccBatchSize());
             }
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+            STORM_LOG_INFO("Solving SCCs with " << numberOfThreads << " threads. " << this->sccScheduler->getNumberOfInitiallyReadySccs() << " SCC(s) can be solved right away.");
+            
+            // Each worker has its own solver and auxiliary bit vector.
+            this->parallelSccSolvers.resize(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::atomic<bool> returnValue(true);
+            
+            this->sccScheduler->execute(numberOfThreads, [&] (uint64_t sccIndex, uint64_t workerIndex) {
+                auto scc = this->sortedSccDecomposition->getScc(sccIndex);
+                bool sccResult;
+                if (scc.isTrivial()) {
+                    sccResult = solveTrivialScc(*scc.begin(), x, b);
+                } else {
+                    storm::storage::BitVector& sccAsBitVector = sccAsBitVectors[workerIndex];
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    sccResult = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->parallelSccSolvers[workerIndex]);
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            });
+            return returnValue;
         }
         
         template<typename ValueType>
@@ -155,23 +207,23 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
             //std::cout << "Solving SCC " << scc << std::endl;
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -191,20 +243,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -225,6 +277,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            parallelSccSolvers.clear();
+            sccScheduler.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
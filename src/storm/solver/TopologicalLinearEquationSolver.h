@@ -4,7 +4,8 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
-#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/ParallelSccScheduler.h"
+#include "storm/storage/CompactSccDecomposition.h"
 
 namespace storm {
     
@@ -46,7 +47,10 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const;
+            
+            // Solves all SCCs (in case there are multiple), where independent SCCs are solved concurrently
+            bool solveSccsInParallel(storm::Environment const& env, storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -57,9 +61,11 @@ namespace storm {
             storm::storage::SparseMatrix<ValueType> const* A;
             
             // cached auxiliary data
-            mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
+            mutable std::unique_ptr<storm::storage::CompactSccDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> parallelSccSolvers; // one solver per worker
+            mutable std::unique_ptr<storm::solver::helper::ParallelSccScheduler> sccScheduler;
         };
         
         template<typename ValueType>
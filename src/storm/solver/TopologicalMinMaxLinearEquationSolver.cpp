@@ -1,9 +1,12 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -75,21 +78,19 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.isTrivial()) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) {
-                            sccRowGroupsAsBitVector.set(group, true);
-                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                sccRowsAsBitVector.set(row, true);
-                            }
+                if (env.solver().topological().getNumberOfThreads() != 1) {
+                    returnValue = solveSccsInParallel(env, sccSolverEnvironment, dir, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+                        auto scc = this->sortedSccDecomposition->getScc(sccIndex);
+                        if (scc.isTrivial()) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                            returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolver) && returnValue;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
                     }
                 }
                 
@@ -112,13 +113,54 @@ namespace storm {
         
         template<typename ValueType>
         void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
-            // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A);
+            // Obtain the scc decomposition. The SCCs are already sorted (reverse) topologically.
             if (needLongestChainSize) {
                 this->longestSccChainSize = 0;
-                this->sortedSccDecomposition->sortTopologically(*this->A, &(this->longestSccChainSize.get()));
+                this->sortedSccDecomposition = std::make_unique<storm::storage::CompactSccDecomposition<ValueType>>(*this->A, false, false, &(this->longestSccChainSize.get()));
             } else {
-                this->sortedSccDecomposition->sortTopologically(*this->A);
+                this->sortedSccDecomposition = std::make_unique<storm::storage::CompactSccDecomposition<ValueType>>(*this->A);
+            }
+        }
+        
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& env, storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->sccScheduler) {
+                this->sccScheduler = std::make_unique<storm::solver::helper::ParallelSccScheduler>(*this->A, *this->sortedSccDecomposition, env.solver().topological().getSccBatchSize());
+            }
+            uint64_t numberOfThreads = storm::utility::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+            STORM_LOG_INFO("Solving SCCs with " << numberOfThreads << " threads. " << this->sccScheduler->getNumberOfInitiallyReadySccs() << " SCC(s) can be solved right away.");
+            
+            // Each worker has its own solver and auxiliary bit vectors.
+            this->parallelSccSolvers.resize(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::vector<storm::storage::BitVector> sccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+            std::atomic<bool> returnValue(true);
+            
+            this->sccScheduler->execute(numberOfThreads, [&] (uint64_t sccIndex, uint64_t workerIndex) {
+                auto scc = this->sortedSccDecomposition->getScc(sccIndex);
+                bool sccResult;
+                if (scc.isTrivial()) {
+                    sccResult = solveTrivialScc(*scc.begin(), dir, x, b);
+                } else {
+                    setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVectors[workerIndex], sccRowsAsBitVectors[workerIndex]);
+                    sccResult = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVectors[workerIndex], sccRowsAsBitVectors[workerIndex], x, b, this->parallelSccSolvers[workerIndex]);
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            });
+            return returnValue;
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::setSccRowGroupsAndRows(typename storm::storage::CompactSccDecomposition<ValueType>::Scc const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const {
+            sccRowGroups.clear();
+            sccRows.clear();
+            for (auto const& group : scc) {
+                sccRowGroups.set(group, true);
+                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                    sccRows.set(row, true);
+                }
             }
         }
         
@@ -201,20 +243,20 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -235,23 +277,23 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                sccSolver->setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -262,16 +304,16 @@ namespace storm {
                 req.clearValidInitialScheduler();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -291,6 +333,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            parallelSccSolvers.clear();
+            sccScheduler.reset();
             auxiliaryRowGroupVector.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
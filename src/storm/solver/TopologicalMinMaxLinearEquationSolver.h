@@ -3,7 +3,8 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
-#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/ParallelSccScheduler.h"
+#include "storm/storage/CompactSccDecomposition.h"
 
 namespace storm {
 
@@ -41,12 +42,20 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
+            
+            // Solves all SCCs (in case there are multiple), where independent SCCs are solved concurrently
+            bool solveSccsInParallel(storm::Environment const& env, storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            // Sets the row groups and rows of the given SCC in the given bit vectors (and clears all other bits)
+            void setSccRowGroupsAndRows(typename storm::storage::CompactSccDecomposition<ValueType>::Scc const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const;
 
             // cached auxiliary data
-            mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
+            mutable std::unique_ptr<storm::storage::CompactSccDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+            mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> parallelSccSolvers; // one solver per worker
+            mutable std::unique_ptr<storm::solver::helper::ParallelSccScheduler> sccScheduler;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
         };
     }
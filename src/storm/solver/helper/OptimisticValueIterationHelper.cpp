@@ -0,0 +1,159 @@
+#include "storm/solver/helper/OptimisticValueIterationHelper.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+            
+            template<typename ValueType>
+            OptimisticValueIterationHelper<ValueType>::OptimisticValueIterationHelper(IterationStep const& iterationStep, bool relative, ValueType const& precision, uint64_t maximalNumberOfIterations) : iterationStep(iterationStep), relative(relative), precision(precision), maximalNumberOfIterations(maximalNumberOfIterations), hasUpperBound(false), upperBound(storm::utility::zero<ValueType>()), relevantValues(nullptr), terminationCondition(nullptr), iterations(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            void OptimisticValueIterationHelper<ValueType>::setUpperBound(ValueType const& value) {
+                hasUpperBound = true;
+                upperBound = value;
+            }
+            
+            template<typename ValueType>
+            void OptimisticValueIterationHelper<ValueType>::setRelevantValues(storm::storage::BitVector const* relevantValues) {
+                this->relevantValues = relevantValues;
+            }
+            
+            template<typename ValueType>
+            void OptimisticValueIterationHelper<ValueType>::setTerminationCondition(storm::solver::TerminationCondition<ValueType> const* terminationCondition) {
+                this->terminationCondition = terminationCondition;
+            }
+            
+            template<typename ValueType>
+            SolverStatus OptimisticValueIterationHelper<ValueType>::solve(std::vector<ValueType>& x, std::vector<ValueType>& auxiliaryVector1, std::vector<ValueType>& auxiliaryVector2) {
+                auxiliaryVector1.resize(x.size());
+                auxiliaryVector2.resize(x.size());
+                std::vector<ValueType>* lowerX = &x;
+                std::vector<ValueType>* upperX = &auxiliaryVector1;
+                std::vector<ValueType>* tmpX = &auxiliaryVector2;
+                
+                iterations = 0;
+                ValueType iterationPrecision = precision;
+                SolverStatus status = SolverStatus::InProgress;
+                while (status == SolverStatus::InProgress) {
+                    // Perform value iteration from below until it converges with respect to the current precision.
+                    uint64_t valueIterations = 0;
+                    bool converged = false;
+                    while (!converged && iterations < maximalNumberOfIterations) {
+                        iterationStep(*lowerX, *tmpX);
+                        converged = isPreciseEnough(*lowerX, *tmpX, iterationPrecision);
+                        std::swap(lowerX, tmpX);
+                        ++iterations;
+                        ++valueIterations;
+                        if (terminationCondition != nullptr && terminationCondition->terminateNow(*lowerX, SolverGuarantee::LessOrEqual)) {
+                            status = SolverStatus::TerminatedEarly;
+                            break;
+                        }
+                    }
+                    if (status != SolverStatus::InProgress) {
+                        break;
+                    }
+                    if (!converged) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                        break;
+                    }
+                    
+                    // Guess an upper bound and try to verify it. We spend at most as many iterations on this as on
+                    // the preceding value iteration.
+                    guessUpperBound(*lowerX, *upperX, iterationPrecision);
+                    VerificationResult verificationResult = verifyUpperBound(*lowerX, upperX, tmpX, valueIterations);
+                    if (verificationResult == VerificationResult::Verified && isPreciseEnough(*lowerX, *upperX, relative ? precision : storm::utility::convertNumber<ValueType>(2.0) * precision)) {
+                        // The solution lies between the lower and the upper values, so their mean is precise enough.
+                        ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+                        storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, *lowerX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+                        status = SolverStatus::Converged;
+                    } else if (iterations >= maximalNumberOfIterations) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                    } else {
+                        STORM_LOG_TRACE("Optimistic value iteration could not verify the guessed upper bound after " << iterations << " iterations. Continuing with a smaller precision.");
+                        iterationPrecision /= storm::utility::convertNumber<ValueType>(2.0);
+                    }
+                }
+                
+                // Write the result to the input/output vector.
+                if (lowerX != &x) {
+                    std::swap(x, *lowerX);
+                }
+                return status;
+            }
+            
+            template<typename ValueType>
+            uint64_t OptimisticValueIterationHelper<ValueType>::getNumberOfIterations() const {
+                return iterations;
+            }
+            
+            template<typename ValueType>
+            void OptimisticValueIterationHelper<ValueType>::guessUpperBound(std::vector<ValueType> const& lowerX, std::vector<ValueType>& upperX, ValueType const& guessPrecision) const {
+                ValueType factor = storm::utility::one<ValueType>() + guessPrecision;
+                auto upperIt = upperX.begin();
+                for (auto const& lowerValue : lowerX) {
+                    *upperIt = relative ? lowerValue * factor : lowerValue + guessPrecision;
+                    if (hasUpperBound && *upperIt > upperBound) {
+                        *upperIt = upperBound;
+                    }
+                    ++upperIt;
+                }
+            }
+            
+            template<typename ValueType>
+            typename OptimisticValueIterationHelper<ValueType>::VerificationResult OptimisticValueIterationHelper<ValueType>::verifyUpperBound(std::vector<ValueType> const& lowerX, std::vector<ValueType>*& upperX, std::vector<ValueType>*& tmpX, uint64_t maximalNumberOfVerificationIterations) {
+                for (uint64_t verificationIterations = 0; verificationIterations < maximalNumberOfVerificationIterations && iterations < maximalNumberOfIterations; ++verificationIterations) {
+                    iterationStep(*upperX, *tmpX);
+                    ++iterations;
+                    
+                    // If no value increases, the values are an inductive upper bound, i.e. an upper bound of the
+                    // (unique) fixed point. If a value drops below the lower bound, the values can not be an upper
+                    // bound, because then the next values would also be one.
+                    bool isInductive = true;
+                    bool crossesLowerBound = false;
+                    auto lowerIt = lowerX.begin();
+                    auto upperIt = upperX->begin();
+                    for (auto const& newUpperValue : *tmpX) {
+                        if (newUpperValue > *upperIt) {
+                            isInductive = false;
+                        }
+                        if (newUpperValue < *lowerIt) {
+                            crossesLowerBound = true;
+                            break;
+                        }
+                        ++lowerIt;
+                        ++upperIt;
+                    }
+                    std::swap(upperX, tmpX);
+                    
+                    if (crossesLowerBound) {
+                        return VerificationResult::Refuted;
+                    } else if (isInductive) {
+                        return VerificationResult::Verified;
+                    }
+                }
+                return VerificationResult::Inconclusive;
+            }
+            
+            template<typename ValueType>
+            bool OptimisticValueIterationHelper<ValueType>::isPreciseEnough(std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, ValueType const& precision) const {
+                if (relevantValues != nullptr) {
+                    return storm::utility::vector::equalModuloPrecision<ValueType>(x1, x2, *relevantValues, precision, relative);
+                } else {
+                    return storm::utility::vector::equalModuloPrecision<ValueType>(x1, x2, precision, relative);
+                }
+            }
+            
+            template class OptimisticValueIterationHelper<double>;
+            template class OptimisticValueIterationHelper<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/TerminationCondition.h"
+
+namespace storm {
+    
+    namespace storage {
+        class BitVector;
+    }
+    
+    namespace solver {
+        namespace helper {
+            
+            /*!
+             * Implements optimistic value iteration (Hartmanns and Kaminski: Optimistic Value Iteration, CAV 2020).
+             * Standard value iteration is performed from below until it converges with respect to some precision.
+             * The values are then increased by that precision and the result is verified to be an upper bound of the
+             * solution by performing iterations from above. If this succeeds, the solution is enclosed by the lower
+             * and the upper values, which yields a sound result. Otherwise, value iteration is resumed with a smaller
+             * precision.
+             *
+             * In contrast to interval iteration and sound value iteration, this neither requires a priori upper
+             * bounds nor iterating two vectors throughout the computation. Soundness requires that the fixed point of
+             * the iteration step is unique (e.g. that there are no end components).
+             */
+            template<typename ValueType>
+            class OptimisticValueIterationHelper {
+            public:
+                /*!
+                 * A (monotone) iteration step that writes the result of applying the step to the first vector into
+                 * the second vector.
+                 */
+                typedef std::function<void(std::vector<ValueType> const& x, std::vector<ValueType>& result)> IterationStep;
+                
+                /*!
+                 * Creates a new helper that performs the given iteration step.
+                 *
+                 * @param iterationStep The iteration step.
+                 * @param relative Whether the precision is relative or absolute.
+                 * @param precision The precision of the result.
+                 * @param maximalNumberOfIterations The maximal number of iteration steps (including verification steps).
+                 */
+                OptimisticValueIterationHelper(IterationStep const& iterationStep, bool relative, ValueType const& precision, uint64_t maximalNumberOfIterations);
+                
+                /*!
+                 * Sets a known upper bound on all values, which is used to cut off guessed upper bounds.
+                 */
+                void setUpperBound(ValueType const& value);
+                
+                /*!
+                 * Sets the values for which the precision has to be achieved. If not set, the precision has to be
+                 * achieved for all values.
+                 */
+                void setRelevantValues(storm::storage::BitVector const* relevantValues);
+                
+                /*!
+                 * Sets a condition under which the computation is terminated early. It is checked on the values that
+                 * approach the solution from below.
+                 */
+                void setTerminationCondition(storm::solver::TerminationCondition<ValueType> const* terminationCondition);
+                
+                /*!
+                 * Performs optimistic value iteration.
+                 *
+                 * @param x Initially, a lower bound on the solution. After the call, the result of the computation.
+                 * @param auxiliaryVector1 Auxiliary storage (will be resized as needed).
+                 * @param auxiliaryVector2 Auxiliary storage (will be resized as needed).
+                 * @return The status of the computation.
+                 */
+                SolverStatus solve(std::vector<ValueType>& x, std::vector<ValueType>& auxiliaryVector1, std::vector<ValueType>& auxiliaryVector2);
+                
+                /*!
+                 * Retrieves the number of iteration steps that were performed by the last call to solve.
+                 */
+                uint64_t getNumberOfIterations() const;
+            
+            private:
+                enum class VerificationResult {
+                    Verified, Refuted, Inconclusive
+                };
+                
+                /*!
+                 * Writes a guess for an upper bound of the solution to the given vector that is the given precision
+                 * away from the given lower bound.
+                 */
+                void guessUpperBound(std::vector<ValueType> const& lowerX, std::vector<ValueType>& upperX, ValueType const& guessPrecision) const;
+                
+                /*!
+                 * Iterates the guessed upper bound until it is shown to be an upper bound, shown not to be one or the
+                 * given number of iterations is exceeded.
+                 */
+                VerificationResult verifyUpperBound(std::vector<ValueType> const& lowerX, std::vector<ValueType>*& upperX, std::vector<ValueType>*& tmpX, uint64_t maximalNumberOfVerificationIterations);
+                
+                bool isPreciseEnough(std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, ValueType const& precision) const;
+                
+                IterationStep iterationStep;
+                bool relative;
+                ValueType precision;
+                uint64_t maximalNumberOfIterations;
+                
+                bool hasUpperBound;
+                ValueType upperBound;
+                storm::storage::BitVector const* relevantValues;
+                storm::solver::TerminationCondition<ValueType> const* terminationCondition;
+                
+                uint64_t iterations;
+            };
+        }
+    }
+}
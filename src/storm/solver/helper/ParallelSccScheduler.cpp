@@ -0,0 +1,166 @@
+#include "storm/solver/helper/ParallelSccScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSccDecomposition.h"
+#include "storm/utility/ThreadPool.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+            
+            template<typename ValueType>
+            ParallelSccScheduler::ParallelSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::CompactSccDecomposition<ValueType> const& sccDecomposition, uint64_t batchSize) : batchSize(batchSize) {
+                uint64_t numberOfSccs = sccDecomposition.size();
+                
+                // Get a mapping from state to the corresponding scc
+                std::vector<uint64_t> sccIndices(matrix.getRowGroupCount(), std::numeric_limits<uint64_t>::max());
+                sccSizes.reserve(numberOfSccs);
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    auto scc = sccDecomposition.getScc(sccIndex);
+                    for (auto const& state : scc) {
+                        sccIndices[state] = sccIndex;
+                    }
+                    sccSizes.push_back(scc.size());
+                }
+                
+                // Collect the distinct successor SCCs of each SCC. We remember the SCC in which a successor was last
+                // encountered to avoid duplicates.
+                std::vector<uint64_t> lastSeenIn(numberOfSccs, std::numeric_limits<uint64_t>::max());
+                std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+                successorCounts.resize(numberOfSccs, 0);
+                predecessorIndications.resize(numberOfSccs + 1, 0);
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    for (auto const& state : sccDecomposition.getScc(sccIndex)) {
+                        for (auto const& entry : matrix.getRowGroup(state)) {
+                            uint64_t successorScc = sccIndices[entry.getColumn()];
+                            if (successorScc != sccIndex && lastSeenIn[successorScc] != sccIndex) {
+                                lastSeenIn[successorScc] = sccIndex;
+                                dependencies.emplace_back(successorScc, sccIndex);
+                                ++successorCounts[sccIndex];
+                                ++predecessorIndications[successorScc + 1];
+                            }
+                        }
+                    }
+                }
+                
+                // Store the predecessors of each SCC consecutively.
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    predecessorIndications[sccIndex + 1] += predecessorIndications[sccIndex];
+                }
+                predecessors.resize(dependencies.size());
+                std::vector<uint64_t> insertPositions(predecessorIndications.begin(), predecessorIndications.end() - 1);
+                for (auto const& dependency : dependencies) {
+                    predecessors[insertPositions[dependency.first]++] = dependency.second;
+                }
+            }
+            
+            void ParallelSccScheduler::execute(uint64_t numberOfWorkers, std::function<void(uint64_t sccIndex, uint64_t workerIndex)> const& processScc) const {
+                uint64_t numberOfSccs = sccSizes.size();
+                if (numberOfSccs == 0) {
+                    return;
+                }
+                
+                // The number of unprocessed successors of each SCC.
+                std::unique_ptr<std::atomic<uint64_t>[]> remainingSuccessors(new std::atomic<uint64_t>[numberOfSccs]);
+                
+                // The following data is protected by the mutex.
+                std::mutex mutex;
+                std::condition_variable readyOrDone;
+                std::deque<uint64_t> readySccs;
+                uint64_t unprocessedSccs = numberOfSccs;
+                bool aborted = false;
+                
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    remainingSuccessors[sccIndex] = successorCounts[sccIndex];
+                    if (successorCounts[sccIndex] == 0) {
+                        readySccs.push_back(sccIndex);
+                    }
+                }
+                
+                storm::utility::getThreadPool().execute(numberOfWorkers, [&] (uint64_t workerIndex) {
+                    std::vector<uint64_t> batch;
+                    std::vector<uint64_t> newlyReadySccs;
+                    while (true) {
+                        // Take a batch of ready SCCs from the queue.
+                        batch.clear();
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            readyOrDone.wait(lock, [&] { return !readySccs.empty() || unprocessedSccs == 0 || aborted; });
+                            if (unprocessedSccs == 0 || aborted) {
+                                return;
+                            }
+                            uint64_t batchStates = 0;
+                            do {
+                                batchStates += sccSizes[readySccs.front()];
+                                batch.push_back(readySccs.front());
+                                readySccs.pop_front();
+                            } while (!readySccs.empty() && batchStates + sccSizes[readySccs.front()] <= batchSize);
+                        }
+                        
+                        // Process the batch. Predecessors whose successors have all been processed become ready.
+                        newlyReadySccs.clear();
+                        try {
+                            for (auto const& sccIndex : batch) {
+                                processScc(sccIndex, workerIndex);
+                                for (uint64_t predecessorIndex = predecessorIndications[sccIndex]; predecessorIndex < predecessorIndications[sccIndex + 1]; ++predecessorIndex) {
+                                    uint64_t const& predecessor = predecessors[predecessorIndex];
+                                    if (remainingSuccessors[predecessor].fetch_sub(1) == 1) {
+                                        newlyReadySccs.push_back(predecessor);
+                                    }
+                                }
+                            }
+                        } catch (...) {
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                aborted = true;
+                            }
+                            readyOrDone.notify_all();
+                            throw;
+                        }
+                        
+                        bool done;
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            readySccs.insert(readySccs.end(), newlyReadySccs.begin(), newlyReadySccs.end());
+                            unprocessedSccs -= batch.size();
+                            done = unprocessedSccs == 0;
+                        }
+                        if (done || newlyReadySccs.size() > 1) {
+                            readyOrDone.notify_all();
+                        } else if (newlyReadySccs.size() == 1) {
+                            readyOrDone.notify_one();
+                        }
+                    }
+                });
+            }
+            
+            uint64_t ParallelSccScheduler::getNumberOfInitiallyReadySccs() const {
+                uint64_t result = 0;
+                for (auto const& count : successorCounts) {
+                    if (count == 0) {
+                        ++result;
+                    }
+                }
+                return result;
+            }
+            
+            template ParallelSccScheduler::ParallelSccScheduler(storm::storage::SparseMatrix<double> const& matrix, storm::storage::CompactSccDecomposition<double> const& sccDecomposition, uint64_t batchSize);
+#ifdef STORM_HAVE_CARL
+            template ParallelSccScheduler::ParallelSccScheduler(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix, storm::storage::CompactSccDecomposition<storm::RationalNumber> const& sccDecomposition, uint64_t batchSize);
+            template ParallelSccScheduler::ParallelSccScheduler(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix, storm::storage::CompactSccDecomposition<storm::RationalFunction> const& sccDecomposition, uint64_t batchSize);
+#endif
+        }
+    }
+}
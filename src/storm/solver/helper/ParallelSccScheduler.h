@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+    
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+        
+        template<typename ValueType>
+        class CompactSccDecomposition;
+    }
+    
+    namespace solver {
+        namespace helper {
+            
+            /*!
+             * Schedules the SCCs of a system on a thread pool such that an SCC is only processed once all SCCs that are
+             * reachable from it have been processed. Independent SCCs are processed concurrently. SCCs whose
+             * dependencies are resolved are kept in a shared queue, from which the workers take several small SCCs at
+             * once to avoid a scheduling step per state in the acyclic parts of the system.
+             */
+            class ParallelSccScheduler {
+            public:
+                
+                /*!
+                 * Creates the dependency graph of the SCCs.
+                 *
+                 * @param matrix The matrix of the system whose row groups correspond to the states.
+                 * @param sccDecomposition The SCC decomposition of the system.
+                 * @param batchSize The number of states up to which SCCs are processed together as one task.
+                 */
+                template<typename ValueType>
+                ParallelSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::CompactSccDecomposition<ValueType> const& sccDecomposition, uint64_t batchSize);
+                
+                /*!
+                 * Processes all SCCs using the given number of workers of the shared thread pool. The processing function
+                 * is called with the index of the SCC (within the decomposition) and the index of the calling worker,
+                 * which is smaller than the number of workers. No two calls with the same worker index run concurrently.
+                 * If the processing function throws, no further SCCs are scheduled and the exception is rethrown.
+                 */
+                void execute(uint64_t numberOfWorkers, std::function<void(uint64_t sccIndex, uint64_t workerIndex)> const& processScc) const;
+                
+                /*!
+                 * Retrieves the number of SCCs that do not depend on any other SCC and thus can be processed right away.
+                 */
+                uint64_t getNumberOfInitiallyReadySccs() const;
+            
+            private:
+                // The number of states of each SCC.
+                std::vector<uint64_t> sccSizes;
+                
+                // The number of distinct SCCs (other than itself) that are reachable from each SCC in one step.
+                std::vector<uint64_t> successorCounts;
+                
+                // The SCCs that can reach SCC i in one step are stored in predecessors[predecessorIndications[i]]
+                // to predecessors[predecessorIndications[i + 1] - 1].
+                std::vector<uint64_t> predecessorIndications;
+                std::vector<uint64_t> predecessors;
+                
+                // The number of states up to which SCCs are grouped into one task.
+                uint64_t batchSize;
+            };
+        }
+    }
+}
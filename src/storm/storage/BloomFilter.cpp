@@ -0,0 +1,51 @@
+#include "storm/storage/BloomFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace storm {
+    namespace storage {
+        
+        BloomFilter::BloomFilter(uint64_t expectedNumberOfKeys, uint64_t bitsPerKey) : bits(std::max<uint64_t>(expectedNumberOfKeys * bitsPerKey, 64)), numberOfHashFunctions(std::max<uint64_t>(1, static_cast<uint64_t>(std::round(static_cast<double>(bitsPerKey) * std::log(2.0))))), capacity(expectedNumberOfKeys), numberOfKeys(0) {
+            // Intentionally left empty.
+        }
+        
+        void BloomFilter::add(storm::storage::BitVector const& key) {
+            std::pair<uint64_t, uint64_t> hashes = hash(key);
+            for (uint64_t i = 0; i < numberOfHashFunctions; ++i) {
+                bits.set((hashes.first + i * hashes.second) % bits.size());
+            }
+            ++numberOfKeys;
+        }
+        
+        bool BloomFilter::mayContain(storm::storage::BitVector const& key) const {
+            std::pair<uint64_t, uint64_t> hashes = hash(key);
+            for (uint64_t i = 0; i < numberOfHashFunctions; ++i) {
+                if (!bits.get((hashes.first + i * hashes.second) % bits.size())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        void BloomFilter::clear() {
+            bits.clear();
+            numberOfKeys = 0;
+        }
+        
+        uint64_t BloomFilter::getCapacity() const {
+            return capacity;
+        }
+        
+        uint64_t BloomFilter::getNumberOfKeys() const {
+            return numberOfKeys;
+        }
+        
+        std::pair<uint64_t, uint64_t> BloomFilter::hash(storm::storage::BitVector const& key) const {
+            // The second hash must not be zero, as otherwise all positions of the key coincide.
+            return std::make_pair(static_cast<uint64_t>(FNV1aBitVectorHash()(key)), static_cast<uint64_t>(std::hash<storm::storage::BitVector>()(key)) | 1ull);
+        }
+    
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef STORM_STORAGE_BLOOMFILTER_H_
+#define STORM_STORAGE_BLOOMFILTER_H_
+
+#include <cstdint>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        
+        /*!
+         * A bloom filter over bit vectors, i.e. a set that may report false positives but no false negatives. The
+         * positions of a key are obtained by double hashing, so a key is only hashed twice regardless of the number of
+         * hash functions.
+         */
+        class BloomFilter {
+        public:
+            /*!
+             * Creates an empty filter that is dimensioned for the given number of keys.
+             *
+             * @param expectedNumberOfKeys The number of keys for which the filter is dimensioned.
+             * @param bitsPerKey The number of bits the filter uses per (expected) key. Together with the number of
+             * keys, this determines the false positive rate (roughly 1% for ten bits per key).
+             */
+            BloomFilter(uint64_t expectedNumberOfKeys = 1000, uint64_t bitsPerKey = 10);
+            
+            /*!
+             * Adds the given key to the filter.
+             */
+            void add(storm::storage::BitVector const& key);
+            
+            /*!
+             * Retrieves whether the given key may have been added to the filter. If this returns false, the key
+             * was definitely not added.
+             */
+            bool mayContain(storm::storage::BitVector const& key) const;
+            
+            /*!
+             * Removes all keys from the filter.
+             */
+            void clear();
+            
+            /*!
+             * Retrieves the number of keys for which the filter is dimensioned.
+             */
+            uint64_t getCapacity() const;
+            
+            /*!
+             * Retrieves the number of keys that were added to the filter (including duplicates).
+             */
+            uint64_t getNumberOfKeys() const;
+        
+        private:
+            /*!
+             * Computes the two hash values of the given key from which the positions of the key are derived.
+             */
+            std::pair<uint64_t, uint64_t> hash(storm::storage::BitVector const& key) const;
+            
+            // The bits of the filter.
+            storm::storage::BitVector bits;
+            
+            // The number of positions that are set for each key.
+            uint64_t numberOfHashFunctions;
+            
+            // The number of keys for which the filter is dimensioned.
+            uint64_t capacity;
+            
+            // The number of keys added to the filter.
+            uint64_t numberOfKeys;
+        };
+    
+    }
+}
+
+#endif /* STORM_STORAGE_BLOOMFILTER_H_ */
@@ -0,0 +1,270 @@
+#include "storm/storage/CompactSccDecomposition.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+        
+        template<typename ValueType>
+        CompactSccDecomposition<ValueType>::Scc::Scc(const_iterator first, const_iterator last, bool trivial) : first(first), last(last), trivial(trivial) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        typename CompactSccDecomposition<ValueType>::const_iterator CompactSccDecomposition<ValueType>::Scc::begin() const {
+            return first;
+        }
+        
+        template<typename ValueType>
+        typename CompactSccDecomposition<ValueType>::const_iterator CompactSccDecomposition<ValueType>::Scc::end() const {
+            return last;
+        }
+        
+        template<typename ValueType>
+        uint64_t CompactSccDecomposition<ValueType>::Scc::size() const {
+            return std::distance(first, last);
+        }
+        
+        template<typename ValueType>
+        bool CompactSccDecomposition<ValueType>::Scc::isTrivial() const {
+            return trivial;
+        }
+        
+        template<typename ValueType>
+        CompactSccDecomposition<ValueType>::CompactSccDecomposition() : sccIndications(1, 0) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        CompactSccDecomposition<ValueType>::CompactSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t* longestChainSize) {
+            performSccDecomposition(transitionMatrix, nullptr, dropNaiveSccs, onlyBottomSccs, longestChainSize);
+        }
+        
+        template<typename ValueType>
+        CompactSccDecomposition<ValueType>::CompactSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t* longestChainSize) {
+            performSccDecomposition(transitionMatrix, &subsystem, dropNaiveSccs, onlyBottomSccs, longestChainSize);
+        }
+        
+        template<typename ValueType>
+        uint64_t CompactSccDecomposition<ValueType>::size() const {
+            return sccIndications.size() - 1;
+        }
+        
+        template<typename ValueType>
+        bool CompactSccDecomposition<ValueType>::empty() const {
+            return size() == 0;
+        }
+        
+        template<typename ValueType>
+        typename CompactSccDecomposition<ValueType>::Scc CompactSccDecomposition<ValueType>::getScc(uint64_t index) const {
+            return Scc(states.begin() + sccIndications[index], states.begin() + sccIndications[index + 1], trivialSccs.get(index));
+        }
+        
+        template<typename ValueType>
+        typename CompactSccDecomposition<ValueType>::Scc CompactSccDecomposition<ValueType>::operator[](uint64_t index) const {
+            return getScc(index);
+        }
+        
+        template<typename ValueType>
+        std::vector<typename CompactSccDecomposition<ValueType>::state_type> const& CompactSccDecomposition<ValueType>::getStates() const {
+            return states;
+        }
+        
+        template<typename ValueType>
+        std::vector<uint64_t> const& CompactSccDecomposition<ValueType>::getSccIndications() const {
+            return sccIndications;
+        }
+        
+        template<typename ValueType>
+        void CompactSccDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t* longestChainSize) {
+            uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            STORM_LOG_THROW(subsystem == nullptr || subsystem->size() == numberOfStates, storm::exceptions::InvalidArgumentException, "Invalid size of subsystem.");
+            auto isRelevantTransition = [subsystem] (storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> const& entry) {
+                return (subsystem == nullptr || subsystem->get(entry.getColumn())) && !storm::utility::isZero(entry.getValue());
+            };
+            
+            // Pearce's algorithm stores a single number per state: zero for unvisited states, the DFS index for
+            // states whose SCC is not yet complete and the number of the SCC for all other states. SCC numbers are
+            // assigned downwards starting from the number of states, which keeps them larger than all DFS indices
+            // that are still in use.
+            std::vector<uint64_t> rindex(numberOfStates, 0);
+            storm::storage::BitVector isRoot(numberOfStates, false);
+            storm::storage::BitVector hasSelfLoop(numberOfStates, false);
+            std::vector<state_type> visitedStates;
+            std::vector<std::pair<state_type, typename storm::storage::SparseMatrix<ValueType>::const_iterator>> callStack;
+            uint64_t currentIndex = 1;
+            uint64_t currentSccNumber = numberOfStates;
+            
+            auto startVisit = [&] (state_type const& state) {
+                rindex[state] = currentIndex++;
+                isRoot.set(state, true);
+                callStack.emplace_back(state, transitionMatrix.getRowGroup(state).begin());
+            };
+            
+            for (state_type initialState = 0; initialState < numberOfStates; ++initialState) {
+                if (rindex[initialState] != 0 || (subsystem != nullptr && !subsystem->get(initialState))) {
+                    continue;
+                }
+                
+                startVisit(initialState);
+                while (!callStack.empty()) {
+                    state_type currentState = callStack.back().first;
+                    auto& successorIt = callStack.back().second;
+                    auto successorIte = transitionMatrix.getRowGroup(currentState).end();
+                    
+                    bool visitsSuccessor = false;
+                    for (; successorIt != successorIte; ++successorIt) {
+                        if (!isRelevantTransition(*successorIt)) {
+                            continue;
+                        }
+                        state_type successor = successorIt->getColumn();
+                        if (successor == currentState) {
+                            hasSelfLoop.set(currentState, true);
+                        } else if (rindex[successor] == 0) {
+                            // Visit the successor first. The current transition is inspected again once the successor
+                            // has been visited. Note that this invalidates the reference to the iterator.
+                            startVisit(successor);
+                            visitsSuccessor = true;
+                            break;
+                        } else if (rindex[successor] < rindex[currentState]) {
+                            rindex[currentState] = rindex[successor];
+                            isRoot.set(currentState, false);
+                        }
+                    }
+                    if (visitsSuccessor) {
+                        continue;
+                    }
+                    
+                    // At this point, all successors of the current state have been visited.
+                    callStack.pop_back();
+                    if (isRoot.get(currentState)) {
+                        // The current state is the root of an SCC that consists of all states that were visited after
+                        // it and are not yet assigned to an SCC.
+                        --currentIndex;
+                        while (!visitedStates.empty() && rindex[currentState] <= rindex[visitedStates.back()]) {
+                            rindex[visitedStates.back()] = currentSccNumber;
+                            visitedStates.pop_back();
+                            --currentIndex;
+                        }
+                        rindex[currentState] = currentSccNumber;
+                        --currentSccNumber;
+                    } else {
+                        visitedStates.push_back(currentState);
+                    }
+                }
+            }
+            
+            // SCCs are completed in reverse topological order, which is the order in which they are numbered.
+            uint64_t numberOfSccs = numberOfStates - currentSccNumber;
+            auto getSccIndex = [&rindex, numberOfStates] (state_type const& state) {
+                return numberOfStates - rindex[state];
+            };
+            
+            // Sort the states by their SCC. Filling the SCCs back to front keeps the states of each SCC sorted.
+            sccIndications.assign(numberOfSccs + 1, 0);
+            for (state_type state = 0; state < numberOfStates; ++state) {
+                if (rindex[state] != 0) {
+                    ++sccIndications[getSccIndex(state)];
+                }
+            }
+            for (uint64_t sccIndex = 1; sccIndex < numberOfSccs; ++sccIndex) {
+                sccIndications[sccIndex] += sccIndications[sccIndex - 1];
+            }
+            sccIndications.back() = numberOfSccs == 0 ? 0 : sccIndications[numberOfSccs - 1];
+            states.resize(sccIndications.back());
+            for (state_type state = numberOfStates; state > 0; --state) {
+                if (rindex[state - 1] != 0) {
+                    states[--sccIndications[getSccIndex(state - 1)]] = state - 1;
+                }
+            }
+            
+            trivialSccs = storm::storage::BitVector(numberOfSccs, false);
+            for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                if (sccIndications[sccIndex + 1] - sccIndications[sccIndex] == 1 && !hasSelfLoop.get(states[sccIndications[sccIndex]])) {
+                    trivialSccs.set(sccIndex, true);
+                }
+            }
+            
+            // Inspect the transitions between SCCs if needed. As the SCCs are ordered reverse topologically, the chain
+            // sizes of all successor SCCs are known when an SCC is processed.
+            storm::storage::BitVector bottomSccs;
+            if (longestChainSize != nullptr || onlyBottomSccs) {
+                std::vector<uint64_t> chainSizes;
+                if (longestChainSize != nullptr) {
+                    chainSizes.resize(numberOfSccs, 1);
+                    *longestChainSize = 0;
+                }
+                if (onlyBottomSccs) {
+                    bottomSccs = storm::storage::BitVector(numberOfSccs, true);
+                }
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    for (uint64_t position = sccIndications[sccIndex]; position < sccIndications[sccIndex + 1]; ++position) {
+                        for (auto const& entry : transitionMatrix.getRowGroup(states[position])) {
+                            if (!isRelevantTransition(entry)) {
+                                continue;
+                            }
+                            uint64_t successorSccIndex = getSccIndex(entry.getColumn());
+                            if (successorSccIndex != sccIndex) {
+                                if (longestChainSize != nullptr) {
+                                    chainSizes[sccIndex] = std::max(chainSizes[sccIndex], chainSizes[successorSccIndex] + 1);
+                                }
+                                if (onlyBottomSccs) {
+                                    bottomSccs.set(sccIndex, false);
+                                }
+                            }
+                        }
+                    }
+                    if (longestChainSize != nullptr) {
+                        *longestChainSize = std::max(*longestChainSize, chainSizes[sccIndex]);
+                    }
+                }
+            }
+            
+            // Finally, remove the SCCs that are not to be kept by moving the remaining ones to the front.
+            if (dropNaiveSccs || onlyBottomSccs) {
+                uint64_t newNumberOfSccs = 0;
+                uint64_t newNumberOfStates = 0;
+                storm::storage::BitVector newTrivialSccs(numberOfSccs, false);
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    if ((dropNaiveSccs && trivialSccs.get(sccIndex)) || (onlyBottomSccs && !bottomSccs.get(sccIndex))) {
+                        continue;
+                    }
+                    uint64_t sccStart = sccIndications[sccIndex];
+                    uint64_t sccEnd = sccIndications[sccIndex + 1];
+                    // The states are only ever moved to the left. If they stay in place, the ranges would coincide,
+                    // which std::copy does not allow.
+                    if (newNumberOfStates != sccStart) {
+                        std::copy(states.begin() + sccStart, states.begin() + sccEnd, states.begin() + newNumberOfStates);
+                    }
+                    sccIndications[newNumberOfSccs] = newNumberOfStates;
+                    newTrivialSccs.set(newNumberOfSccs, trivialSccs.get(sccIndex));
+                    newNumberOfStates += sccEnd - sccStart;
+                    ++newNumberOfSccs;
+                }
+                sccIndications[newNumberOfSccs] = newNumberOfStates;
+                sccIndications.resize(newNumberOfSccs + 1);
+                states.resize(newNumberOfStates);
+                newTrivialSccs.resize(newNumberOfSccs);
+                trivialSccs = std::move(newTrivialSccs);
+            }
+        }
+        
+        template class CompactSccDecomposition<double>;
+        template class CompactSccDecomposition<float>;
+#ifdef STORM_HAVE_CARL
+        template class CompactSccDecomposition<storm::RationalNumber>;
+        template class CompactSccDecomposition<storm::RationalFunction>;
+#endif
+    }
+}
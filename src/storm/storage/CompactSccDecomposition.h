@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace storage {
+        
+        template<typename ValueType>
+        class SparseMatrix;
+        
+        /*!
+         * A decomposition of a system into its strongly connected components that stores the states of all SCCs in
+         * one contiguous array (where the states of each SCC are consecutive and sorted) together with the offsets at
+         * which the SCCs begin. Compared to the StronglyConnectedComponentDecomposition, this avoids one heap
+         * allocation per SCC, which dominates the decomposition of systems with many (e.g. millions of singleton) SCCs.
+         *
+         * The SCCs are computed by an iterative variant of Pearce's space-efficient version of Tarjan's algorithm and
+         * are ordered reverse topologically, i.e. states of the ith SCC can only reach states of SCCs j <= i.
+         */
+        template<typename ValueType>
+        class CompactSccDecomposition {
+        public:
+            typedef storm::storage::sparse::state_type state_type;
+            typedef typename std::vector<state_type>::const_iterator const_iterator;
+            
+            /*!
+             * A light-weight view on the states of one SCC of the decomposition.
+             */
+            class Scc {
+            public:
+                Scc(const_iterator first, const_iterator last, bool trivial);
+                
+                const_iterator begin() const;
+                const_iterator end() const;
+                
+                /*!
+                 * Retrieves the number of states of the SCC.
+                 */
+                uint64_t size() const;
+                
+                /*!
+                 * Retrieves whether the SCC is trivial, i.e. consists of a single state without a self-loop.
+                 */
+                bool isTrivial() const;
+            
+            private:
+                const_iterator first;
+                const_iterator last;
+                bool trivial;
+            };
+            
+            /*!
+             * Creates an empty decomposition.
+             */
+            CompactSccDecomposition();
+            
+            /*!
+             * Creates an SCC decomposition of the given system (whose transition relation is given by a sparse matrix).
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
+             * without a self-loop) are to be dropped from the decomposition.
+             * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
+             * leaving the SCC), are kept.
+             * @param longestChainSize If given, the length of the longest chain of SCCs (prior to dropping any SCCs)
+             * is written to this location.
+             */
+            CompactSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, bool dropNaiveSccs = false, bool onlyBottomSccs = false, uint64_t* longestChainSize = nullptr);
+            
+            /*!
+             * Creates an SCC decomposition of the given subsystem in the given system (whose transition relation is
+             * given by a sparse matrix).
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
+             * without a self-loop) are to be dropped from the decomposition.
+             * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
+             * leaving the SCC), are kept.
+             * @param longestChainSize If given, the length of the longest chain of SCCs (prior to dropping any SCCs)
+             * is written to this location.
+             */
+            CompactSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs = false, bool onlyBottomSccs = false, uint64_t* longestChainSize = nullptr);
+            
+            /*!
+             * Retrieves the number of SCCs in the decomposition.
+             */
+            uint64_t size() const;
+            
+            /*!
+             * Retrieves whether the decomposition contains no SCC.
+             */
+            bool empty() const;
+            
+            /*!
+             * Retrieves the SCC with the given index.
+             */
+            Scc getScc(uint64_t index) const;
+            Scc operator[](uint64_t index) const;
+            
+            /*!
+             * Retrieves the states of all SCCs, where the states of the ith SCC are stored at the positions
+             * [getSccIndications()[i], getSccIndications()[i + 1]).
+             */
+            std::vector<state_type> const& getStates() const;
+            
+            /*!
+             * Retrieves the offsets at which the SCCs begin in the vector of states. The last entry is the total number
+             * of states in the decomposition.
+             */
+            std::vector<uint64_t> const& getSccIndications() const;
+        
+        private:
+            /*!
+             * Performs the decomposition of the given subsystem (or the full system if none is given).
+             */
+            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t* longestChainSize);
+            
+            // The states of all SCCs.
+            std::vector<state_type> states;
+            
+            // The offsets at which the SCCs begin in the states vector.
+            std::vector<uint64_t> sccIndications;
+            
+            // Marks the SCCs that are trivial.
+            storm::storage::BitVector trivialSccs;
+        };
+    
+    }
+}
@@ -0,0 +1,237 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <limits>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+        
+        namespace {
+            // By default, no vectorized kernels are available.
+            template<typename ValueType>
+            bool multiplyWithVectorVectorized(kernels::VectorInstructionSet const&, std::vector<uint64_t> const&, std::vector<uint32_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, uint64_t, uint64_t) {
+                return false;
+            }
+            
+            bool multiplyWithVectorVectorized(kernels::VectorInstructionSet const& instructionSet, std::vector<uint64_t> const& rowIndications, std::vector<uint32_t> const& columns, std::vector<double> const& values, std::vector<double> const& x, std::vector<double> const* summand, std::vector<double>& result, uint64_t startRow, uint64_t endRow) {
+                return kernels::multiplyWithVector(instructionSet, rowIndications.data(), columns.data(), values.data(), x.data(), summand ? summand->data() : nullptr, result.data(), startRow, endRow);
+            }
+            
+            template<typename ValueType>
+            bool multiplyAndReduceVectorized(kernels::VectorInstructionSet const&, bool, std::vector<uint64_t> const&, std::vector<uint64_t> const&, std::vector<uint32_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*, uint64_t, uint64_t) {
+                return false;
+            }
+            
+            bool multiplyAndReduceVectorized(kernels::VectorInstructionSet const& instructionSet, bool minimize, std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& rowIndications, std::vector<uint32_t> const& columns, std::vector<double> const& values, std::vector<double> const& x, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices, uint64_t startGroup, uint64_t endGroup) {
+                return kernels::multiplyAndReduce(instructionSet, minimize, rowGroupIndices.data(), rowIndications.data(), columns.data(), values.data(), x.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr, startGroup, endGroup);
+            }
+        }
+        
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, kernels::VectorInstructionSet const& instructionSet) : columnCount(matrix.getColumnCount()), instructionSet(instructionSet) {
+            STORM_LOG_THROW(isApplicable(matrix), storm::exceptions::InvalidArgumentException, "The matrix has too many columns to be represented with 32 bit column indices.");
+            STORM_LOG_THROW(kernels::isSupported(instructionSet), storm::exceptions::InvalidArgumentException, "The instruction set " << instructionSet << " is not supported by this CPU.");
+            
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            columns.reserve(matrix.getEntryCount());
+            values.reserve(matrix.getEntryCount());
+            
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    columns.push_back(static_cast<column_type>(entry.getColumn()));
+                    values.push_back(entry.getValue());
+                }
+                rowIndications.push_back(columns.size());
+            }
+        }
+        
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::isApplicable(SparseMatrix<ValueType> const& matrix) {
+            // The vectorized kernels gather with signed 32 bit indices, so the columns must not use the highest bit.
+            return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+        }
+        
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+        
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+        
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+        
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+        
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::column_type> const& CompactSparseMatrix<ValueType>::getColumns() const {
+            return columns;
+        }
+        
+        template<typename ValueType>
+        std::vector<ValueType> const& CompactSparseMatrix<ValueType>::getValues() const {
+            return values;
+        }
+        
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<ValueType> const* summand, index_type startRow, index_type endRow) const {
+            if (multiplyWithVectorVectorized(instructionSet, rowIndications, columns, values, x, summand, result, startRow, endRow)) {
+                return;
+            }
+            
+            column_type const* columnIt = columns.data() + rowIndications[startRow];
+            ValueType const* valueIt = values.data() + rowIndications[startRow];
+            ValueType const* xData = x.data();
+            
+            for (index_type row = startRow; row < endRow; ++row) {
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (ValueType const* valueIte = values.data() + rowIndications[row + 1]; valueIt != valueIte; ++valueIt, ++columnIt) {
+                    newValue += *valueIt * xData[*columnIt];
+                }
+                result[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            for (index_type row = getRowCount(); row > 0;) {
+                --row;
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                    newValue += values[entry] * x[columns[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, index_type startGroup, index_type endGroup) const {
+            bool minimize = storm::solver::minimize(dir);
+            if (multiplyAndReduceVectorized(instructionSet, minimize, rowGroupIndices, rowIndications, columns, values, x, summand, result, choices, startGroup, endGroup)) {
+                return;
+            }
+            
+            ValueType const* xData = x.data();
+            
+            for (index_type group = startGroup; group < endGroup; ++group) {
+                index_type row = rowGroupIndices[group];
+                index_type rowEnd = rowGroupIndices[group + 1];
+                uint_fast64_t choice = 0;
+                ValueType currentValue = storm::utility::zero<ValueType>();
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (row < rowEnd) {
+                    currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        currentValue += values[entry] * xData[columns[entry]];
+                    }
+                    
+                    for (++row; row < rowEnd; ++row) {
+                        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                        for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                            newValue += values[entry] * xData[columns[entry]];
+                        }
+                        
+                        if ((minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                            currentValue = newValue;
+                            choice = row - rowGroupIndices[group];
+                        }
+                    }
+                }
+                
+                result[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            bool minimize = storm::solver::minimize(dir);
+            
+            for (index_type group = rowGroupIndices.size() - 1; group > 0;) {
+                --group;
+                index_type rowStart = rowGroupIndices[group];
+                index_type row = rowGroupIndices[group + 1];
+                uint_fast64_t choice = 0;
+                ValueType currentValue = storm::utility::zero<ValueType>();
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (rowStart < row) {
+                    --row;
+                    currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        currentValue += values[entry] * x[columns[entry]];
+                    }
+                    choice = row - rowStart;
+                    
+                    while (row > rowStart) {
+                        --row;
+                        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                        for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                            newValue += values[entry] * x[columns[entry]];
+                        }
+                        
+                        if ((minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                            currentValue = newValue;
+                            choice = row - rowStart;
+                        }
+                    }
+                }
+                
+                result[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*, index_type, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyRow(index_type row, std::vector<ValueType> const& x, ValueType& value) const {
+            for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                value += values[entry] * x[columns[entry]];
+            }
+        }
+        
+        template class CompactSparseMatrix<double>;
+#ifdef STORM_HAVE_CARL
+        template class CompactSparseMatrix<storm::RationalNumber>;
+        template class CompactSparseMatrix<storm::RationalFunction>;
+#endif
+    
+    }
+}
@@ -0,0 +1,258 @@
+#include "storm/storage/CompactSparseMatrixKernels.h"
+
+#include <limits>
+
+#include "storm/utility/macros.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define STORM_HAVE_VECTORIZED_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace storage {
+        namespace kernels {
+            
+            std::ostream& operator<<(std::ostream& out, VectorInstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case VectorInstructionSet::Scalar: out << "scalar"; break;
+                    case VectorInstructionSet::Avx2: out << "AVX2"; break;
+                    case VectorInstructionSet::Avx512: out << "AVX-512"; break;
+                }
+                return out;
+            }
+            
+            VectorInstructionSet getVectorInstructionSet() {
+                static const VectorInstructionSet instructionSet = [] () {
+                    VectorInstructionSet result = VectorInstructionSet::Scalar;
+                    if (isSupported(VectorInstructionSet::Avx512)) {
+                        result = VectorInstructionSet::Avx512;
+                    } else if (isSupported(VectorInstructionSet::Avx2)) {
+                        result = VectorInstructionSet::Avx2;
+                    }
+                    STORM_LOG_DEBUG("Using " << result << " kernels for matrix-vector multiplication.");
+                    return result;
+                }();
+                return instructionSet;
+            }
+            
+            bool isSupported(VectorInstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case VectorInstructionSet::Scalar:
+                        return true;
+#ifdef STORM_HAVE_VECTORIZED_KERNELS
+                    case VectorInstructionSet::Avx2:
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                    case VectorInstructionSet::Avx512:
+                        // The AVX-512 kernels also use AVX2 and FMA instructions (which every AVX-512 CPU supports).
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+                    default:
+                        return false;
+                }
+            }
+
+#ifdef STORM_HAVE_VECTORIZED_KERNELS
+            namespace {
+                
+                /*!
+                 * Selects the minimal/maximal value among the given two to four values and returns its index. Ties are
+                 * resolved in favor of the first value, just like the scalar reduction does.
+                 */
+                __attribute__((target("avx2,fma")))
+                static inline uint64_t selectAmongFew(bool minimize, double const* values, uint64_t numberOfValues) {
+                    __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<int64_t>(numberOfValues)), _mm256_setr_epi64x(0, 1, 2, 3));
+                    __m256d padding = _mm256_set1_pd(minimize ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity());
+                    __m256d candidates = _mm256_blendv_pd(padding, _mm256_maskload_pd(values, mask), _mm256_castsi256_pd(mask));
+                    
+                    // Broadcast the best value to all lanes and determine the first lane that holds it.
+                    __m256d best = _mm256_permute2f128_pd(candidates, candidates, 1);
+                    best = minimize ? _mm256_min_pd(candidates, best) : _mm256_max_pd(candidates, best);
+                    __m256d swapped = _mm256_permute_pd(best, 0x5);
+                    best = minimize ? _mm256_min_pd(best, swapped) : _mm256_max_pd(best, swapped);
+                    int equal = _mm256_movemask_pd(_mm256_cmp_pd(candidates, best, _CMP_EQ_OQ)) & ((1 << numberOfValues) - 1);
+                    if (equal != 0) {
+                        return static_cast<uint64_t>(__builtin_ctz(equal));
+                    }
+                    
+                    // Only NaN values can lead here, so we fall back to the semantics of the scalar reduction.
+                    uint64_t result = 0;
+                    for (uint64_t index = 1; index < numberOfValues; ++index) {
+                        if (minimize ? values[index] < values[result] : values[index] > values[result]) {
+                            result = index;
+                        }
+                    }
+                    return result;
+                }
+                
+                struct Avx2Kernel {
+                    /*!
+                     * Computes the scalar product of the given row with x using four-wide gathers. The last (up to)
+                     * three entries are handled with masked loads, so rows with two to four entries need a single
+                     * gather and rows with five to eight entries need two.
+                     */
+                    __attribute__((target("avx2,fma")))
+                    static inline double rowSum(uint32_t const* columns, double const* values, uint64_t entry, uint64_t end, double const* x) {
+                        if (end - entry == 1) {
+                            return values[entry] * x[columns[entry]];
+                        }
+                        __m256d accumulator = _mm256_setzero_pd();
+                        for (; entry + 4 <= end; entry += 4) {
+                            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                            accumulator = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8), accumulator);
+                        }
+                        if (entry < end) {
+                            __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<int64_t>(end - entry)), _mm256_setr_epi64x(0, 1, 2, 3));
+                            __m128i indexMask = _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int32_t>(end - entry)), _mm_setr_epi32(0, 1, 2, 3));
+                            __m128i indices = _mm_maskload_epi32(reinterpret_cast<int const*>(columns + entry), indexMask);
+                            __m256d gathered = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, indices, _mm256_castsi256_pd(mask), 8);
+                            accumulator = _mm256_fmadd_pd(_mm256_maskload_pd(values + entry, mask), gathered, accumulator);
+                        }
+                        __m128d low = _mm256_castpd256_pd128(accumulator);
+                        low = _mm_add_pd(low, _mm256_extractf128_pd(accumulator, 1));
+                        return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+                    }
+                };
+                
+                struct Avx512Kernel {
+                    /*!
+                     * Computes the scalar product of the given row with x using eight-wide gathers. The remaining
+                     * entries are handled with masked loads, so rows with two to eight entries need a single gather.
+                     */
+                    __attribute__((target("avx512f,avx2,fma")))
+                    static inline double rowSum(uint32_t const* columns, double const* values, uint64_t entry, uint64_t end, double const* x) {
+                        if (end - entry == 1) {
+                            return values[entry] * x[columns[entry]];
+                        }
+                        __m512d accumulator = _mm512_setzero_pd();
+                        for (; entry + 8 <= end; entry += 8) {
+                            __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                            accumulator = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i32gather_pd(indices, x, 8), accumulator);
+                        }
+                        if (entry < end) {
+                            __mmask8 mask = static_cast<__mmask8>((1u << (end - entry)) - 1);
+                            __m256i indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns + entry));
+                            __m512d gathered = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, x, 8);
+                            accumulator = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + entry), gathered, accumulator);
+                        }
+                        return _mm512_reduce_add_pd(accumulator);
+                    }
+                };
+                
+                // The loops are forced to be inlined into the functions below, which enables the inlining of the
+                // (target specific) row kernels.
+                template<typename Kernel>
+                __attribute__((always_inline))
+                inline void multiplyWithVectorLoop(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t startRow, uint64_t endRow) {
+                    for (uint64_t row = startRow; row < endRow; ++row) {
+                        double value = rowIndications[row] < rowIndications[row + 1] ? Kernel::rowSum(columns, values, rowIndications[row], rowIndications[row + 1], x) : 0.0;
+                        result[row] = summand ? summand[row] + value : value;
+                    }
+                }
+                
+                template<typename Kernel>
+                __attribute__((always_inline))
+                inline void multiplyAndReduceLoop(bool minimize, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                    for (uint64_t group = startGroup; group < endGroup; ++group) {
+                        uint64_t row = rowGroupIndices[group];
+                        uint64_t rowEnd = rowGroupIndices[group + 1];
+                        uint_fast64_t choice = 0;
+                        double currentValue = 0.0;
+                        
+                        if (rowEnd - row >= 2 && rowEnd - row <= 4) {
+                            // Groups with two to four choices are very common, so their values are reduced in one go.
+                            double rowValues[4];
+                            for (uint64_t index = 0; index < rowEnd - row; ++index) {
+                                rowValues[index] = rowIndications[row + index] < rowIndications[row + index + 1] ? Kernel::rowSum(columns, values, rowIndications[row + index], rowIndications[row + index + 1], x) : 0.0;
+                                if (summand) {
+                                    rowValues[index] += summand[row + index];
+                                }
+                            }
+                            choice = selectAmongFew(minimize, rowValues, rowEnd - row);
+                            currentValue = rowValues[choice];
+                        } else if (row < rowEnd) {
+                            currentValue = rowIndications[row] < rowIndications[row + 1] ? Kernel::rowSum(columns, values, rowIndications[row], rowIndications[row + 1], x) : 0.0;
+                            if (summand) {
+                                currentValue += summand[row];
+                            }
+                            
+                            // Groups with a single choice (i.e. deterministic states) do not need a reduction.
+                            for (uint64_t firstRow = row++; row < rowEnd; ++row) {
+                                double newValue = rowIndications[row] < rowIndications[row + 1] ? Kernel::rowSum(columns, values, rowIndications[row], rowIndications[row + 1], x) : 0.0;
+                                if (summand) {
+                                    newValue += summand[row];
+                                }
+                                if (minimize ? newValue < currentValue : newValue > currentValue) {
+                                    currentValue = newValue;
+                                    choice = row - firstRow;
+                                }
+                            }
+                        }
+                        
+                        result[group] = currentValue;
+                        if (choices) {
+                            choices[group] = choice;
+                        }
+                    }
+                }
+                
+                __attribute__((target("avx2,fma")))
+                void multiplyWithVectorAvx2(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t startRow, uint64_t endRow) {
+                    multiplyWithVectorLoop<Avx2Kernel>(rowIndications, columns, values, x, summand, result, startRow, endRow);
+                }
+                
+                __attribute__((target("avx512f,avx2,fma")))
+                void multiplyWithVectorAvx512(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t startRow, uint64_t endRow) {
+                    multiplyWithVectorLoop<Avx512Kernel>(rowIndications, columns, values, x, summand, result, startRow, endRow);
+                }
+                
+                __attribute__((target("avx2,fma")))
+                void multiplyAndReduceAvx2(bool minimize, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                    multiplyAndReduceLoop<Avx2Kernel>(minimize, rowGroupIndices, rowIndications, columns, values, x, summand, result, choices, startGroup, endGroup);
+                }
+                
+                __attribute__((target("avx512f,avx2,fma")))
+                void multiplyAndReduceAvx512(bool minimize, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                    multiplyAndReduceLoop<Avx512Kernel>(minimize, rowGroupIndices, rowIndications, columns, values, x, summand, result, choices, startGroup, endGroup);
+                }
+            
+            }
+#endif
+            
+            bool multiplyWithVector(VectorInstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t startRow, uint64_t endRow) {
+#ifdef STORM_HAVE_VECTORIZED_KERNELS
+                switch (instructionSet) {
+                    case VectorInstructionSet::Avx512:
+                        multiplyWithVectorAvx512(rowIndications, columns, values, x, summand, result, startRow, endRow);
+                        return true;
+                    case VectorInstructionSet::Avx2:
+                        multiplyWithVectorAvx2(rowIndications, columns, values, x, summand, result, startRow, endRow);
+                        return true;
+                    case VectorInstructionSet::Scalar:
+                        break;
+                }
+#endif
+                return false;
+            }
+            
+            bool multiplyAndReduce(VectorInstructionSet const& instructionSet, bool minimize, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+#ifdef STORM_HAVE_VECTORIZED_KERNELS
+                switch (instructionSet) {
+                    case VectorInstructionSet::Avx512:
+                        multiplyAndReduceAvx512(minimize, rowGroupIndices, rowIndications, columns, values, x, summand, result, choices, startGroup, endGroup);
+                        return true;
+                    case VectorInstructionSet::Avx2:
+                        multiplyAndReduceAvx2(minimize, rowGroupIndices, rowIndications, columns, values, x, summand, result, choices, startGroup, endGroup);
+                        return true;
+                    case VectorInstructionSet::Scalar:
+                        break;
+                }
+#endif
+                return false;
+            }
+        
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+namespace storm {
+    namespace storage {
+        namespace kernels {
+            
+            enum class VectorInstructionSet { Scalar, Avx2, Avx512 };
+            
+            std::ostream& operator<<(std::ostream& out, VectorInstructionSet const& instructionSet);
+            
+            /*!
+             * Retrieves the best vector instruction set that is supported by both the CPU and the kernels. The CPU is
+             * only queried upon the first call.
+             */
+            VectorInstructionSet getVectorInstructionSet();
+            
+            /*!
+             * Retrieves whether the kernels for the given instruction set can be used on this CPU.
+             */
+            bool isSupported(VectorInstructionSet const& instructionSet);
+            
+            /*!
+             * Computes result[row] = summand[row] + sum_j values[j] * x[columns[j]] for all rows in [startRow, endRow),
+             * where j ranges over [rowIndications[row], rowIndications[row + 1]). The summand may be null. As the
+             * gathers interpret the columns as signed 32 bit integers, all columns must be at most INT32_MAX.
+             *
+             * The products of a row are accumulated in four (AVX2) or eight (AVX-512) partial sums with fused
+             * multiply-adds, which are added up at the end. The summand is added last. The result may thus differ from
+             * the one of the scalar loop, which adds the products one after another to the summand. For a row with n
+             * entries, the difference is at most 2 * gamma(n + 1) * (|summand[row]| + sum_j |values[j] * x[columns[j]]|),
+             * where gamma(k) = k * u / (1 - k * u) and u is the unit roundoff, as both results are within
+             * gamma(n + 1) times this sum of the exact one.
+             *
+             * @param instructionSet The instruction set of the kernel to use. It must be supported by the CPU.
+             * @return False iff the given instruction set is scalar, in which case nothing is computed.
+             */
+            bool multiplyWithVector(VectorInstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t startRow, uint64_t endRow);
+            
+            /*!
+             * Multiplies the rows of the groups in [startGroup, endGroup) with x (like multiplyWithVector) and reduces
+             * each group to its minimal/maximal value. Ties are resolved in favor of the first row of a group. Empty
+             * groups get the value zero. The summand and choices may be null. As the values of the rows may differ
+             * slightly from the ones of the scalar loop, so may the choices among rows with (almost) equal values.
+             *
+             * @param instructionSet The instruction set of the kernel to use. It must be supported by the CPU.
+             * @return False iff the given instruction set is scalar, in which case nothing is computed.
+             */
+            bool multiplyAndReduce(VectorInstructionSet const& instructionSet, bool minimize, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup);
+        
+        }
+    }
+}
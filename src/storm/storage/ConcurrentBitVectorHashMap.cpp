@@ -0,0 +1,416 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+        
+        namespace {
+            // A slot whose key is currently being inserted is marked by this flag.
+            static const uint64_t busyFlag = 1ull << 63;
+            
+            // The lower bits of a slot store the bucket (plus one, so that empty slots are zero).
+            static const uint64_t bucketBits = 40;
+            static const uint64_t bucketMask = (1ull << bucketBits) - 1;
+            
+            // The bits in between store a part of the hash value (the tag) to avoid most comparisons of keys.
+            static const uint64_t tagMask = ~(busyFlag | bucketMask);
+            
+            // The number of slots that are migrated to the next index in one step.
+            static const uint64_t migrationChunkSize = 256;
+            
+            inline uint64_t getTag(uint64_t hash) {
+                return (hash << bucketBits) & tagMask;
+            }
+        }
+        
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket) : map(map), bucket(bucket) {
+            // Intentionally left empty.
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+            return &map == &other.map && bucket == other.bucket;
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+            return !(*this == other);
+        }
+        
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+            ++bucket;
+            return *this;
+        }
+        
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++bucket;
+            return *this;
+        }
+        
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return map.getBucketAndValue(bucket);
+        }
+        
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Index::Index(uint64_t exponent, Index* previous) : exponent(exponent), slots(new std::atomic<uint64_t>[1ull << exponent]()), previous(previous), numberOfMigrationChunks(0), nextMigrationChunk(0), migratedChunks(0), growing(false), closed(false), activeInsertions(0) {
+            if (previous) {
+                numberOfMigrationChunks = ((1ull << previous->exponent) + migrationChunkSize - 1) / migrationChunkSize;
+            }
+        }
+        
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Chunk::Chunk(uint64_t numberOfBuckets, uint64_t wordsPerBucket) : keys(new uint64_t[numberOfBuckets * wordsPerBucket]), values(new ValueType[numberOfBuckets]) {
+            // Intentionally left empty.
+        }
+        
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerBucket(bucketSize / 64), initialChunkSize(64), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Illegal load factor.");
+            
+            for (auto& chunk : chunks) {
+                chunk.store(nullptr);
+            }
+            while (initialChunkSize < initialSize) {
+                initialChunkSize <<= 1;
+            }
+            
+            // Choose the size of the index such that the initial number of elements does not exceed the load factor.
+            uint64_t exponent = 6;
+            while (loadFactor * (1ull << exponent) < initialSize) {
+                ++exponent;
+            }
+            indices.emplace_back(new Index(exponent, nullptr));
+            currentIndex.store(indices.back().get());
+        }
+        
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            for (auto& chunk : chunks) {
+                delete chunk.load();
+            }
+        }
+        
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load();
+        }
+        
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << currentIndex.load()->exponent;
+        }
+        
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return std::get<0>(findOrAddInternal(key, [&value] (uint64_t) { return value; }));
+        }
+        
+        template<class ValueType, class Hash>
+        std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+            auto result = findOrAddInternal(key, [&value] (uint64_t) { return value; });
+            return std::make_pair(std::get<0>(result), std::get<1>(result));
+        }
+        
+        template<class ValueType, class Hash>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddLazily(storm::storage::BitVector const& key, std::function<ValueType (uint64_t bucket)> const& valueGenerator) {
+            auto result = findOrAddInternal(key, valueGenerator);
+            return std::make_pair(std::get<0>(result), std::get<2>(result));
+        }
+        
+        template<class ValueType, class Hash>
+        template<typename ValueGenerator>
+        std::tuple<ValueType, uint64_t, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddInternal(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator) {
+            uint64_t hash = hasher(key);
+            while (true) {
+                Index* index = currentIndex.load(std::memory_order_acquire);
+                
+                // Every insertion contributes to the migration of the previous index (if any), so the migration is
+                // completed before the index needs to grow again.
+                if (!isMigrated(*index)) {
+                    migrateChunk(*index);
+                }
+                if (numberOfElements.load(std::memory_order_relaxed) + 1 > loadFactor * (1ull << index->exponent)) {
+                    grow(*index);
+                }
+                
+                uint64_t bucket;
+                InsertionResult result = findOrInsertInIndex(*index, key, hash, valueGenerator, bucket);
+                if (result != InsertionResult::Retry) {
+                    auto chunkAndOffset = getChunkAndOffset(bucket, false);
+                    return std::make_tuple(chunkAndOffset.first->values[chunkAndOffset.second], bucket, result == InsertionResult::Inserted);
+                }
+                
+                // The index is being replaced, so we wait for the new one.
+                std::this_thread::yield();
+            }
+        }
+        
+        template<class ValueType, class Hash>
+        template<typename ValueGenerator>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::InsertionResult ConcurrentBitVectorHashMap<ValueType, Hash>::findOrInsertInIndex(Index& index, storm::storage::BitVector const& key, uint64_t hash, ValueGenerator const& valueGenerator, uint64_t& bucket) {
+            // Register the insertion before checking whether the index is closed. As the thread closing the index
+            // does the reverse, at least one of us sees the other.
+            index.activeInsertions.fetch_add(1);
+            if (index.closed.load()) {
+                index.activeInsertions.fetch_sub(1);
+                return InsertionResult::Retry;
+            }
+            
+            // Keys that are still in the previous index must not be inserted again. The previous index is closed,
+            // so it suffices to check it once.
+            if (!isMigrated(index) && findInIndex(*index.previous, key, hash, bucket)) {
+                index.activeInsertions.fetch_sub(1);
+                return InsertionResult::Found;
+            }
+            
+            uint64_t tag = getTag(hash);
+            uint64_t mask = (1ull << index.exponent) - 1;
+            uint64_t position = hash >> (64 - index.exponent);
+            for (uint64_t step = 0; step <= mask; ++step) {
+                std::atomic<uint64_t>& slot = index.slots[position];
+                uint64_t content = slot.load(std::memory_order_acquire);
+                
+                // Try to claim an empty slot. If another thread was faster, the content is updated and we treat the
+                // slot like any other occupied slot.
+                if (content == 0 && slot.compare_exchange_strong(content, busyFlag | tag)) {
+                    bucket = numberOfElements.fetch_add(1);
+                    STORM_LOG_ASSERT(bucket < bucketMask, "Too many elements in hash map.");
+                    auto chunkAndOffset = getChunkAndOffset(bucket, true);
+                    uint64_t* keyWords = chunkAndOffset.first->keys.get() + chunkAndOffset.second * wordsPerBucket;
+                    for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                        keyWords[word] = word * 64 < key.size() ? key.getAsInt(word * 64, 64) : 0;
+                    }
+                    chunkAndOffset.first->values[chunkAndOffset.second] = valueGenerator(bucket);
+                    
+                    // Publish the key to the other threads.
+                    slot.store(tag | (bucket + 1), std::memory_order_release);
+                    index.activeInsertions.fetch_sub(1);
+                    return InsertionResult::Inserted;
+                }
+                
+                if ((content & tagMask) == tag) {
+                    // If the same key is being inserted by another thread, we need to wait for it to be complete.
+                    while (content & busyFlag) {
+                        std::this_thread::yield();
+                        content = slot.load(std::memory_order_acquire);
+                    }
+                    if (matches((content & bucketMask) - 1, key)) {
+                        bucket = (content & bucketMask) - 1;
+                        index.activeInsertions.fetch_sub(1);
+                        return InsertionResult::Found;
+                    }
+                }
+                
+                position = (position + 1) & mask;
+            }
+            
+            // The index is full, so it needs to be replaced.
+            index.activeInsertions.fetch_sub(1);
+            return InsertionResult::Retry;
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::findInIndex(Index const& index, storm::storage::BitVector const& key, uint64_t hash, uint64_t& bucket) const {
+            uint64_t tag = getTag(hash);
+            uint64_t mask = (1ull << index.exponent) - 1;
+            uint64_t position = hash >> (64 - index.exponent);
+            for (uint64_t step = 0; step <= mask; ++step) {
+                uint64_t content = index.slots[position].load(std::memory_order_acquire);
+                if (content == 0) {
+                    return false;
+                }
+                if ((content & tagMask) == tag) {
+                    while (content & busyFlag) {
+                        std::this_thread::yield();
+                        content = index.slots[position].load(std::memory_order_acquire);
+                    }
+                    if (matches((content & bucketMask) - 1, key)) {
+                        bucket = (content & bucketMask) - 1;
+                        return true;
+                    }
+                }
+                position = (position + 1) & mask;
+            }
+            return false;
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key, uint64_t& bucket) const {
+            uint64_t hash = hasher(key);
+            Index const* index = currentIndex.load(std::memory_order_acquire);
+            
+            // Whether the migration is completed needs to be determined before searching the current index, because
+            // otherwise a key might be migrated in between.
+            bool migrated = isMigrated(*index);
+            if (findInIndex(*index, key, hash, bucket)) {
+                return true;
+            }
+            return !migrated && findInIndex(*index->previous, key, hash, bucket);
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::isMigrated(Index const& index) const {
+            return index.previous == nullptr || index.migratedChunks.load(std::memory_order_acquire) == index.numberOfMigrationChunks;
+        }
+        
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::migrateChunk(Index& index) {
+            uint64_t chunk = index.nextMigrationChunk.fetch_add(1);
+            if (chunk >= index.numberOfMigrationChunks) {
+                return;
+            }
+            
+            // As the previous index is closed, its slots do not change anymore. Also, the keys in there are not
+            // inserted into the current index by other threads, so we can just take the first free slot.
+            Index const& previous = *index.previous;
+            uint64_t mask = (1ull << index.exponent) - 1;
+            uint64_t end = std::min<uint64_t>((chunk + 1) * migrationChunkSize, 1ull << previous.exponent);
+            for (uint64_t previousPosition = chunk * migrationChunkSize; previousPosition < end; ++previousPosition) {
+                uint64_t content = previous.slots[previousPosition].load(std::memory_order_acquire);
+                if (content == 0) {
+                    continue;
+                }
+                uint64_t position = hasher(getKey((content & bucketMask) - 1)) >> (64 - index.exponent);
+                while (true) {
+                    uint64_t expected = 0;
+                    if (index.slots[position].compare_exchange_strong(expected, content)) {
+                        break;
+                    }
+                    position = (position + 1) & mask;
+                }
+            }
+            index.migratedChunks.fetch_add(1, std::memory_order_release);
+        }
+        
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::grow(Index& index) {
+            bool expected = false;
+            if (index.growing.load() || !index.growing.compare_exchange_strong(expected, true)) {
+                return;
+            }
+            
+            // The previous index needs to be migrated completely, as the new index only refers to this one.
+            while (!isMigrated(index)) {
+                migrateChunk(index);
+                if (!isMigrated(index)) {
+                    std::this_thread::yield();
+                }
+            }
+            
+            STORM_LOG_TRACE("Increasing size of concurrent hash map index from " << (1ull << index.exponent) << " to " << (1ull << (index.exponent + 1)) << ".");
+            std::unique_ptr<Index> newIndex(new Index(index.exponent + 1, &index));
+            
+            // Close the index and wait until all running insertions are completed. Afterwards, the index does not
+            // change anymore and the new index can be published.
+            index.closed.store(true);
+            while (index.activeInsertions.load() != 0) {
+                std::this_thread::yield();
+            }
+            indices.push_back(std::move(newIndex));
+            currentIndex.store(indices.back().get(), std::memory_order_release);
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::matches(uint64_t bucket, storm::storage::BitVector const& key) const {
+            auto chunkAndOffset = getChunkAndOffset(bucket, false);
+            uint64_t const* keyWords = chunkAndOffset.first->keys.get() + chunkAndOffset.second * wordsPerBucket;
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                if (keyWords[word] != (word * 64 < key.size() ? key.getAsInt(word * 64, 64) : 0)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        template<class ValueType, class Hash>
+        storm::storage::BitVector ConcurrentBitVectorHashMap<ValueType, Hash>::getKey(uint64_t bucket) const {
+            auto chunkAndOffset = getChunkAndOffset(bucket, false);
+            uint64_t const* keyWords = chunkAndOffset.first->keys.get() + chunkAndOffset.second * wordsPerBucket;
+            storm::storage::BitVector result(bucketSize);
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                result.setFromInt(word * 64, 64, keyWords[word]);
+            }
+            return result;
+        }
+        
+        template<class ValueType, class Hash>
+        std::pair<typename ConcurrentBitVectorHashMap<ValueType, Hash>::Chunk*, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::getChunkAndOffset(uint64_t bucket, bool create) const {
+            // Chunk i holds the buckets from initialChunkSize * (2^i - 1) to initialChunkSize * (2^(i+1) - 1) - 1.
+            uint64_t quotient = bucket / initialChunkSize + 1;
+            uint64_t chunkIndex = 0;
+            while (quotient >>= 1) {
+                ++chunkIndex;
+            }
+            uint64_t offset = bucket - initialChunkSize * ((1ull << chunkIndex) - 1);
+            
+            Chunk* chunk = chunks[chunkIndex].load(std::memory_order_acquire);
+            if (chunk == nullptr && create) {
+                // If several threads create the chunk at the same time, only one of them succeeds.
+                std::unique_ptr<Chunk> newChunk(new Chunk(initialChunkSize << chunkIndex, wordsPerBucket));
+                Chunk* expected = nullptr;
+                if (chunks[chunkIndex].compare_exchange_strong(expected, newChunk.get())) {
+                    chunk = newChunk.release();
+                } else {
+                    chunk = expected;
+                }
+            }
+            return std::make_pair(chunk, offset);
+        }
+        
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            return std::make_pair(getKey(bucket), getValue(bucket));
+        }
+        
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            uint64_t bucket;
+            bool found = findBucket(key, bucket);
+            STORM_LOG_ASSERT(found, "Unknown key.");
+            return getValue(bucket);
+        }
+        
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+            auto chunkAndOffset = getChunkAndOffset(bucket, false);
+            return chunkAndOffset.first->values[chunkAndOffset.second];
+        }
+        
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            uint64_t bucket;
+            return findBucket(key, bucket);
+        }
+        
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+            return const_iterator(*this, 0);
+        }
+        
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+            return const_iterator(*this, size());
+        }
+        
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            for (uint64_t bucket = 0; bucket < size(); ++bucket) {
+                auto chunkAndOffset = getChunkAndOffset(bucket, false);
+                ValueType& value = chunkAndOffset.first->values[chunkAndOffset.second];
+                value = remapping(value);
+            }
+        }
+        
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,317 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        
+        /*!
+         * This class represents a hash-map whose keys are bit vectors and that supports concurrent queries and
+         * insertions from several threads. As for BitVectorHashMap, the keys must be bit vectors with a length that is
+         * a multiple of 64 and elements can not be removed.
+         *
+         * The keys and values are stored in an append-only storage, so the position (bucket) at which a key is
+         * stored never changes and the buckets are numbered consecutively in the order in which the keys were
+         * inserted. The keys are found via an index of (open-addressing) slots that are claimed with atomic operations.
+         * If the index becomes too full, a larger index is created and the slots of the old index are migrated
+         * incrementally by subsequent insertions, so there is no point at which the whole map is rehashed at once.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*! Creates an iterator that points to the given bucket of the given map.
+                 *
+                 * @param map The map of the iterator.
+                 * @param bucket The index of the bucket the iterator points to.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+                
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+                
+                // Methods to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++(int);
+                ConcurrentBitVectorHashMapIterator& operator++();
+                
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+            
+            private:
+                // The map this iterator refers to.
+                ConcurrentBitVectorHashMap const& map;
+                
+                // The bucket this iterator points to.
+                uint64_t bucket;
+            };
+            
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+            
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of elements that can be stored before the index needs to grow.
+             * @param loadFactor The load factor that determines at which point the size of the index is increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+            
+            ~ConcurrentBitVectorHashMap();
+            
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+            
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value. This method may be called concurrently.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+            
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value. This method may be called concurrently.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return A pair whose first component is the found value if the key is already contained in the map and
+             * the provided new value otherwise and whose second component is the index of the bucket into which the key
+             * was inserted.
+             */
+            std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+            
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted and mapped to the value obtained by calling the given function with the bucket of the
+             * key. This is useful if concurrently inserting threads need to agree on which of them inserted the key,
+             * e.g. to number the keys consecutively. This method may be called concurrently.
+             *
+             * @param key The key to search or insert.
+             * @param valueGenerator The function that produces the value for a newly inserted key from its bucket.
+             * @return A pair whose first component is the value that the key is mapped to and whose second component
+             * indicates whether the key was inserted by this call.
+             */
+            std::pair<ValueType, bool> findOrAddLazily(storm::storage::BitVector const& key, std::function<ValueType (uint64_t bucket)> const& valueGenerator);
+            
+            /*!
+             * Retrieves the key stored in the given bucket and the value it is mapped to.
+             *
+             * @param bucket The index of the bucket.
+             * @return The content and value of the named bucket.
+             */
+            std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+            
+            /*!
+             * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+             * undefined.
+             *
+             * @return The value associated with the given key (if any).
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+            
+            /*!
+             * Retrieves the value associated with the given bucket.
+             *
+             * @return The value associated with the given bucket.
+             */
+            ValueType getValue(uint64_t bucket) const;
+            
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+            
+            /*!
+             * Retrieves an iterator to the elements of the map. The elements are visited in the order in which they
+             * were inserted. Iterating is only allowed while no other thread inserts elements.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+            
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+            
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores. While other threads
+             * insert elements, this includes elements whose insertion is not yet completed.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+            
+            /*!
+             * Retrieves the capacity of the current index.
+             *
+             * @return The capacity of the current index.
+             */
+            uint64_t capacity() const;
+            
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping. This must not be called
+             * while other threads access the map.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+        
+        private:
+            /*!
+             * An index that maps hash values to the buckets of the map using linear probing. Each slot is either
+             * empty (zero), busy (a key with the tag stored in the slot is currently being inserted) or holds the tag
+             * of the key together with its bucket.
+             */
+            struct Index {
+                Index(uint64_t exponent, Index* previous);
+                
+                // The number of slots is 2^exponent.
+                uint64_t exponent;
+                
+                // The slots of the index.
+                std::unique_ptr<std::atomic<uint64_t>[]> slots;
+                
+                // The (smaller) index whose slots are migrated to this one or null if there is none.
+                Index* previous;
+                
+                // The number of chunks of slots of the previous index and the number of chunks that were already
+                // claimed for migration and whose migration is completed, respectively.
+                uint64_t numberOfMigrationChunks;
+                std::atomic<uint64_t> nextMigrationChunk;
+                std::atomic<uint64_t> migratedChunks;
+                
+                // A flag indicating whether some thread has taken the responsibility to replace this index.
+                std::atomic<bool> growing;
+                
+                // Once an index is closed, no new slots are claimed in it.
+                std::atomic<bool> closed;
+                
+                // The number of insertions that are currently running on this index.
+                std::atomic<uint64_t> activeInsertions;
+            };
+            
+            /*!
+             * A chunk of the storage for the keys and values. Chunk i holds initialChunkSize * 2^i buckets.
+             */
+            struct Chunk {
+                Chunk(uint64_t numberOfBuckets, uint64_t wordsPerBucket);
+                
+                std::unique_ptr<uint64_t[]> keys;
+                std::unique_ptr<ValueType[]> values;
+            };
+            
+            // The possible outcomes of an attempt to insert a key into an index.
+            enum class InsertionResult { Found, Inserted, Retry };
+            
+            /*!
+             * Searches for the given key and inserts it if it is not found. The value of a newly inserted key is
+             * obtained from the given generator.
+             *
+             * @return A tuple consisting of the value, the bucket of the key and whether the key was newly inserted.
+             */
+            template<typename ValueGenerator>
+            std::tuple<ValueType, uint64_t, bool> findOrAddInternal(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator);
+            
+            /*!
+             * Tries to find or insert the key in the given index.
+             */
+            template<typename ValueGenerator>
+            InsertionResult findOrInsertInIndex(Index& index, storm::storage::BitVector const& key, uint64_t hash, ValueGenerator const& valueGenerator, uint64_t& bucket);
+            
+            /*!
+             * Searches for the given key in the given index. If the key is found, its bucket is written to the given
+             * reference.
+             */
+            bool findInIndex(Index const& index, storm::storage::BitVector const& key, uint64_t hash, uint64_t& bucket) const;
+            
+            /*!
+             * Searches for the given key in the current index and, if necessary, the index that is being migrated.
+             */
+            bool findBucket(storm::storage::BitVector const& key, uint64_t& bucket) const;
+            
+            /*!
+             * Migrates one chunk of slots of the previous index of the given index (if there is any left).
+             */
+            void migrateChunk(Index& index);
+            
+            /*!
+             * Checks whether the migration of the previous index of the given index is completed.
+             */
+            bool isMigrated(Index const& index) const;
+            
+            /*!
+             * Replaces the given (current) index by one that is twice as large. If another thread is already
+             * replacing the index, this method returns immediately.
+             */
+            void grow(Index& index);
+            
+            /*!
+             * Checks whether the key stored in the given bucket matches the given key.
+             */
+            bool matches(uint64_t bucket, storm::storage::BitVector const& key) const;
+            
+            /*!
+             * Retrieves the key stored in the given bucket.
+             */
+            storm::storage::BitVector getKey(uint64_t bucket) const;
+            
+            /*!
+             * Retrieves the chunk and the offset within the chunk at which the given bucket is stored.
+             *
+             * @param create If set, a missing chunk is created.
+             */
+            std::pair<Chunk*, uint64_t> getChunkAndOffset(uint64_t bucket, bool create) const;
+            
+            // The load factor determining when the size of the index is increased.
+            double loadFactor;
+            
+            // The size of one bucket.
+            uint64_t bucketSize;
+            
+            // The number of 64-bit words per bucket.
+            uint64_t wordsPerBucket;
+            
+            // The number of buckets of the first chunk of the storage.
+            uint64_t initialChunkSize;
+            
+            // The chunks of the storage of keys and values.
+            mutable std::array<std::atomic<Chunk*>, 48> chunks;
+            
+            // The number of buckets that are in use.
+            std::atomic<uint64_t> numberOfElements;
+            
+            // The index that is currently used.
+            std::atomic<Index*> currentIndex;
+            
+            // All indices that were created. Old indices are kept until the map is destroyed, as other threads might
+            // still be reading them. As the size doubles every time, this at most doubles the memory of the index.
+            std::vector<std::unique_ptr<Index>> indices;
+            
+            // Functor object that is used to perform the actual hashing.
+            Hash hasher;
+        };
+    
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
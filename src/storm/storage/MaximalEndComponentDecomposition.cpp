@@ -7,6 +7,8 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include "storm/utility/ThreadPool.h"
+
 namespace storm {
     namespace storage {
         
@@ -18,27 +20,32 @@ namespace storm {
         template<typename ValueType>
         template<typename RewardModelType>
         MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-            performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+            performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), nullptr, nullptr, 1);
         }
 
         template<typename ValueType>
         MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, nullptr, nullptr, 1);
         }
         
         template<typename ValueType>
         MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, 1);
         }
         
         template<typename ValueType>
-        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
+        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices, uint64_t numberOfThreads) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices, std::is_same<ValueType, double>::value ? numberOfThreads : 1);
+        }
+        
+        template<typename ValueType>
+        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, uint64_t numberOfThreads) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, std::is_same<ValueType, double>::value ? numberOfThreads : 1);
         }
         
         template<typename ValueType>
         MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model, storm::storage::BitVector const& states) {
-            performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states);
+            performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states, nullptr, 1);
         }
         
         template<typename ValueType>
@@ -64,7 +71,78 @@ namespace storm {
         }
         
         template <typename ValueType>
-        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
+        bool MaximalEndComponentDecomposition<ValueType>::removeStatesLeavingSccs(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* choices, StateBlock const& candidate, StronglyConnectedComponentDecomposition<ValueType>& sccs) {
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+            storm::storage::BitVector statesToCheck(numberOfStates);
+            
+            // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
+            // the MEC canditate itself.
+            bool mecChanged = sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < candidate.size());
+            
+            // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
+            for (auto& scc : sccs) {
+                statesToCheck.set(scc.begin(), scc.end());
+                
+                while (!statesToCheck.empty()) {
+                    storm::storage::BitVector statesToRemove(numberOfStates);
+                    
+                    for (auto state : statesToCheck) {
+                        bool keepStateInMEC = false;
+                        
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                            // If the choice is not part of our subsystem, skip it.
+                            if (choices && !choices->get(choice)) {
+                                continue;
+                            }
+                            
+                            bool choiceContainedInMEC = true;
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (storm::utility::isZero(entry.getValue())) {
+                                    continue;
+                                }
+                                    
+                                if (!scc.containsState(entry.getColumn())) {
+                                    choiceContainedInMEC = false;
+                                    break;
+                                }
+                            }
+                            
+                            // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
+                            if (choiceContainedInMEC) {
+                                keepStateInMEC = true;
+                                break;
+                            }
+                        }
+                        
+                        if (!keepStateInMEC) {
+                            statesToRemove.set(state, true);
+                        }
+                    }
+                    
+                    // Now erase the states that have no option to stay inside the MEC with all successors.
+                    mecChanged |= !statesToRemove.empty();
+                    for (uint_fast64_t state : statesToRemove) {
+                        scc.erase(state);
+                    }
+                    
+                    // Now check which states should be reconsidered, because successors of them were removed.
+                    statesToCheck.clear();
+                    for (auto state : statesToRemove) {
+                        for (auto const& entry : backwardTransitions.getRow(state)) {
+                            if (scc.containsState(entry.getColumn())) {
+                                statesToCheck.set(entry.getColumn());
+                            }
+                        }
+                    }
+                }
+            }
+            
+            return mecChanged;
+        }
+        
+        template <typename ValueType>
+        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices, uint64_t numberOfThreads) {
             // Get some data for convenient access.
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
             std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -79,97 +157,79 @@ namespace storm {
                 std::iota(states.begin(), states.end(), 0);
                 endComponentStateSets.emplace_back(states.begin(), states.end(), true);
             }
-            storm::storage::BitVector statesToCheck(numberOfStates);
             
-            for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-                StateBlock const& mec = *mecIterator;
-                
-                // Keep track of whether the MEC changed during this iteration.
-                bool mecChanged = false;
-                
-                // Get an SCC decomposition of the current MEC candidate.
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, mec, true);
-                
-                // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-                // the MEC canditate itself.
-                mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
-                
-                // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-                for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
+            if (numberOfThreads == 1) {
+                for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
+                    StateBlock const& mec = *mecIterator;
                     
-                    while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
-                        
-                        for (auto state : statesToCheck) {
-                            bool keepStateInMEC = false;
-                            
-                            for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                                // If the choice is not part of our subsystem, skip it.
-                                if (choices && !choices->get(choice)) {
-                                    continue;
-                                }
-                                
-                                bool choiceContainedInMEC = true;
-                                for (auto const& entry : transitionMatrix.getRow(choice)) {
-                                    if (storm::utility::isZero(entry.getValue())) {
-                                        continue;
-                                    }
-                                        
-                                    if (!scc.containsState(entry.getColumn())) {
-                                        choiceContainedInMEC = false;
-                                        break;
-                                    }
-                                }
-                                
-                                // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                                if (choiceContainedInMEC) {
-                                    keepStateInMEC = true;
-                                    break;
-                                }
-                            }
-                            
-                            if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
+                    // Get an SCC decomposition of the current MEC candidate and remove the states that cannot stay in their SCC.
+                    StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, mec, true);
+                    bool mecChanged = removeStatesLeavingSccs(transitionMatrix, backwardTransitions, choices, mec, sccs);
+                    
+                    // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
+                    // the list instead.
+                    if (mecChanged) {
+                        for (StronglyConnectedComponent& scc : sccs) {
+                            if (!scc.empty()) {
+                                endComponentStateSets.push_back(std::move(scc));
                             }
                         }
                         
-                        // Now erase the states that have no option to stay inside the MEC with all successors.
-                        mecChanged |= !statesToRemove.empty();
-                        for (uint_fast64_t state : statesToRemove) {
-                            scc.erase(state);
-                        }
+                        std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
+                        ++mecIterator;
+                        endComponentStateSets.erase(eraseIterator);
+                    } else {
+                        // Otherwise, we proceed with the next MEC candidate.
+                        ++mecIterator;
+                    }
+                    
+                } // End of loop over all MEC candidates.
+            } else {
+                // Refine the candidates in rounds. As the candidates of a round are disjoint, they can be refined
+                // concurrently.
+                std::vector<StateBlock> candidates(std::make_move_iterator(endComponentStateSets.begin()), std::make_move_iterator(endComponentStateSets.end()));
+                endComponentStateSets.clear();
+                while (!candidates.empty()) {
+                    std::vector<std::vector<StronglyConnectedComponent>> refinedCandidates(candidates.size());
+                    std::vector<uint_fast8_t> candidateChanged(candidates.size(), false);
+                    bool refineConcurrently = candidates.size() > 1;
+                    
+                    auto refineCandidate = [&] (uint64_t candidateIndex) {
+                        StateBlock const& candidate = candidates[candidateIndex];
+                        
+                        // If there is only one candidate, we let the SCC decomposition use the threads instead.
+                        StronglyConnectedComponentDecomposition<ValueType> sccs = refineConcurrently ? StronglyConnectedComponentDecomposition<ValueType>(transitionMatrix, candidate, true) : StronglyConnectedComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, storm::storage::BitVector(numberOfStates, candidate.begin(), candidate.end()), true, numberOfThreads);
+                        candidateChanged[candidateIndex] = removeStatesLeavingSccs(transitionMatrix, backwardTransitions, choices, candidate, sccs);
                         
-                        // Now check which states should be reconsidered, because successors of them were removed.
-                        statesToCheck.clear();
-                        for (auto state : statesToRemove) {
-                            for (auto const& entry : backwardTransitions.getRow(state)) {
-                                if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
+                        if (candidateChanged[candidateIndex]) {
+                            for (StronglyConnectedComponent& scc : sccs) {
+                                if (!scc.empty()) {
+                                    refinedCandidates[candidateIndex].push_back(std::move(scc));
                                 }
                             }
                         }
+                    };
+                    
+                    if (refineConcurrently) {
+                        storm::utility::getThreadPool().execute(candidates.size(), refineCandidate, numberOfThreads);
+                    } else {
+                        refineCandidate(0);
                     }
-                }
-                
-                // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-                // the list instead.
-                if (mecChanged) {
-                    for (StronglyConnectedComponent& scc : sccs) {
-                        if (!scc.empty()) {
-                            endComponentStateSets.push_back(std::move(scc));
+                    
+                    // Keep the candidates that did not change and collect the candidates of the next round.
+                    std::vector<StateBlock> nextCandidates;
+                    for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                        if (candidateChanged[candidateIndex]) {
+                            for (auto& scc : refinedCandidates[candidateIndex]) {
+                                nextCandidates.push_back(std::move(scc));
+                            }
+                        } else {
+                            endComponentStateSets.push_back(std::move(candidates[candidateIndex]));
                         }
                     }
-                    
-                    std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-                    ++mecIterator;
-                    endComponentStateSets.erase(eraseIterator);
-                } else {
-                    // Otherwise, we proceed with the next MEC candidate.
-                    ++mecIterator;
+                    candidates = std::move(nextCandidates);
                 }
-                
-            } // End of loop over all MEC candidates.
+            }
             
             // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
             // contained in the MEC and store them as actual MECs.
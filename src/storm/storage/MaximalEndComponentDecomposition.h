@@ -3,6 +3,7 @@
 
 #include "storm/storage/Decomposition.h"
 #include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/models/sparse/NondeterministicModel.h"
 
 namespace storm  {
@@ -46,13 +47,29 @@ namespace storm  {
 
             /*
              * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
+             * Note that the order of the MECs may depend on whether multiple threads are used.
              *
              * @param transitionMatrix The transition relation of model to decompose into MECs.
              * @param backwardTransition The reversed transition relation.
              * @param states The states of the subsystem to decompose.
              * @param choices The choices of the subsystem to decompose.
+             * @param numberOfThreads The number of threads to use (zero means the number of hardware threads). Only
+             * decompositions of models with double values use more than one thread.
              */
-            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices);
+            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices, uint64_t numberOfThreads = 1);
+            
+            /*
+             * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix)
+             * using the given number of threads. Note that the order of the MECs may depend on whether multiple threads
+             * are used.
+             *
+             * @param transitionMatrix The transition relation of model to decompose into MECs.
+             * @param backwardTransition The reversed transition relation.
+             * @param states The states of the subsystem to decompose.
+             * @param numberOfThreads The number of threads to use (zero means the number of hardware threads). Only
+             * decompositions of models with double values use more than one thread.
+             */
+            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, uint64_t numberOfThreads);
 
             /*!
              * Creates an MEC decomposition of the given subsystem in the given model.
@@ -95,12 +112,30 @@ namespace storm  {
              * Performs the actual decomposition of the given subsystem in the given model into MECs. As a side-effect
              * this stores the MECs found in the current decomposition.
              *
+             * With more than one thread, the MEC candidates are refined in rounds. The candidates of a round are
+             * disjoint, so they are refined concurrently. If a round consists of a single candidate, its SCCs are
+             * computed by the (parallel) forward-backward algorithm instead.
+             *
              * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
              * @param backwardTransitions The reversed transition relation.
              * @param states The states of the subsystem to decompose.
              * @param choices The choices of the subsystem to decompose.
+             * @param numberOfThreads The number of threads to use.
+             */
+            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices, uint64_t numberOfThreads);
+            
+            /*!
+             * Removes the states from the given SCCs of an MEC candidate that have no choice whose successors all
+             * stay within their SCC (until no more states need to be removed).
+             *
+             * @param transitionMatrix The transition matrix representing the system.
+             * @param backwardTransitions The reversed transition relation.
+             * @param choices If given, only these choices are considered.
+             * @param candidate The MEC candidate.
+             * @param sccs The non-trivial SCCs of the candidate. As a side-effect, states are removed from the SCCs.
+             * @return True iff the candidate is not an MEC, i.e. it needs to be replaced by the (non-empty) SCCs.
              */
-            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr);
+            static bool removeStatesLeavingSccs(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* choices, StateBlock const& candidate, StronglyConnectedComponentDecomposition<ValueType>& sccs);
         };
     }
 }
@@ -21,10 +21,16 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
+#include "storm/exceptions/FileIoException.h"
 
 #include "storm/utility/macros.h"
 
+#include <cstdio>
+#include <fstream>
 #include <iterator>
+#include <type_traits>
+
+#include <boost/filesystem.hpp>
 
 namespace storm {
     namespace storage {
@@ -87,7 +93,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0), spillFile(), numberOfSpilledEntries(0), maximalNumberOfResidentEntries(0) {
             // Prepare the internal storage.
             if (initialRowCountSet) {
                 rowIndications.reserve(initialRowCount + 1);
@@ -105,7 +111,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount() {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount(), spillFile(), numberOfSpilledEntries(0), maximalNumberOfResidentEntries(0) {
             
             lastRow = matrix.rowCount == 0 ? 0 : matrix.rowCount - 1;
             lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
@@ -158,13 +164,18 @@ namespace storm {
                 
                 // If we need to fix the row, do so now.
                 if (fixCurrentRow) {
+                    // The entries of the row that were already written to disk are needed for this.
+                    if (rowIndications.back() < numberOfSpilledEntries) {
+                        loadSpilledEntries(rowIndications.back());
+                    }
+                    
                     // First, we sort according to columns.
-                    std::sort(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    std::sort(columnsAndValues.begin() + (rowIndications.back() - numberOfSpilledEntries), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() < b.getColumn();
                     });
                     
                     // Then, we eliminate possible duplicate entries.
-                    auto it = std::unique(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    auto it = std::unique(columnsAndValues.begin() + (rowIndications.back() - numberOfSpilledEntries), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() == b.getColumn();
                     });
                     
@@ -176,6 +187,12 @@ namespace storm {
                         columnsAndValues.resize(columnsAndValues.size() - elementsToRemove);
                     }
                 }
+                
+                // If there are too many entries in memory, all but the last one (which may still be summed up with the
+                // next entry) are written to disk. This also applies within a row, so long rows are bounded as well.
+                if (spillFile.isSet() && columnsAndValues.size() > maximalNumberOfResidentEntries) {
+                    spillEntries(columnsAndValues.size() - 1);
+                }
             }
             
             // In case we did not expect this value, we throw an exception.
@@ -264,6 +281,10 @@ namespace storm {
                 }
             }
             
+            if (numberOfSpilledEntries > 0) {
+                loadSpilledEntries();
+            }
+            
             return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
         }
         
@@ -312,10 +333,8 @@ namespace storm {
         void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
             index_type maxColumn = 0;
             
-            for (index_type row = 0; row < rowIndications.size(); ++row) {
+            auto replaceColumnsOfRow = [&] (typename std::vector<MatrixEntry<index_type, value_type>>::iterator startRow, typename std::vector<MatrixEntry<index_type, value_type>>::iterator endRow) {
                 bool changed = false;
-                auto startRow = std::next(columnsAndValues.begin(), rowIndications[row]);
-                auto endRow = row < rowIndications.size()-1 ? std::next(columnsAndValues.begin(), rowIndications[row+1]) : columnsAndValues.end();
                 for (auto entry = startRow; entry != endRow; ++entry) {
                     if (entry->getColumn() >= offset) {
                         // Change column
@@ -336,12 +355,88 @@ namespace storm {
                                                         return a.getColumn() < b.getColumn();
                                                     }), "Columns not sorted.");
                 }
+            };
+            
+            index_type row = 0;
+            if (numberOfSpilledEntries > 0) {
+                // A row whose entries were only partly written to disk is read back completely, so that it can be sorted.
+                auto straddlingRow = std::upper_bound(rowIndications.begin(), rowIndications.end(), numberOfSpilledEntries);
+                if (straddlingRow != rowIndications.begin() && *(straddlingRow - 1) < numberOfSpilledEntries && (straddlingRow != rowIndications.end() || currentEntryCount > numberOfSpilledEntries)) {
+                    loadSpilledEntries(*(straddlingRow - 1));
+                }
+            }
+            if (numberOfSpilledEntries > 0) {
+                // The rows whose entries were written to disk are rewritten one at a time.
+                std::string const& spillFileName = spillFile.getName();
+                std::string rewrittenFileName = spillFileName + ".tmp";
+                std::ifstream in(spillFileName, std::ios::binary);
+                std::ofstream out(rewrittenFileName, std::ios::binary);
+                std::vector<MatrixEntry<index_type, value_type>> rowEntries;
+                for (; row < rowIndications.size() && rowIndications[row] < numberOfSpilledEntries; ++row) {
+                    index_type endRow = row < rowIndications.size() - 1 ? rowIndications[row + 1] : numberOfSpilledEntries;
+                    rowEntries.resize(endRow - rowIndications[row]);
+                    in.read(reinterpret_cast<char*>(rowEntries.data()), rowEntries.size() * sizeof(MatrixEntry<index_type, value_type>));
+                    replaceColumnsOfRow(rowEntries.begin(), rowEntries.end());
+                    out.write(reinterpret_cast<char const*>(rowEntries.data()), rowEntries.size() * sizeof(MatrixEntry<index_type, value_type>));
+                }
+                STORM_LOG_THROW(in && out, storm::exceptions::FileIoException, "Unable to rewrite the entries of the matrix in file '" << spillFileName << "'.");
+                in.close();
+                out.close();
+                STORM_LOG_THROW(std::rename(rewrittenFileName.c_str(), spillFileName.c_str()) == 0, storm::exceptions::FileIoException, "Unable to replace file '" << spillFileName << "'.");
+            }
+            
+            for (; row < rowIndications.size(); ++row) {
+                auto startRow = std::next(columnsAndValues.begin(), rowIndications[row] - numberOfSpilledEntries);
+                auto endRow = row < rowIndications.size()-1 ? std::next(columnsAndValues.begin(), rowIndications[row+1] - numberOfSpilledEntries) : columnsAndValues.end();
+                replaceColumnsOfRow(startRow, endRow);
             }
             
             highestColumn = maxColumn;
             lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues[columnsAndValues.size() - 1].getColumn();
         }
         
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::spillEntriesToDisk(std::string const& directory, index_type maximalNumberOfResidentEntries) {
+            STORM_LOG_THROW(std::is_trivially_copyable<value_type>::value, storm::exceptions::NotSupportedException, "Writing the entries of the matrix to disk is not supported for this value type.");
+            STORM_LOG_THROW(currentEntryCount == 0, storm::exceptions::InvalidStateException, "Writing the entries of the matrix to disk must be enabled before adding entries.");
+            spillFile = TemporaryFile(directory, "storm-matrix-%%%%-%%%%-%%%%-%%%%.bin");
+            this->maximalNumberOfResidentEntries = std::max<index_type>(maximalNumberOfResidentEntries, 1);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::spillEntries(index_type numberOfEntries) {
+            std::ofstream out(spillFile.getName(), std::ios::binary | std::ios::app);
+            out.write(reinterpret_cast<char const*>(columnsAndValues.data()), numberOfEntries * sizeof(MatrixEntry<index_type, value_type>));
+            STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Unable to write the entries of the matrix to file '" << spillFile.getName() << "'.");
+            numberOfSpilledEntries += numberOfEntries;
+            
+            // Keep the capacity, as it is needed again for the next entries.
+            columnsAndValues.erase(columnsAndValues.begin(), columnsAndValues.begin() + numberOfEntries);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::loadSpilledEntries(index_type firstEntry) {
+            index_type numberOfLoadedEntries = numberOfSpilledEntries - firstEntry;
+            std::vector<MatrixEntry<index_type, value_type>> entries;
+            entries.reserve(numberOfLoadedEntries + columnsAndValues.size());
+            entries.resize(numberOfLoadedEntries);
+            {
+                std::ifstream in(spillFile.getName(), std::ios::binary);
+                in.seekg(firstEntry * sizeof(MatrixEntry<index_type, value_type>));
+                in.read(reinterpret_cast<char*>(entries.data()), numberOfLoadedEntries * sizeof(MatrixEntry<index_type, value_type>));
+                STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Unable to read the entries of the matrix from file '" << spillFile.getName() << "'.");
+            }
+            if (firstEntry == 0) {
+                spillFile.remove();
+            } else {
+                boost::filesystem::resize_file(spillFile.getName(), firstEntry * sizeof(MatrixEntry<index_type, value_type>));
+            }
+            
+            entries.insert(entries.end(), columnsAndValues.begin(), columnsAndValues.end());
+            columnsAndValues = std::move(entries);
+            numberOfSpilledEntries = firstEntry;
+        }
+        
         template<typename ValueType>
         SparseMatrix<ValueType>::rows::rows(iterator begin, index_type entryCount) : beginIterator(begin), entryCount(entryCount) {
             // Intentionally left empty.
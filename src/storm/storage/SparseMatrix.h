@@ -6,11 +6,13 @@
 #include <cstdint>
 #include <vector>
 #include <iterator>
+#include <string>
 
 #include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/TemporaryFile.h"
 
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
@@ -242,8 +244,35 @@ namespace storm {
              * @param offset Offset to add to each id in vector index.
              */
             void replaceColumns(std::vector<index_type> const& replacements, index_type offset);
+            
+            /*!
+             * Lets the builder write its entries to a temporary file in the given directory whenever it holds more than
+             * the given number of entries in memory. Only the most recently added entry is kept in memory then, so this
+             * also bounds the memory of a single long row. The entries are read back (into storage of the exact size)
+             * when the matrix is built, at which point the file is removed. Copies of the builder get their own copy of
+             * the file. This is only supported for value types that can be copied bytewise and must be requested
+             * before the first entry is added.
+             *
+             * @param directory The directory in which to create the temporary file.
+             * @param maximalNumberOfResidentEntries The number of entries that are held in memory before they are
+             * written to the file.
+             */
+            void spillEntriesToDisk(std::string const& directory, index_type maximalNumberOfResidentEntries);
                         
         private:
+            /*!
+             * Appends the given number of entries from the front of the entries held in memory to the temporary file
+             * and releases them.
+             */
+            void spillEntries(index_type numberOfEntries);
+            
+            /*!
+             * Reads the entries from the given one on from the temporary file and places them in front of the entries
+             * held in memory. If all entries are read, the file is removed.
+             */
+            void loadSpilledEntries(index_type firstEntry = 0);
+            
+
             // A flag indicating whether a row count was set upon construction.
             bool initialRowCountSet;
             
@@ -304,6 +333,16 @@ namespace storm {
             // Stores the currently active row group. This is used for correctly constructing the row grouping of the
             // matrix.
             index_type currentRowGroupCount;
+            
+            // The file to which the entries are written (if this is enabled).
+            TemporaryFile spillFile;
+            
+            // The number of entries that were written to the file. The entries held in memory are the ones following
+            // these entries.
+            index_type numberOfSpilledEntries;
+            
+            // The number of entries that are held in memory before they are written to the file.
+            index_type maximalNumberOfResidentEntries;
         };
         
         /*!
@@ -0,0 +1,310 @@
+#include "storm/storage/SpillingBitVectorHashMap.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+        
+        template<typename ValueType>
+        SpillingBitVectorHashMap<ValueType>::Run::Run(std::string const& fileName, uint64_t numberOfKeys) : fileName(fileName), numberOfKeys(numberOfKeys), keys(std::max<uint64_t>(numberOfKeys, 1)), index(), in() {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        SpillingBitVectorHashMap<ValueType>::SpillingBitVectorHashMap(uint64_t bucketSize, uint64_t maximalNumberOfResidentKeys, std::string const& directory, uint64_t blockSize) : bucketSize(bucketSize), numberOfChunks(bucketSize / 64), maximalNumberOfResidentKeys(std::max<uint64_t>(maximalNumberOfResidentKeys, 1)), blockSize(blockSize), numberOfSpilledKeys(0), numberOfCreatedRuns(0), residentKeys(bucketSize) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_THROW(blockSize > 0, storm::exceptions::InvalidArgumentException, "The blocks of the runs need to hold at least one key.");
+            STORM_LOG_THROW(boost::filesystem::is_directory(directory), storm::exceptions::InvalidArgumentException, "The directory '" << directory << "' does not exist.");
+            filePrefix = (boost::filesystem::path(directory) / boost::filesystem::unique_path("storm-states-%%%%-%%%%-%%%%-%%%%")).string();
+            blockBuffer.resize(blockSize * (numberOfChunks * sizeof(uint64_t) + sizeof(ValueType)));
+        }
+        
+        template<typename ValueType>
+        SpillingBitVectorHashMap<ValueType>::~SpillingBitVectorHashMap() {
+            for (auto& run : runs) {
+                run.in.reset();
+                std::remove(run.fileName.c_str());
+            }
+        }
+        
+        template<typename ValueType>
+        ValueType SpillingBitVectorHashMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            // Keys are only written to disk if they are not contained in any run, so a key is found at most once.
+            if (!runs.empty()) {
+                std::vector<uint64_t> chunks(numberOfChunks);
+                getChunks(key, chunks.data());
+                for (auto& run : runs) {
+                    boost::optional<ValueType> result = find(run, key, chunks);
+                    if (result) {
+                        return result.get();
+                    }
+                }
+            }
+            
+            ValueType result = residentKeys.findOrAdd(key, value);
+            if (residentKeys.size() > maximalNumberOfResidentKeys) {
+                spill();
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& callback) const {
+            for (auto const& keyValuePair : residentKeys) {
+                callback(keyValuePair.first, keyValuePair.second);
+            }
+            storm::storage::BitVector key(bucketSize);
+            for (auto const& run : runs) {
+                forEachKeyOfRun(run, [&] (uint64_t const* chunks, ValueType const& value) {
+                    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                        key.setFromInt(chunk * 64, 64, chunks[chunk]);
+                    }
+                    callback(key, value);
+                });
+            }
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            residentKeys.remap(remapping);
+            for (auto& run : runs) {
+                // Rewrite the file of the run with the remapped values and replace the old file afterwards. The order of
+                // the keys and hence the index and the filter remain valid.
+                std::string rewrittenFileName = run.fileName + ".tmp";
+                {
+                    std::ofstream out(rewrittenFileName, std::ios::binary);
+                    forEachKeyOfRun(run, [&] (uint64_t const* chunks, ValueType const& value) {
+                        ValueType remappedValue = remapping(value);
+                        out.write(reinterpret_cast<char const*>(chunks), numberOfChunks * sizeof(uint64_t));
+                        out.write(reinterpret_cast<char const*>(&remappedValue), sizeof(ValueType));
+                    });
+                    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Unable to write states to file '" << rewrittenFileName << "'.");
+                }
+                run.in.reset();
+                STORM_LOG_THROW(std::rename(rewrittenFileName.c_str(), run.fileName.c_str()) == 0, storm::exceptions::FileIoException, "Unable to replace file '" << run.fileName << "'.");
+                open(run);
+            }
+        }
+        
+        template<typename ValueType>
+        uint64_t SpillingBitVectorHashMap<ValueType>::size() const {
+            return residentKeys.size() + numberOfSpilledKeys;
+        }
+        
+        template<typename ValueType>
+        uint64_t SpillingBitVectorHashMap<ValueType>::getNumberOfResidentKeys() const {
+            return residentKeys.size();
+        }
+        
+        template<typename ValueType>
+        uint64_t SpillingBitVectorHashMap<ValueType>::getNumberOfRuns() const {
+            return runs.size();
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::getChunks(storm::storage::BitVector const& key, uint64_t* chunks) const {
+            for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                chunks[chunk] = key.getAsInt(chunk * 64, 64);
+            }
+        }
+        
+        template<typename ValueType>
+        bool SpillingBitVectorHashMap<ValueType>::isLess(uint64_t const* first, uint64_t const* second) const {
+            return std::lexicographical_compare(first, first + numberOfChunks, second, second + numberOfChunks);
+        }
+        
+        template<typename ValueType>
+        boost::optional<ValueType> SpillingBitVectorHashMap<ValueType>::find(Run& run, storm::storage::BitVector const& key, std::vector<uint64_t> const& chunks) {
+            if (!run.keys.mayContain(key)) {
+                return boost::none;
+            }
+            
+            // Find the last block whose first key is not larger than the key.
+            uint64_t numberOfBlocks = run.index.size() / numberOfChunks;
+            uint64_t lower = 0;
+            uint64_t upper = numberOfBlocks;
+            while (lower < upper) {
+                uint64_t middle = lower + (upper - lower) / 2;
+                if (isLess(chunks.data(), run.index.data() + middle * numberOfChunks)) {
+                    upper = middle;
+                } else {
+                    lower = middle + 1;
+                }
+            }
+            if (lower == 0) {
+                return boost::none;
+            }
+            uint64_t block = lower - 1;
+            
+            // Read the block and search the key in it.
+            uint64_t recordSize = numberOfChunks * sizeof(uint64_t) + sizeof(ValueType);
+            uint64_t numberOfKeysInBlock = std::min(blockSize, run.numberOfKeys - block * blockSize);
+            run.in->clear();
+            run.in->seekg(block * blockSize * recordSize);
+            run.in->read(blockBuffer.data(), numberOfKeysInBlock * recordSize);
+            STORM_LOG_THROW(*run.in, storm::exceptions::FileIoException, "Unable to read states from file '" << run.fileName << "'.");
+            
+            std::vector<uint64_t> recordChunks(numberOfChunks);
+            lower = 0;
+            upper = numberOfKeysInBlock;
+            while (lower < upper) {
+                uint64_t middle = lower + (upper - lower) / 2;
+                std::memcpy(recordChunks.data(), blockBuffer.data() + middle * recordSize, numberOfChunks * sizeof(uint64_t));
+                if (isLess(recordChunks.data(), chunks.data())) {
+                    lower = middle + 1;
+                } else if (isLess(chunks.data(), recordChunks.data())) {
+                    upper = middle;
+                } else {
+                    ValueType value;
+                    std::memcpy(&value, blockBuffer.data() + middle * recordSize + numberOfChunks * sizeof(uint64_t), sizeof(ValueType));
+                    return value;
+                }
+            }
+            return boost::none;
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::spill() {
+            // Sort the keys held in memory.
+            uint64_t numberOfKeys = residentKeys.size();
+            std::vector<uint64_t> chunks(numberOfKeys * numberOfChunks);
+            std::vector<ValueType> values;
+            values.reserve(numberOfKeys);
+            for (auto const& keyValuePair : residentKeys) {
+                getChunks(keyValuePair.first, chunks.data() + values.size() * numberOfChunks);
+                values.push_back(keyValuePair.second);
+            }
+            std::vector<uint64_t> order(numberOfKeys);
+            for (uint64_t position = 0; position < numberOfKeys; ++position) {
+                order[position] = position;
+            }
+            std::sort(order.begin(), order.end(), [&] (uint64_t a, uint64_t b) { return isLess(chunks.data() + a * numberOfChunks, chunks.data() + b * numberOfChunks); });
+            
+            runs.push_back(createRun(numberOfKeys, [&] (std::function<void (uint64_t const*, ValueType const&)> const& write) {
+                for (auto const& position : order) {
+                    write(chunks.data() + position * numberOfChunks, values[position]);
+                }
+            }));
+            residentKeys = storm::storage::BitVectorHashMap<ValueType>(bucketSize);
+            numberOfSpilledKeys += numberOfKeys;
+            
+            // Merge runs as long as the most recent one is at least half as large as the one before, so that the sizes
+            // of the runs roughly double from the most recent to the oldest one.
+            while (runs.size() > 1 && 2 * runs.back().numberOfKeys >= runs[runs.size() - 2].numberOfKeys) {
+                mergeLastRuns();
+            }
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::mergeLastRuns() {
+            Run& first = runs[runs.size() - 2];
+            Run& second = runs.back();
+            Run merged = createRun(first.numberOfKeys + second.numberOfKeys, [&] (std::function<void (uint64_t const*, ValueType const&)> const& write) {
+                // Read the second run alongside the first one and write the keys of both in ascending order. As the
+                // runs are disjoint, no key needs to be written twice.
+                uint64_t recordSize = numberOfChunks * sizeof(uint64_t) + sizeof(ValueType);
+                std::ifstream secondIn(second.fileName, std::ios::binary);
+                STORM_LOG_THROW(secondIn, storm::exceptions::FileIoException, "Unable to read states from file '" << second.fileName << "'.");
+                std::vector<char> secondRecord(recordSize);
+                uint64_t remainingSecondKeys = second.numberOfKeys;
+                auto readSecond = [&] () {
+                    if (remainingSecondKeys > 0) {
+                        secondIn.read(secondRecord.data(), recordSize);
+                        STORM_LOG_THROW(secondIn, storm::exceptions::FileIoException, "Unable to read states from file '" << second.fileName << "'.");
+                    }
+                };
+                std::vector<uint64_t> secondChunks(numberOfChunks);
+                ValueType secondValue;
+                auto decodeSecond = [&] () {
+                    std::memcpy(secondChunks.data(), secondRecord.data(), numberOfChunks * sizeof(uint64_t));
+                    std::memcpy(&secondValue, secondRecord.data() + numberOfChunks * sizeof(uint64_t), sizeof(ValueType));
+                };
+                readSecond();
+                decodeSecond();
+                
+                forEachKeyOfRun(first, [&] (uint64_t const* chunks, ValueType const& value) {
+                    while (remainingSecondKeys > 0 && isLess(secondChunks.data(), chunks)) {
+                        write(secondChunks.data(), secondValue);
+                        --remainingSecondKeys;
+                        readSecond();
+                        decodeSecond();
+                    }
+                    write(chunks, value);
+                });
+                while (remainingSecondKeys > 0) {
+                    write(secondChunks.data(), secondValue);
+                    --remainingSecondKeys;
+                    readSecond();
+                    decodeSecond();
+                }
+            });
+            
+            for (auto run : {&first, &second}) {
+                run->in.reset();
+                std::remove(run->fileName.c_str());
+            }
+            runs.pop_back();
+            runs.back() = std::move(merged);
+        }
+        
+        template<typename ValueType>
+        typename SpillingBitVectorHashMap<ValueType>::Run SpillingBitVectorHashMap<ValueType>::createRun(uint64_t numberOfKeys, std::function<void (std::function<void (uint64_t const*, ValueType const&)> const&)> const& producer) {
+            Run run(filePrefix + "-" + std::to_string(numberOfCreatedRuns++) + ".bin", numberOfKeys);
+            {
+                std::ofstream out(run.fileName, std::ios::binary);
+                storm::storage::BitVector key(bucketSize);
+                uint64_t numberOfWrittenKeys = 0;
+                producer([&] (uint64_t const* chunks, ValueType const& value) {
+                    out.write(reinterpret_cast<char const*>(chunks), numberOfChunks * sizeof(uint64_t));
+                    out.write(reinterpret_cast<char const*>(&value), sizeof(ValueType));
+                    
+                    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                        key.setFromInt(chunk * 64, 64, chunks[chunk]);
+                    }
+                    run.keys.add(key);
+                    if (numberOfWrittenKeys % blockSize == 0) {
+                        run.index.insert(run.index.end(), chunks, chunks + numberOfChunks);
+                    }
+                    ++numberOfWrittenKeys;
+                });
+                STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Unable to write states to file '" << run.fileName << "'.");
+                STORM_LOG_ASSERT(numberOfWrittenKeys == numberOfKeys, "Unexpected number of keys in run.");
+            }
+            open(run);
+            return run;
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::forEachKeyOfRun(Run const& run, std::function<void (uint64_t const*, ValueType const&)> const& callback) const {
+            std::ifstream in(run.fileName, std::ios::binary);
+            STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Unable to read states from file '" << run.fileName << "'.");
+            
+            std::vector<uint64_t> chunks(numberOfChunks);
+            ValueType value;
+            for (uint64_t index = 0; index < run.numberOfKeys; ++index) {
+                in.read(reinterpret_cast<char*>(chunks.data()), numberOfChunks * sizeof(uint64_t));
+                in.read(reinterpret_cast<char*>(&value), sizeof(ValueType));
+                STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Unable to read states from file '" << run.fileName << "'.");
+                callback(chunks.data(), value);
+            }
+        }
+        
+        template<typename ValueType>
+        void SpillingBitVectorHashMap<ValueType>::open(Run& run) const {
+            run.in = std::make_unique<std::ifstream>(run.fileName, std::ios::binary);
+            STORM_LOG_THROW(*run.in, storm::exceptions::FileIoException, "Unable to read states from file '" << run.fileName << "'.");
+        }
+        
+        template class SpillingBitVectorHashMap<uint64_t>;
+        template class SpillingBitVectorHashMap<uint32_t>;
+    
+    }
+}
@@ -0,0 +1,188 @@
+#ifndef STORM_STORAGE_SPILLINGBITVECTORHASHMAP_H_
+#define STORM_STORAGE_SPILLINGBITVECTORHASHMAP_H_
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/BloomFilter.h"
+
+namespace storm {
+    namespace storage {
+        
+        /*!
+         * A hash-map whose keys are bit vectors (of a length that is a multiple of 64) that holds only a bounded number
+         * of keys in memory and writes the remaining ones to files on disk. If the map holds too many keys in memory,
+         * they are written to disk as a run, i.e. a file in which the keys are sorted. For each run, the map keeps a
+         * bloom filter of its keys and a sparse index that holds the first key of every block of the file. Looking up
+         * a key that was not inserted before (which is the common case for new states) therefore rarely touches the
+         * disk, and looking up a key that was written to disk only requires reading a single block of a run. Keys that
+         * are found on disk stay there. To bound the number of runs that need to be consulted, runs of similar size are
+         * merged, so that there are only logarithmically many of them.
+         *
+         * As for BitVectorHashMap, elements can not be removed.
+         */
+        template<typename ValueType>
+        class SpillingBitVectorHashMap {
+        public:
+            /*!
+             * Creates an empty map.
+             *
+             * @param bucketSize The size of the keys. This value must be a multiple of 64.
+             * @param maximalNumberOfResidentKeys The number of keys that are held in memory before they are written to
+             * disk.
+             * @param directory The directory in which the files of the runs are created.
+             * @param blockSize The number of keys per block of a run, i.e. the number of keys that are read to look up
+             * a key on disk.
+             */
+            SpillingBitVectorHashMap(uint64_t bucketSize, uint64_t maximalNumberOfResidentKeys, std::string const& directory, uint64_t blockSize = 64);
+            
+            ~SpillingBitVectorHashMap();
+            
+            SpillingBitVectorHashMap(SpillingBitVectorHashMap const&) = delete;
+            SpillingBitVectorHashMap& operator=(SpillingBitVectorHashMap const&) = delete;
+            
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+            
+            /*!
+             * Calls the given function for all key-value pairs of the map (in no particular order). The keys that were
+             * written to disk are read one at a time, so this does not load any run into memory.
+             */
+            void forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& callback) const;
+            
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+            
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             */
+            uint64_t size() const;
+            
+            /*!
+             * Retrieves the number of keys that are currently held in memory.
+             */
+            uint64_t getNumberOfResidentKeys() const;
+            
+            /*!
+             * Retrieves the number of runs in which the keys on disk are stored.
+             */
+            uint64_t getNumberOfRuns() const;
+        
+        private:
+            struct Run {
+                Run(std::string const& fileName, uint64_t numberOfKeys);
+                
+                // The name of the file of the run.
+                std::string fileName;
+                
+                // The number of keys in the run.
+                uint64_t numberOfKeys;
+                
+                // A filter of the keys of the run.
+                storm::storage::BloomFilter keys;
+                
+                // The chunks of the first key of every block of the run.
+                std::vector<uint64_t> index;
+                
+                // The stream from which blocks of the run are read.
+                std::unique_ptr<std::ifstream> in;
+            };
+            
+            /*!
+             * Retrieves the chunks of the given key.
+             */
+            void getChunks(storm::storage::BitVector const& key, uint64_t* chunks) const;
+            
+            /*!
+             * Retrieves whether the first of the given keys (given by their chunks) is smaller than the second one.
+             */
+            bool isLess(uint64_t const* first, uint64_t const* second) const;
+            
+            /*!
+             * Looks up the key with the given chunks in the given run.
+             *
+             * @return The value of the key or nothing if the run does not contain the key.
+             */
+            boost::optional<ValueType> find(Run& run, storm::storage::BitVector const& key, std::vector<uint64_t> const& chunks);
+            
+            /*!
+             * Writes the keys held in memory to a new run and merges the most recent runs as long as they have similar
+             * sizes.
+             */
+            void spill();
+            
+            /*!
+             * Merges the two most recent runs into one.
+             */
+            void mergeLastRuns();
+            
+            /*!
+             * Creates a run in a new file whose keys are produced by the given function. The function is called with a
+             * callback that writes a key-value pair (in ascending order of the keys) to the run.
+             */
+            Run createRun(uint64_t numberOfKeys, std::function<void (std::function<void (uint64_t const*, ValueType const&)> const&)> const& producer);
+            
+            /*!
+             * Calls the given function for all key-value pairs in the given run (in ascending order of the keys).
+             */
+            void forEachKeyOfRun(Run const& run, std::function<void (uint64_t const*, ValueType const&)> const& callback) const;
+            
+            /*!
+             * Opens the file of the given run for looking up keys.
+             */
+            void open(Run& run) const;
+            
+            // The size of the keys.
+            uint64_t bucketSize;
+            
+            // The number of chunks of the keys.
+            uint64_t numberOfChunks;
+            
+            // The number of keys held in memory above which they are written to disk.
+            uint64_t maximalNumberOfResidentKeys;
+            
+            // The number of keys per block of a run.
+            uint64_t blockSize;
+            
+            // The number of keys that were written to disk.
+            uint64_t numberOfSpilledKeys;
+            
+            // The number of runs created so far, which serves to name their files.
+            uint64_t numberOfCreatedRuns;
+            
+            // The common prefix of the names of the files of the runs.
+            std::string filePrefix;
+            
+            // The keys held in memory.
+            storm::storage::BitVectorHashMap<ValueType> residentKeys;
+            
+            // The runs on disk, from the oldest to the most recent one.
+            std::vector<Run> runs;
+            
+            // A buffer for the block that is read during a lookup.
+            std::vector<char> blockBuffer;
+        };
+    
+    }
+}
+
+#endif /* STORM_STORAGE_SPILLINGBITVECTORHASHMAP_H_ */
@@ -1,8 +1,15 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -49,6 +56,11 @@ namespace storm {
             performSccDecomposition(transitionMatrix, subsystem, dropNaiveSccs, onlyBottomSccs);
         }
         
+        template <typename ValueType>
+        StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, uint64_t numberOfThreads) {
+            performForwardBackwardSccDecomposition(transitionMatrix, backwardTransitions, subsystem, dropNaiveSccs, std::is_same<ValueType, double>::value ? numberOfThreads : 1);
+        }
+        
         template <typename ValueType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(StronglyConnectedComponentDecomposition const& other) : Decomposition(other) {
             // Intentionally left empty.
@@ -170,6 +182,185 @@ namespace storm {
             performSccDecomposition(model.getTransitionMatrix(), fullSystem, dropNaiveSccs, onlyBottomSccs);
         }
         
+        template <typename ValueType>
+        void StronglyConnectedComponentDecomposition<ValueType>::performForwardBackwardSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, uint64_t numberOfThreads) {
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            
+            // Identify the states with a self-loop, because they form non-trivial SCCs even on their own.
+            storm::storage::BitVector statesWithSelfLoop(numberOfStates);
+            for (auto state : subsystem) {
+                for (auto const& successor : transitionMatrix.getRowGroup(state)) {
+                    if (successor.getColumn() == state && !storm::utility::isZero(successor.getValue())) {
+                        statesWithSelfLoop.set(state);
+                        break;
+                    }
+                }
+            }
+            
+            auto addScc = [&] (std::vector<uint_fast64_t> const& states) {
+                if (dropNaiveSccs && states.size() == 1 && !statesWithSelfLoop.get(states.front())) {
+                    return;
+                }
+                StronglyConnectedComponent scc;
+                for (auto state : states) {
+                    scc.insert(scc.end(), state);
+                }
+                scc.setIsTrivial(states.size() == 1 && !statesWithSelfLoop.get(states.front()));
+                this->blocks.emplace_back(std::move(scc));
+            };
+            
+            // Every state that is not yet assigned to an SCC stores the index of the part it belongs to. The parts of a
+            // round are decomposed independently. Apart from the part indices (that are only modified in between rounds),
+            // the decomposition of a part only touches the marks of its own states.
+            uint64_t const noPart = std::numeric_limits<uint64_t>::max();
+            std::vector<uint64_t> stateToPart(numberOfStates, noPart);
+            std::vector<uint8_t> marks(numberOfStates, 0);
+            uint8_t const forwardMark = 1;
+            uint8_t const backwardMark = 2;
+            std::vector<std::vector<uint_fast64_t>> parts;
+            if (!subsystem.empty()) {
+                parts.emplace_back(subsystem.begin(), subsystem.end());
+                for (auto state : subsystem) {
+                    stateToPart[state] = 0;
+                }
+            }
+            
+            // A state that has no predecessor or no successor in its part cannot share an SCC with any other state, so
+            // it forms an SCC on its own and can be trimmed from its part.
+            auto hasOtherNeighborInPart = [&stateToPart] (typename storm::storage::SparseMatrix<ValueType>::const_rows const& neighbors, uint_fast64_t state) {
+                for (auto const& neighbor : neighbors) {
+                    if (neighbor.getColumn() != state && stateToPart[neighbor.getColumn()] == stateToPart[state] && !storm::utility::isZero(neighbor.getValue())) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            std::vector<uint_fast64_t> trimStack;
+            storm::storage::BitVector statesOnTrimStack(numberOfStates);
+            
+            // For each part, we store the SCC of the pivot state and the states that are only forward reachable, only
+            // backward reachable or neither.
+            std::vector<std::array<std::vector<uint_fast64_t>, 4>> results;
+            while (!parts.empty()) {
+                // Splitting the parts in the previous round typically leaves states without predecessor or successor
+                // in their new part, so we trim the parts in every round.
+                for (auto const& part : parts) {
+                    trimStack.insert(trimStack.end(), part.begin(), part.end());
+                    for (auto state : part) {
+                        statesOnTrimStack.set(state);
+                    }
+                }
+                while (!trimStack.empty()) {
+                    uint_fast64_t state = trimStack.back();
+                    trimStack.pop_back();
+                    statesOnTrimStack.set(state, false);
+                    
+                    uint64_t partIndex = stateToPart[state];
+                    if (!hasOtherNeighborInPart(transitionMatrix.getRowGroup(state), state) || !hasOtherNeighborInPart(backwardTransitions.getRow(state), state)) {
+                        stateToPart[state] = noPart;
+                        addScc({state});
+                        
+                        // The neighbors of the state may now have to be trimmed as well.
+                        for (auto const& rows : {transitionMatrix.getRowGroup(state), backwardTransitions.getRow(state)}) {
+                            for (auto const& neighbor : rows) {
+                                if (stateToPart[neighbor.getColumn()] == partIndex && !statesOnTrimStack.get(neighbor.getColumn())) {
+                                    trimStack.push_back(neighbor.getColumn());
+                                    statesOnTrimStack.set(neighbor.getColumn());
+                                }
+                            }
+                        }
+                    }
+                }
+                std::vector<std::vector<uint_fast64_t>> trimmedParts;
+                for (auto& part : parts) {
+                    part.erase(std::remove_if(part.begin(), part.end(), [&stateToPart, noPart] (uint_fast64_t state) { return stateToPart[state] == noPart; }), part.end());
+                    if (!part.empty()) {
+                        for (auto state : part) {
+                            stateToPart[state] = trimmedParts.size();
+                        }
+                        trimmedParts.emplace_back(std::move(part));
+                    }
+                }
+                parts = std::move(trimmedParts);
+                if (parts.empty()) {
+                    break;
+                }
+                
+                results.clear();
+                results.resize(parts.size());
+                bool decomposePartsConcurrently = numberOfThreads != 1 && parts.size() > 1;
+                
+                auto decomposePart = [&] (uint64_t partIndex) {
+                    std::vector<uint_fast64_t> const& part = parts[partIndex];
+                    uint_fast64_t pivot = part.front();
+                    auto isInPart = [&stateToPart, partIndex] (uint_fast64_t state) { return stateToPart[state] == partIndex; };
+                    
+                    if (decomposePartsConcurrently || numberOfThreads == 1) {
+                        std::vector<uint_fast64_t> searchStack;
+                        for (auto const& graphMarkPair : {std::make_pair(&transitionMatrix, forwardMark), std::make_pair(&backwardTransitions, backwardMark)}) {
+                            uint8_t mark = graphMarkPair.second;
+                            marks[pivot] |= mark;
+                            searchStack.push_back(pivot);
+                            while (!searchStack.empty()) {
+                                uint_fast64_t state = searchStack.back();
+                                searchStack.pop_back();
+                                for (auto const& successor : graphMarkPair.first->getRowGroup(state)) {
+                                    if (isInPart(successor.getColumn()) && !(marks[successor.getColumn()] & mark) && !storm::utility::isZero(successor.getValue())) {
+                                        marks[successor.getColumn()] |= mark;
+                                        searchStack.push_back(successor.getColumn());
+                                    }
+                                }
+                            }
+                        }
+                    } else {
+                        storm::storage::BitVector forwardStates(numberOfStates);
+                        forwardStates.set(pivot);
+                        storm::utility::graph::performParallelSearch(transitionMatrix, forwardStates, {pivot}, isInPart, numberOfThreads, true);
+                        storm::storage::BitVector backwardStates(numberOfStates);
+                        backwardStates.set(pivot);
+                        storm::utility::graph::performParallelSearch(backwardTransitions, backwardStates, {pivot}, isInPart, numberOfThreads, true);
+                        for (auto state : part) {
+                            marks[state] = (forwardStates.get(state) ? forwardMark : 0) | (backwardStates.get(state) ? backwardMark : 0);
+                        }
+                    }
+                    
+                    // The states reachable in both directions form the SCC of the pivot. The order of the states in the
+                    // part is preserved, so all parts (and SCCs) remain sorted.
+                    for (auto state : part) {
+                        results[partIndex][3 - marks[state]].push_back(state);
+                        marks[state] = 0;
+                    }
+                };
+                
+                if (decomposePartsConcurrently) {
+                    storm::utility::getThreadPool().execute(parts.size(), decomposePart, numberOfThreads);
+                } else {
+                    for (uint64_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+                        decomposePart(partIndex);
+                    }
+                }
+                
+                // Store the SCCs and set up the parts of the next round.
+                std::vector<std::vector<uint_fast64_t>> nextParts;
+                for (auto& result : results) {
+                    for (auto state : result[0]) {
+                        stateToPart[state] = noPart;
+                    }
+                    addScc(result[0]);
+                    
+                    for (uint64_t index = 1; index < 4; ++index) {
+                        if (!result[index].empty()) {
+                            for (auto state : result[index]) {
+                                stateToPart[state] = nextParts.size();
+                            }
+                            nextParts.emplace_back(std::move(result[index]));
+                        }
+                    }
+                }
+                parts = std::move(nextParts);
+            }
+        }
+        
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
             
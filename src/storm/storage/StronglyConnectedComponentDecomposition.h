@@ -103,6 +103,22 @@ namespace storm {
              */
             StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs = false, bool onlyBottomSccs = false);
             
+            /*
+             * Creates an SCC decomposition of the given subsystem in the given system using the forward-backward
+             * algorithm, which can use multiple threads. Note that, unlike for the other constructors, the SCCs are not
+             * ordered (reverse) topologically.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param backwardTransitions The backward transitions (from states to their predecessor states) of the
+             * system to decompose.
+             * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
+             * without a self-loop) are to be kept in the decomposition.
+             * @param numberOfThreads The number of threads to use (zero means the number of hardware threads). Only
+             * decompositions of systems with double values use more than one thread.
+             */
+            StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, uint64_t numberOfThreads);
+            
             /*!
              * Creates an SCC decomposition by copying the given SCC decomposition.
              *
@@ -166,6 +182,24 @@ namespace storm {
              */
             void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs);
             
+            /*!
+             * Performs the SCC decomposition of the given subsystem using the forward-backward algorithm. The SCC of a
+             * pivot state is computed as the intersection of its forward and backward reachable states, which splits
+             * the remaining states into three parts that can be decomposed independently. The parts are decomposed in
+             * rounds. At the start of every round, the states that have no predecessor or no successor in their part
+             * are trimmed, as they form SCCs on their own. Then, if a round has several parts, they are decomposed
+             * concurrently and otherwise the searches of the only part use multiple threads. As a side-effect this
+             * fills the vector of blocks of the decomposition.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param backwardTransitions The backward transitions of the system to decompose.
+             * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
+             * without a self-loop) are to be kept in the decomposition.
+             * @param numberOfThreads The number of threads to use.
+             */
+            void performForwardBackwardSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, uint64_t numberOfThreads);
+            
             /*!
              * Uses the algorithm by Gabow/Cheriyan/Mehlhorn ("Path-based strongly connected component algorithm") to
              * compute a mapping of states to their SCCs. All arguments given by (non-const) reference are modified by
@@ -0,0 +1,82 @@
+#include "storm/storage/TemporaryFile.h"
+
+#include <cstdio>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+        
+        TemporaryFile::TemporaryFile() : pattern(), name() {
+            // Intentionally left empty.
+        }
+        
+        TemporaryFile::TemporaryFile(std::string const& directory, std::string const& pattern) : pattern(pattern) {
+            STORM_LOG_THROW(boost::filesystem::is_directory(directory), storm::exceptions::InvalidArgumentException, "The directory '" << directory << "' does not exist.");
+            name = (boost::filesystem::path(directory) / boost::filesystem::unique_path(pattern)).string();
+        }
+        
+        TemporaryFile::TemporaryFile(TemporaryFile const& other) : pattern(), name() {
+            copyFrom(other);
+        }
+        
+        TemporaryFile& TemporaryFile::operator=(TemporaryFile const& other) {
+            if (this != &other) {
+                remove();
+                copyFrom(other);
+            }
+            return *this;
+        }
+        
+        TemporaryFile::TemporaryFile(TemporaryFile&& other) : pattern(std::move(other.pattern)), name(std::move(other.name)) {
+            other.name.clear();
+        }
+        
+        TemporaryFile& TemporaryFile::operator=(TemporaryFile&& other) {
+            if (this != &other) {
+                remove();
+                pattern = std::move(other.pattern);
+                name = std::move(other.name);
+                other.name.clear();
+            }
+            return *this;
+        }
+        
+        TemporaryFile::~TemporaryFile() {
+            remove();
+        }
+        
+        bool TemporaryFile::isSet() const {
+            return !name.empty();
+        }
+        
+        std::string const& TemporaryFile::getName() const {
+            return name;
+        }
+        
+        void TemporaryFile::remove() const {
+            if (isSet()) {
+                std::remove(name.c_str());
+            }
+        }
+        
+        void TemporaryFile::copyFrom(TemporaryFile const& other) {
+            pattern = other.pattern;
+            name.clear();
+            if (other.isSet()) {
+                boost::filesystem::path otherPath(other.name);
+                name = (otherPath.parent_path() / boost::filesystem::unique_path(pattern)).string();
+                if (boost::filesystem::exists(otherPath)) {
+                    boost::system::error_code error;
+                    boost::filesystem::copy_file(otherPath, name, error);
+                    STORM_LOG_THROW(!error, storm::exceptions::FileIoException, "Unable to copy file '" << other.name << "' to '" << name << "'.");
+                }
+            }
+        }
+        
+    }
+}
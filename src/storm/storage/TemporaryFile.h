@@ -0,0 +1,67 @@
+#ifndef STORM_STORAGE_TEMPORARYFILE_H_
+#define STORM_STORAGE_TEMPORARYFILE_H_
+
+#include <string>
+
+namespace storm {
+    namespace storage {
+        
+        /*!
+         * Owns a temporary file, which is removed when the object is destroyed. The file itself is only created by
+         * whoever writes to it. Copying the object copies the file (if it exists) to a new temporary file, such that
+         * each copy owns its own file. Moving the object transfers the ownership of the file.
+         */
+        class TemporaryFile {
+        public:
+            /*!
+             * Creates an object that does not own any file.
+             */
+            TemporaryFile();
+            
+            /*!
+             * Chooses the name of a new temporary file in the given directory.
+             *
+             * @param directory The directory in which to place the file. It must exist.
+             * @param pattern The pattern of the file name, in which every '%' is replaced by a random hexadecimal digit.
+             */
+            TemporaryFile(std::string const& directory, std::string const& pattern);
+            
+            TemporaryFile(TemporaryFile const& other);
+            TemporaryFile& operator=(TemporaryFile const& other);
+            TemporaryFile(TemporaryFile&& other);
+            TemporaryFile& operator=(TemporaryFile&& other);
+            
+            ~TemporaryFile();
+            
+            /*!
+             * Retrieves whether this object owns a file.
+             */
+            bool isSet() const;
+            
+            /*!
+             * Retrieves the name of the owned file.
+             */
+            std::string const& getName() const;
+            
+            /*!
+             * Removes the owned file from disk (if it exists). The object keeps the name, so the file may be written again.
+             */
+            void remove() const;
+            
+        private:
+            /*!
+             * Sets this object to a copy of the file owned by the given object.
+             */
+            void copyFrom(TemporaryFile const& other);
+            
+            // The pattern with which the name of the file was chosen.
+            std::string pattern;
+            
+            // The name of the file (or empty if no file is owned).
+            std::string name;
+        };
+        
+    }
+}
+
+#endif /* STORM_STORAGE_TEMPORARYFILE_H_ */
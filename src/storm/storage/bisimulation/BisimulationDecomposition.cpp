@@ -1,6 +1,7 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <numeric>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,6 +9,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
+#include "storm/storage/DistributionWithReward.h"
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -19,6 +21,7 @@
 #include "storm/logic/FragmentSpecification.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 
@@ -47,7 +50,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), refinementMode(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMode()), numberOfThreads(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseNumberOfThreads()), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
             // Intentionally left empty.
         }
         
@@ -192,10 +195,23 @@ namespace storm {
             }
             std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
             
-            this->initialize();
+            bool useSignatureRefinement = options.refinementMode == SparseRefinementMode::Signature;
+            if (useSignatureRefinement && options.getType() == BisimulationType::Weak) {
+                STORM_LOG_WARN("Signature-based refinement is not supported for weak bisimulation, using splitter-based refinement instead.");
+                useSignatureRefinement = false;
+            }
             
             std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-            this->performPartitionRefinement();
+            if (useSignatureRefinement) {
+                this->performSignatureRefinement();
+                
+                // The auxiliary data structures are only needed for building the quotient, so we initialize them wrt.
+                // the final partition.
+                this->initialize();
+            } else {
+                this->initialize();
+                this->performPartitionRefinement();
+            }
             std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
             
             std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -252,6 +268,130 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            
+            // If rewards are to be preserved, the rewards of the choices are part of the signature.
+            std::vector<ValueType> const* choiceRewards = nullptr;
+            if (options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards()) {
+                choiceRewards = &model.getUniqueRewardModel().getStateActionRewardVector();
+            }
+            
+            // Arithmetic on other value types is not thread-safe, so we only use multiple threads for doubles.
+            uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? options.numberOfThreads : 1;
+            auto runTasks = [numberOfThreads] (uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+                if (numberOfThreads != 1 && numberOfTasks > 1) {
+                    storm::utility::getThreadPool().execute(numberOfTasks, task, numberOfThreads);
+                } else {
+                    for (uint64_t index = 0; index < numberOfTasks; ++index) {
+                        task(index);
+                    }
+                }
+            };
+            
+            // The number of states whose signatures are computed by one task.
+            uint_fast64_t const statesPerChunk = 1024;
+            
+            // The signature of a state is the ordered set of distributions (over blocks) of its choices.
+            std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> signatures(model.getNumberOfStates());
+            auto signatureLess = [this, &signatures] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                auto const& signature1 = signatures[state1];
+                auto const& signature2 = signatures[state2];
+                if (signature1.size() != signature2.size()) {
+                    return signature1.size() < signature2.size();
+                }
+                for (auto firstIt = signature1.begin(), secondIt = signature2.begin(); firstIt != signature1.end(); ++firstIt, ++secondIt) {
+                    if (firstIt->less(*secondIt, comparator)) {
+                        return true;
+                    } else if (secondIt->less(*firstIt, comparator)) {
+                        return false;
+                    }
+                }
+                return false;
+            };
+            
+            uint_fast64_t iterations = 0;
+            bool partitionChanged = true;
+            while (partitionChanged) {
+                ++iterations;
+                
+                // Only blocks with more than one state may be split. The states of absorbing blocks are considered
+                // equivalent irrespective of their transitions.
+                std::vector<Block<BlockDataType>*> candidateBlocks;
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        candidateBlocks.push_back(block.get());
+                    }
+                }
+                if (candidateBlocks.empty()) {
+                    break;
+                }
+                
+                // Compute the signatures of the states in all candidate blocks. The states of a block are
+                // consecutive in the partition, so we cut the states of all candidate blocks into chunks of roughly
+                // equal size. This way, large blocks are distributed over several tasks.
+                std::vector<std::pair<uint_fast64_t, uint_fast64_t>> chunks;
+                for (auto const& block : candidateBlocks) {
+                    for (uint_fast64_t begin = block->getBeginIndex(); begin < block->getEndIndex(); begin += statesPerChunk) {
+                        uint_fast64_t end = std::min<uint_fast64_t>(begin + statesPerChunk, block->getEndIndex());
+                        if (!chunks.empty() && chunks.back().second == begin && end - chunks.back().first <= statesPerChunk) {
+                            chunks.back().second = end;
+                        } else {
+                            chunks.emplace_back(begin, end);
+                        }
+                    }
+                }
+                runTasks(chunks.size(), [&] (uint64_t chunkIndex) {
+                    for (auto stateIt = partition.begin() + chunks[chunkIndex].first, stateIte = partition.begin() + chunks[chunkIndex].second; stateIt != stateIte; ++stateIt) {
+                        std::vector<storm::storage::DistributionWithReward<ValueType>>& signature = signatures[*stateIt];
+                        signature.clear();
+                        for (uint_fast64_t choice = rowGroupIndices[*stateIt]; choice < rowGroupIndices[*stateIt + 1]; ++choice) {
+                            signature.emplace_back(choiceRewards != nullptr ? (*choiceRewards)[choice] : storm::utility::zero<ValueType>());
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (!comparator.isZero(entry.getValue())) {
+                                    signature.back().addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                                }
+                            }
+                        }
+                        
+                        // Choices with the same distribution only count once.
+                        std::sort(signature.begin(), signature.end(), [this] (storm::storage::DistributionWithReward<ValueType> const& distribution1, storm::storage::DistributionWithReward<ValueType> const& distribution2) { return distribution1.less(distribution2, comparator); });
+                        signature.erase(std::unique(signature.begin(), signature.end(), [this] (storm::storage::DistributionWithReward<ValueType> const& distribution1, storm::storage::DistributionWithReward<ValueType> const& distribution2) { return !distribution1.less(distribution2, comparator); }), signature.end());
+                    }
+                });
+                
+                // Then sort the states of each block by their signatures and determine where the signature changes.
+                // As the blocks are disjoint, this can be done for all blocks concurrently. Since the tasks are handed
+                // out in order, the largest blocks are sorted first, so they do not end up delaying the round.
+                std::vector<uint_fast64_t> blocksBySize(candidateBlocks.size());
+                std::iota(blocksBySize.begin(), blocksBySize.end(), 0);
+                std::stable_sort(blocksBySize.begin(), blocksBySize.end(), [&candidateBlocks] (uint_fast64_t block1, uint_fast64_t block2) { return candidateBlocks[block1]->getNumberOfStates() > candidateBlocks[block2]->getNumberOfStates(); });
+                std::vector<std::vector<uint_fast64_t>> splitPositions(candidateBlocks.size());
+                runTasks(candidateBlocks.size(), [&] (uint64_t task) {
+                    uint_fast64_t blockIndex = blocksBySize[task];
+                    Block<BlockDataType>& block = *candidateBlocks[blockIndex];
+                    partition.sortBlock(block, signatureLess);
+                    for (auto stateIt = partition.begin(block) + 1, stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+                        if (signatureLess(*std::prev(stateIt), *stateIt)) {
+                            splitPositions[blockIndex].push_back(std::distance(partition.begin(), stateIt));
+                        }
+                    }
+                });
+                
+                // Finally, split all blocks at once. This has to be done sequentially, as it creates new blocks.
+                partitionChanged = false;
+                for (uint_fast64_t blockIndex = 0; blockIndex < candidateBlocks.size(); ++blockIndex) {
+                    for (auto const& position : splitPositions[blockIndex]) {
+                        partition.splitBlock(*candidateBlocks[blockIndex], position);
+                        partitionChanged = true;
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Signature-based refinement took " << iterations << " rounds and produced " << partition.size() << " blocks.");
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
@@ -8,6 +8,7 @@
 #include "storm/storage/StateBlock.h"
 #include "storm/storage/bisimulation/Partition.h"
 #include "storm/storage/bisimulation/BisimulationType.h"
+#include "storm/storage/bisimulation/SparseRefinementMode.h"
 #include "storm/solver/OptimizationDirection.h"
 
 #include "storm/logic/Formulas.h"
@@ -132,6 +133,13 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// The mode in which the partition is refined. Signature-based refinement is only available for strong
+                /// bisimulation; for weak bisimulation, the splitter-based refinement is used.
+                bisimulation::SparseRefinementMode refinementMode;
+                
+                /// The number of threads used by the signature-based refinement (zero means all hardware threads).
+                uint64_t numberOfThreads;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -222,6 +230,15 @@ namespace storm {
              */
             virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) = 0;
             
+            /*!
+             * Performs the partition refinement in rounds. In every round, the signature of each state (the set of
+             * distributions over the current blocks induced by its choices) is computed and all blocks are split
+             * according to the signatures of their states at once. The refinement stops as soon as a round does not
+             * split any block, so the resulting partition coincides with the one of the splitter-based refinement.
+             * Only applicable to strong bisimulation.
+             */
+            void performSignatureRefinement();
+            
             /*!
              * Builds the quotient model based on the previously computed equivalence classes (stored in the blocks
              * of the decomposition.
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace storm {
+    namespace storage {
+        namespace bisimulation {
+            
+            // The modes of refining the partition in the sparse bisimulation: splitter-based refinement refines the
+            // blocks with respect to one splitter at a time, signature-based refinement splits all blocks in rounds.
+            enum class SparseRefinementMode { Splitter, Signature };
+            
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/Add.h"
 
+#include <algorithm>
 #include <cstdint>
 
 #include <boost/algorithm/string/join.hpp>
@@ -378,6 +379,28 @@ namespace storm {
             
             return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrix(otherMatrix.getInternalBdd(), summationDdVariables), containedMetaVariables);
         }
+        
+        template<DdType LibraryType, typename ValueType>
+        Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrixAndAbstract(Add<LibraryType, ValueType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables, Add<LibraryType, ValueType> const& offset, std::set<storm::expressions::Variable> const& abstractionMetaVariables, bool maximize) const {
+            // Create the summation variables.
+            std::vector<InternalBdd<LibraryType>> summationDdVariables;
+            for (auto const& metaVariable : summationMetaVariables) {
+                for (auto const& ddVariable : this->getDdManager().getMetaVariable(metaVariable).getDdVariables()) {
+                    summationDdVariables.push_back(ddVariable.getInternalBdd());
+                }
+            }
+            Bdd<LibraryType> abstractionCube = Bdd<LibraryType>::getCube(this->getDdManager(), abstractionMetaVariables);
+            
+            std::set<storm::expressions::Variable> productMetaVariables = Dd<LibraryType>::joinMetaVariables(*this, otherMatrix);
+            std::set<storm::expressions::Variable> summedMetaVariables;
+            std::set_difference(productMetaVariables.begin(), productMetaVariables.end(), summationMetaVariables.begin(), summationMetaVariables.end(), std::inserter(summedMetaVariables, summedMetaVariables.begin()));
+            std::set<storm::expressions::Variable> unionOfMetaVariables;
+            std::set_union(summedMetaVariables.begin(), summedMetaVariables.end(), offset.getContainedMetaVariables().begin(), offset.getContainedMetaVariables().end(), std::inserter(unionOfMetaVariables, unionOfMetaVariables.begin()));
+            std::set<storm::expressions::Variable> containedMetaVariables;
+            std::set_difference(unionOfMetaVariables.begin(), unionOfMetaVariables.end(), abstractionMetaVariables.begin(), abstractionMetaVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
+            
+            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrixAndAbstract(otherMatrix, summationDdVariables, offset, abstractionCube.getInternalBdd(), maximize), containedMetaVariables);
+        }
 
         template<DdType LibraryType, typename ValueType>
         Bdd<LibraryType> Add<LibraryType, ValueType>::greater(ValueType const& value) const {
@@ -438,6 +461,41 @@ namespace storm {
             return internalAdd.getNodeCount();
         }
         
+        template<DdType LibraryType, typename ValueType>
+        uint_fast64_t Add<LibraryType, ValueType>::getNodeCountForOrder(std::vector<std::set<storm::expressions::Variable>> const& metaVariableGroups) const {
+            auto levelLess = [] (Bdd<LibraryType> const& first, Bdd<LibraryType> const& second) { return first.getLevel() < second.getLevel(); };
+            
+            // Collect the DD variables in the requested order.
+            std::vector<Bdd<LibraryType>> ddVariables;
+            for (auto const& group : metaVariableGroups) {
+                std::vector<Bdd<LibraryType>> groupDdVariables;
+                for (auto const& metaVariable : group) {
+                    std::vector<Bdd<LibraryType>> const& metaVariableDdVariables = this->getDdManager().getMetaVariable(metaVariable).getDdVariables();
+                    groupDdVariables.insert(groupDdVariables.end(), metaVariableDdVariables.begin(), metaVariableDdVariables.end());
+                }
+                std::sort(groupDdVariables.begin(), groupDdVariables.end(), levelLess);
+                ddVariables.insert(ddVariables.end(), groupDdVariables.begin(), groupDdVariables.end());
+            }
+            
+            // The i-th of the DD variables (in the requested order) is moved to the i-th lowest level that is occupied
+            // by any of the DD variables.
+            std::vector<Bdd<LibraryType>> sortedDdVariables = ddVariables;
+            std::sort(sortedDdVariables.begin(), sortedDdVariables.end(), levelLess);
+            std::vector<InternalBdd<LibraryType>> from;
+            std::vector<InternalBdd<LibraryType>> to;
+            for (uint64_t index = 0; index < ddVariables.size(); ++index) {
+                if (ddVariables[index].getLevel() != sortedDdVariables[index].getLevel()) {
+                    from.push_back(ddVariables[index].getInternalBdd());
+                    to.push_back(sortedDdVariables[index].getInternalBdd());
+                }
+            }
+            
+            if (from.empty()) {
+                return this->getNodeCount();
+            }
+            return internalAdd.permuteVariables(from, to).getNodeCount();
+        }
+        
         template<DdType LibraryType, typename ValueType>
         ValueType Add<LibraryType, ValueType>::getMin() const {
             return internalAdd.getMin();
@@ -385,6 +385,22 @@ namespace storm {
              */
             Add<LibraryType, ValueType> multiplyMatrix(Bdd<LibraryType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables) const;
 
+            /*!
+             * Multiplies the current ADD (representing a matrix) with the given matrix by summing over the given meta
+             * variables, adds the given offset and then abstracts from the given meta variables by taking the minimum
+             * (or maximum). The result is the same as that of the individual operations, but if the library supports
+             * it, they are performed as one operation, which avoids building the intermediate results.
+             *
+             * @param otherMatrix The matrix with which to multiply.
+             * @param summationMetaVariables The names of the meta variables over which to sum during the matrix-
+             * matrix multiplication.
+             * @param offset The ADD that is added to the result of the multiplication.
+             * @param abstractionMetaVariables The meta variables from which to abstract after adding the offset.
+             * @param maximize If set, the maximum is taken when abstracting and the minimum otherwise.
+             * @return The resulting ADD.
+             */
+            Add<LibraryType, ValueType> multiplyMatrixAndAbstract(Add<LibraryType, ValueType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables, Add<LibraryType, ValueType> const& offset, std::set<storm::expressions::Variable> const& abstractionMetaVariables, bool maximize) const;
+
             /*!
              * Computes a BDD that represents the function in which all assignments with a function value strictly
              * larger than the given value are mapped to one and all others to zero.
@@ -477,6 +493,17 @@ namespace storm {
              */
             virtual uint_fast64_t getNodeCount() const override;
             
+            /*!
+             * Retrieves the number of nodes that would be necessary to represent the DD if the DD variables of the
+             * given groups of meta variables were ordered such that the groups appear in the given order. The DD
+             * variables of a group keep their relative order and the positions of all other DD variables remain the
+             * same. The DD itself is not changed.
+             *
+             * @param metaVariableGroups The (disjoint) groups of meta variables in the order to consider.
+             * @return The number of nodes of the reordered DD.
+             */
+            uint_fast64_t getNodeCountForOrder(std::vector<std::set<storm::expressions::Variable>> const& metaVariableGroups) const;
+            
             /*!
              * Retrieves the lowest function value of any encoding.
              *
@@ -12,6 +12,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -24,10 +25,11 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<PartitionRefiner<DdType, ValueType>> createRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialPartition) {
+            bool incrementalSignatures = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getRefinementMode() == storm::settings::modules::BisimulationSettings::RefinementMode::Incremental;
             if (model.isOfType(storm::models::ModelType::Mdp) || model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
-                return std::make_unique<NondeterministicModelPartitionRefiner<DdType, ValueType>>(*model.template as<storm::models::symbolic::NondeterministicModel<DdType, ValueType>>(), initialPartition);
+                return std::make_unique<NondeterministicModelPartitionRefiner<DdType, ValueType>>(*model.template as<storm::models::symbolic::NondeterministicModel<DdType, ValueType>>(), initialPartition, incrementalSignatures);
             } else {
-                return std::make_unique<PartitionRefiner<DdType, ValueType>>(model, initialPartition);
+                return std::make_unique<PartitionRefiner<DdType, ValueType>>(model, initialPartition, incrementalSignatures);
             }
         }
         
@@ -0,0 +1,219 @@
+#include "storm/storage/dd/DdTranslationCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace dd {
+        
+        // A node of CUDD occupies 32 bytes on 64-bit platforms. Sylvan's nodes are smaller, but its unique table adds
+        // some overhead per node.
+        template<DdType LibraryType, typename ValueType>
+        const uint64_t DdTranslationCache<LibraryType, ValueType>::ddNodeSize = 32;
+        
+        template<DdType LibraryType, typename ValueType>
+        DdTranslationCache<LibraryType, ValueType>::DdTranslationCache(uint64_t capacity, uint64_t memoryLimit) : capacity(capacity), memoryLimit(memoryLimit), memoryUsage(0), useCounter(0), hits(0), misses(0) {
+            // Intentionally left empty.
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        bool DdTranslationCache<LibraryType, ValueType>::isEnabled() const {
+            return capacity > 0;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        Odd DdTranslationCache<LibraryType, ValueType>::getOdd(Bdd<LibraryType> const& states) {
+            return lookup<Bdd<LibraryType>, Odd>(odds, states, [&states] () { return states.createOdd(); });
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> DdTranslationCache<LibraryType, ValueType>::getMatrix(Add<LibraryType, ValueType> const& matrix, Bdd<LibraryType> const& states) {
+            MatrixKey key = {matrix, boost::none, {}, states};
+            return lookup<MatrixKey, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>>(matrices, key, [&] () {
+                Odd odd = this->getOdd(states);
+                return std::make_shared<storm::storage::SparseMatrix<ValueType>>(matrix.toMatrix(odd, odd));
+            });
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> DdTranslationCache<LibraryType, ValueType>::getMatrix(Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& groupMetaVariables, Bdd<LibraryType> const& states) {
+            MatrixKey key = {matrix, boost::none, groupMetaVariables, states};
+            return lookup<MatrixKey, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>>(matrices, key, [&] () {
+                Odd odd = this->getOdd(states);
+                return std::make_shared<storm::storage::SparseMatrix<ValueType>>(matrix.toMatrix(groupMetaVariables, odd, odd));
+            });
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> DdTranslationCache<LibraryType, ValueType>::getMatrixVector(Add<LibraryType, ValueType> const& matrix, Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& groupMetaVariables, Bdd<LibraryType> const& states) {
+            MatrixKey key = {matrix, vector, groupMetaVariables, states};
+            return lookup<MatrixKey, std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const>>(matrixVectors, key, [&] () {
+                Odd odd = this->getOdd(states);
+                return std::make_shared<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(matrix.toMatrixVector(vector, groupMetaVariables, odd, odd));
+            });
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<std::vector<ValueType> const> DdTranslationCache<LibraryType, ValueType>::getVector(Add<LibraryType, ValueType> const& vector, Bdd<LibraryType> const& states) {
+            std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> key(vector, states);
+            return lookup<std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>>, std::shared_ptr<std::vector<ValueType> const>>(vectors, key, [&] () {
+                return std::make_shared<std::vector<ValueType>>(vector.toVector(this->getOdd(states)));
+            });
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        void DdTranslationCache<LibraryType, ValueType>::clear() {
+            odds.clear();
+            matrices.clear();
+            matrixVectors.clear();
+            vectors.clear();
+            memoryUsage = 0;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getNumberOfHits() const {
+            return hits;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getNumberOfMisses() const {
+            return misses;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getMemoryUsage() const {
+            return memoryUsage;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        template<typename KeyType, typename EntryType>
+        EntryType DdTranslationCache<LibraryType, ValueType>::lookup(std::list<Entry<KeyType, EntryType>>& entries, KeyType const& key, std::function<EntryType ()> const& compute) {
+            ++useCounter;
+            for (auto it = entries.begin(); it != entries.end(); ++it) {
+                if (matches(it->key, key)) {
+                    ++hits;
+                    it->lastUse = useCounter;
+                    entries.splice(entries.begin(), entries, it);
+                    return entries.front().value;
+                }
+            }
+            
+            ++misses;
+            EntryType value = compute();
+            if (capacity == 0) {
+                return value;
+            }
+            uint64_t size = getSize(value) + getKeySize(key);
+            entries.push_front(Entry<KeyType, EntryType>{key, value, size, useCounter});
+            memoryUsage += size;
+            if (entries.size() > capacity) {
+                memoryUsage -= entries.back().size;
+                entries.pop_back();
+            }
+            enforceMemoryLimit();
+            return value;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        void DdTranslationCache<LibraryType, ValueType>::enforceMemoryLimit() {
+            while (memoryUsage > memoryLimit) {
+                // Determine the kind of translation whose least recently used entry is the oldest one.
+                uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+                std::function<void ()> evictOldest;
+                auto consider = [&] (auto& entries) {
+                    if (!entries.empty() && entries.back().lastUse < oldestUse) {
+                        oldestUse = entries.back().lastUse;
+                        evictOldest = [this, &entries] () {
+                            memoryUsage -= entries.back().size;
+                            entries.pop_back();
+                        };
+                    }
+                };
+                consider(odds);
+                consider(matrices);
+                consider(matrixVectors);
+                consider(vectors);
+                STORM_LOG_ASSERT(evictOldest, "Memory usage of empty cache is not zero.");
+                evictOldest();
+            }
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getSize(Odd const& odd) {
+            return odd.getStorageSize();
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getSize(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& matrix) {
+            return getSize(*matrix);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getSize(std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> const& matrixVector) {
+            return getSize(matrixVector->first) + matrixVector->second.size() * sizeof(ValueType);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getSize(std::shared_ptr<std::vector<ValueType> const> const& vector) {
+            return vector->size() * sizeof(ValueType);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getSize(storm::storage::SparseMatrix<ValueType> const& matrix) {
+            uint64_t result = matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) + (matrix.getRowCount() + 1) * sizeof(uint_fast64_t);
+            if (!matrix.hasTrivialRowGrouping()) {
+                result += (matrix.getRowGroupCount() + 1) * sizeof(uint_fast64_t);
+            }
+            return result;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getKeySize(Bdd<LibraryType> const& states) {
+            return states.getNodeCount() * ddNodeSize;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getKeySize(MatrixKey const& key) {
+            uint64_t result = key.matrix.getNodeCount() * ddNodeSize + getKeySize(key.states);
+            if (key.vector) {
+                result += key.vector.get().getNodeCount() * ddNodeSize;
+            }
+            return result;
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        uint64_t DdTranslationCache<LibraryType, ValueType>::getKeySize(std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& key) {
+            return key.first.getNodeCount() * ddNodeSize + getKeySize(key.second);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        bool DdTranslationCache<LibraryType, ValueType>::matches(Bdd<LibraryType> const& first, Bdd<LibraryType> const& second) {
+            return first == second && first.getContainedMetaVariables() == second.getContainedMetaVariables();
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        bool DdTranslationCache<LibraryType, ValueType>::matches(MatrixKey const& first, MatrixKey const& second) {
+            if (!(first.matrix == second.matrix) || first.matrix.getContainedMetaVariables() != second.matrix.getContainedMetaVariables()) {
+                return false;
+            }
+            if (static_cast<bool>(first.vector) != static_cast<bool>(second.vector)) {
+                return false;
+            }
+            if (first.vector && (!(first.vector.get() == second.vector.get()) || first.vector.get().getContainedMetaVariables() != second.vector.get().getContainedMetaVariables())) {
+                return false;
+            }
+            return first.groupMetaVariables == second.groupMetaVariables && matches(first.states, second.states);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        bool DdTranslationCache<LibraryType, ValueType>::matches(std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& first, std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& second) {
+            return first.first == second.first && first.first.getContainedMetaVariables() == second.first.getContainedMetaVariables() && matches(first.second, second.second);
+        }
+        
+        template class DdTranslationCache<storm::dd::DdType::CUDD, double>;
+        template class DdTranslationCache<storm::dd::DdType::Sylvan, double>;
+        template class DdTranslationCache<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        template class DdTranslationCache<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+    
+    }
+}
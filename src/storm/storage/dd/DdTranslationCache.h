@@ -0,0 +1,216 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace dd {
+        
+        /*!
+         * Stores the results of translating DDs to explicit data structures, so that they can be reused. Hybrid
+         * engines frequently translate the same matrix restricted to the same set of states (e.g. the reachable
+         * states), either for several properties or repeatedly while checking a single property. Each kind of
+         * translation keeps only the most recently used results (up to the capacity of the cache). Additionally, the
+         * least recently used results (of any kind) are evicted whenever the explicit data structures held by the
+         * cache exceed its memory limit.
+         *
+         * Entries are identified by the DDs they were computed from, which are kept alive by the cache. Therefore, the
+         * memory usage of an entry also includes (an estimate of) the nodes of these DDs, even though they may be
+         * shared with other DDs. The cache is not thread-safe.
+         *
+         * The explicit data structures are handed out as shared pointers. Consumers that only read them may keep the
+         * pointer for as long as they need the data structure, while consumers that take ownership of them should
+         * use takeTranslation, which avoids a copy if the cache does not keep the data structure (e.g. because it is
+         * disabled).
+         */
+        template<DdType LibraryType, typename ValueType>
+        class DdTranslationCache {
+        public:
+            /*!
+             * Creates an empty cache.
+             *
+             * @param capacity The maximal number of entries that is stored for each kind of translation. A value of
+             * zero disables the cache.
+             * @param memoryLimit The maximal (approximate) number of bytes occupied by the cached data structures and
+             * the DD nodes of their keys.
+             */
+            DdTranslationCache(uint64_t capacity = 8, uint64_t memoryLimit = std::numeric_limits<uint64_t>::max());
+            
+            /*!
+             * Retrieves whether the cache stores any translations.
+             */
+            bool isEnabled() const;
+            
+            /*!
+             * Retrieves the ODD of the given set of states.
+             */
+            Odd getOdd(Bdd<LibraryType> const& states);
+            
+            /*!
+             * Retrieves the explicit representation of the given matrix whose rows and columns are both restricted to
+             * (and numbered according to the ODD of) the given states.
+             */
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getMatrix(Add<LibraryType, ValueType> const& matrix, Bdd<LibraryType> const& states);
+            
+            /*!
+             * Retrieves the explicit representation of the given matrix with nondeterminism whose row groups and
+             * columns are both restricted to (and numbered according to the ODD of) the given states.
+             *
+             * @param groupMetaVariables The meta variables that encode the nondeterministic choices.
+             */
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getMatrix(Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& groupMetaVariables, Bdd<LibraryType> const& states);
+            
+            /*!
+             * Retrieves the explicit representation of the given matrix with nondeterminism and the given vector
+             * (that is translated with respect to the choices of the matrix).
+             *
+             * @param groupMetaVariables The meta variables that encode the nondeterministic choices.
+             */
+            std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> getMatrixVector(Add<LibraryType, ValueType> const& matrix, Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& groupMetaVariables, Bdd<LibraryType> const& states);
+            
+            /*!
+             * Retrieves the explicit representation of the given vector restricted to the given states.
+             */
+            std::shared_ptr<std::vector<ValueType> const> getVector(Add<LibraryType, ValueType> const& vector, Bdd<LibraryType> const& states);
+            
+            /*!
+             * Removes all entries from the cache.
+             */
+            void clear();
+            
+            /*!
+             * Retrieves the number of translations that could be taken from the cache.
+             */
+            uint64_t getNumberOfHits() const;
+            
+            /*!
+             * Retrieves the number of translations that had to be computed.
+             */
+            uint64_t getNumberOfMisses() const;
+            
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the cached data structures.
+             */
+            uint64_t getMemoryUsage() const;
+        
+        private:
+            template<typename KeyType, typename EntryType>
+            struct Entry {
+                KeyType key;
+                EntryType value;
+                
+                // The (approximate) number of bytes occupied by the value and the DD nodes of the key.
+                uint64_t size;
+                
+                // The time of the most recent use of the entry.
+                uint64_t lastUse;
+            };
+            
+            struct MatrixKey {
+                Add<LibraryType, ValueType> matrix;
+                boost::optional<Add<LibraryType, ValueType>> vector;
+                std::set<storm::expressions::Variable> groupMetaVariables;
+                Bdd<LibraryType> states;
+            };
+            
+            /*!
+             * Looks up the value for the given key in the given list of entries. If there is no such entry, the value
+             * is computed and inserted. Either way, the entry becomes the most recently used one. The value is
+             * returned by copy, as the entry may be evicted right away (the values are cheap to copy).
+             */
+            template<typename KeyType, typename EntryType>
+            EntryType lookup(std::list<Entry<KeyType, EntryType>>& entries, KeyType const& key, std::function<EntryType ()> const& compute);
+            
+            /*!
+             * Removes the least recently used entries (of all kinds) until the memory limit is respected.
+             */
+            void enforceMemoryLimit();
+            
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the given value.
+             */
+            static uint64_t getSize(Odd const& odd);
+            static uint64_t getSize(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& matrix);
+            static uint64_t getSize(std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const> const& matrixVector);
+            static uint64_t getSize(std::shared_ptr<std::vector<ValueType> const> const& vector);
+            static uint64_t getSize(storm::storage::SparseMatrix<ValueType> const& matrix);
+            
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the DD nodes of the given key.
+             */
+            static uint64_t getKeySize(Bdd<LibraryType> const& states);
+            static uint64_t getKeySize(MatrixKey const& key);
+            static uint64_t getKeySize(std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& key);
+            
+            /*!
+             * Checks whether the two given keys are identical. For sets of states, this includes their meta variables,
+             * because the meta variables determine the shape of the ODD.
+             */
+            static bool matches(Bdd<LibraryType> const& first, Bdd<LibraryType> const& second);
+            static bool matches(MatrixKey const& first, MatrixKey const& second);
+            static bool matches(std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& first, std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>> const& second);
+            
+            // The (approximate) number of bytes occupied by a DD node.
+            static const uint64_t ddNodeSize;
+            
+            // The maximal number of entries for each kind of translation.
+            uint64_t capacity;
+            
+            // The maximal number of bytes occupied by the cached values and the DD nodes of their keys.
+            uint64_t memoryLimit;
+            
+            // The number of bytes occupied by the cached values and the DD nodes of their keys.
+            uint64_t memoryUsage;
+            
+            // A counter that is increased with every use of the cache and serves as the time of the uses.
+            uint64_t useCounter;
+            
+            // The cached translations, the most recently used ones first.
+            std::list<Entry<Bdd<LibraryType>, Odd>> odds;
+            std::list<Entry<MatrixKey, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>>> matrices;
+            std::list<Entry<MatrixKey, std::shared_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> const>>> matrixVectors;
+            std::list<Entry<std::pair<Add<LibraryType, ValueType>, Bdd<LibraryType>>, std::shared_ptr<std::vector<ValueType> const>>> vectors;
+            
+            // Statistics about the use of the cache.
+            uint64_t hits;
+            uint64_t misses;
+        };
+        
+        /*!
+         * Retrieves whether the given explicit data structure (as returned by a translation cache) is kept by the
+         * cache (or another owner) in addition to the caller.
+         */
+        template<typename T>
+        bool isSharedTranslation(std::shared_ptr<T const> const& translation) {
+            return translation.use_count() > 1;
+        }
+        
+        /*!
+         * Retrieves the given explicit data structure (as returned by a translation cache) for a consumer that takes
+         * ownership of it. If the cache keeps the data structure, it is copied. Otherwise, the caller is its only
+         * owner and it is moved out of the given pointer, which is reset.
+         */
+        template<typename T>
+        T takeTranslation(std::shared_ptr<T const>&& translation) {
+            std::shared_ptr<T const> owned = std::move(translation);
+            if (isSharedTranslation(owned)) {
+                return *owned;
+            }
+            // The cache creates its data structures as non-const objects, so it is safe to move from one that is not shared.
+            return std::move(const_cast<T&>(*owned));
+        }
+    
+    }
+}
@@ -12,80 +12,96 @@
 
 namespace storm {
     namespace dd {
-        Odd::Odd(std::shared_ptr<Odd> elseNode, uint_fast64_t elseOffset, std::shared_ptr<Odd> thenNode, uint_fast64_t thenOffset) : elseNode(elseNode), thenNode(thenNode), elseOffset(elseOffset), thenOffset(thenOffset) {
-            STORM_LOG_ASSERT(this != elseNode.get() && this != thenNode.get(), "Cyclic ODD.");
-        }
+        const Odd::node_index_type Odd::noNode;
         
-        Odd const& Odd::getThenSuccessor() const {
-            return *this->thenNode;
+        Odd::Odd(std::shared_ptr<std::vector<Node> const> const& storage, Node const* nodes, node_index_type index) : storage(storage), nodes(nodes), index(index) {
+            // Intentionally left empty.
         }
         
-        Odd const& Odd::getElseSuccessor() const {
-            return *this->elseNode;
+        Odd::Node const& Odd::getNode() const {
+            static const Node emptyNode = {0, 0, noNode, noNode};
+            if (nodes == nullptr) {
+                return emptyNode;
+            }
+            return nodes[index];
         }
         
-        uint_fast64_t Odd::getElseOffset() const {
-            return this->elseOffset;
+        Odd Odd::getThenSuccessor() const {
+            return Odd(nullptr, nodes, this->getNode().thenNode);
         }
         
-        void Odd::setElseOffset(uint_fast64_t newOffset) {
-            this->elseOffset = newOffset;
+        Odd Odd::getElseSuccessor() const {
+            return Odd(nullptr, nodes, this->getNode().elseNode);
         }
         
-        uint_fast64_t Odd::getThenOffset() const {
-            return this->thenOffset;
+        uint_fast64_t Odd::getElseOffset() const {
+            return this->getNode().elseOffset;
         }
         
-        void Odd::setThenOffset(uint_fast64_t newOffset) {
-            this->thenOffset = newOffset;
+        uint_fast64_t Odd::getThenOffset() const {
+            return this->getNode().thenOffset;
         }
         
         uint_fast64_t Odd::getTotalOffset() const {
-            return this->elseOffset + this->thenOffset;
+            Node const& node = this->getNode();
+            return node.elseOffset + node.thenOffset;
         }
         
         uint_fast64_t Odd::getNodeCount() const {
             // If the ODD contains a constant (and thus has no children), the size is 1.
-            if (this->elseNode == nullptr && this->thenNode == nullptr) {
+            if (this->isTerminalNode()) {
                 return 1;
             }
             
             // If the two successors are actually the same, we need to count the subnodes only once.
-            if (this->elseNode == this->thenNode) {
-                return this->elseNode->getNodeCount();
+            Node const& node = this->getNode();
+            if (node.elseNode == node.thenNode) {
+                return this->getElseSuccessor().getNodeCount();
             } else {
-                return this->elseNode->getNodeCount() + this->thenNode->getNodeCount();
+                return this->getElseSuccessor().getNodeCount() + this->getThenSuccessor().getNodeCount();
             }
         }
         
+        uint_fast64_t Odd::getStorageSize() const {
+            return storage ? storage->size() * sizeof(Node) : 0;
+        }
+        
         uint_fast64_t Odd::getHeight() const {
             if (this->isTerminalNode()) {
                 return 1;
-            } else {
-                // Since both subtrees have the same height, we only count the height of the else-tree.
-                return 1 + this->getElseSuccessor().getHeight();
             }
+            
+            // Since both subtrees have the same height, we only count the height of the else-tree.
+            uint_fast64_t height = 1;
+            for (node_index_type current = index; nodes[current].elseNode != noNode; current = nodes[current].elseNode) {
+                ++height;
+            }
+            return height;
         }
         
         bool Odd::isTerminalNode() const {
-            return this->elseNode == nullptr && this->thenNode == nullptr;
+            Node const& node = this->getNode();
+            return node.elseNode == noNode && node.thenNode == noNode;
         }
         
         template <typename ValueType>
         void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<ValueType> const& oldValues, std::vector<ValueType>& newValues) const {
-            expandValuesToVectorRec(0, *this, oldValues, 0, newOdd, newValues);
+            STORM_LOG_THROW(this->nodes != nullptr && newOdd.nodes != nullptr, storm::exceptions::InvalidArgumentException, "Cannot translate values using an empty ODD.");
+            expandValuesToVectorRec(0, this->nodes, this->index, oldValues, 0, newOdd.nodes, newOdd.index, newValues);
         }
         
         template <typename ValueType>
-        void Odd::expandValuesToVectorRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::vector<ValueType>& newValues) {
-            if (oldOdd.isTerminalNode()) {
-                STORM_LOG_THROW(newOdd.isTerminalNode(), storm::exceptions::InvalidArgumentException, "The ODDs for the translation must have the same height.");
-                if (oldOdd.getThenOffset() != 0) {
+        void Odd::expandValuesToVectorRec(uint_fast64_t oldOffset, Node const* oldNodes, node_index_type oldNode, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, Node const* newNodes, node_index_type newNode, std::vector<ValueType>& newValues) {
+            Node const& oldOdd = oldNodes[oldNode];
+            Node const& newOdd = newNodes[newNode];
+            if (oldOdd.elseNode == noNode) {
+                STORM_LOG_THROW(newOdd.elseNode == noNode, storm::exceptions::InvalidArgumentException, "The ODDs for the translation must have the same height.");
+                if (oldOdd.thenOffset != 0) {
                     newValues[newOffset] += oldValues[oldOffset];
                 }
             } else {
-                expandValuesToVectorRec(oldOffset, oldOdd.getElseSuccessor(), oldValues, newOffset, newOdd.getElseSuccessor(), newValues);
-                expandValuesToVectorRec(oldOffset + oldOdd.getElseOffset(), oldOdd.getThenSuccessor(), oldValues, newOffset + newOdd.getElseOffset(), newOdd.getThenSuccessor(), newValues);
+                expandValuesToVectorRec(oldOffset, oldNodes, oldOdd.elseNode, oldValues, newOffset, newNodes, newOdd.elseNode, newValues);
+                expandValuesToVectorRec(oldOffset + oldOdd.elseOffset, oldNodes, oldOdd.thenNode, oldValues, newOffset + newOdd.elseOffset, newNodes, newOdd.thenNode, newValues);
             }
         }
         
@@ -105,8 +121,10 @@ namespace storm {
             dotFile << boost::join(levelNames, " -> ") << ";";
             dotFile << "}" << std::endl;
             
-            std::map<uint_fast64_t, std::unordered_set<storm::dd::Odd const*>> levelToOddNodesMap;
-            this->addToLevelToOddNodesMap(levelToOddNodesMap);
+            std::map<uint_fast64_t, std::unordered_set<node_index_type>> levelToOddNodesMap;
+            if (this->nodes != nullptr) {
+                this->addToLevelToOddNodesMap(levelToOddNodesMap, this->index);
+            }
             
             for (auto const& levelNodes : levelToOddNodesMap) {
                 dotFile << "{ rank = same; \"" << levelNodes.first << "\"" << std::endl;;
@@ -118,10 +136,11 @@ namespace storm {
             
             for (auto const& levelNodes : levelToOddNodesMap) {
                 for (auto const& node : levelNodes.second) {
-                    dotFile << "\"" << node << "\" [label=\"" << node->getTotalOffset() << "\"];" << std::endl;
-                    if (!node->isTerminalNode()) {
-                        dotFile << "\"" << node << "\" -> \"" << &node->getElseSuccessor() << "\" [style=dashed, label=\"0\"];" << std::endl;
-                        dotFile << "\"" << node << "\" -> \"" << &node->getThenSuccessor() << "\" [style=solid, label=\"" << node->getElseOffset() << "\"];" << std::endl;
+                    Node const& oddNode = nodes[node];
+                    dotFile << "\"" << node << "\" [label=\"" << (oddNode.elseOffset + oddNode.thenOffset) << "\"];" << std::endl;
+                    if (oddNode.elseNode != noNode) {
+                        dotFile << "\"" << node << "\" -> \"" << oddNode.elseNode << "\" [style=dashed, label=\"0\"];" << std::endl;
+                        dotFile << "\"" << node << "\" -> \"" << oddNode.thenNode << "\" [style=solid, label=\"" << oddNode.elseOffset << "\"];" << std::endl;
                     }
                 }
             }
@@ -130,16 +149,42 @@ namespace storm {
             storm::utility::closeFile(dotFile);
         }
         
-        void Odd::addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<storm::dd::Odd const*>>& levelToOddNodesMap, uint_fast64_t level) const {
-            levelToOddNodesMap[level].emplace(this);
-            if (!this->isTerminalNode()) {
-                this->getElseSuccessor().addToLevelToOddNodesMap(levelToOddNodesMap, level + 1);
-                if (this->thenNode != this->elseNode) {
-                    this->getThenSuccessor().addToLevelToOddNodesMap(levelToOddNodesMap, level + 1);
-                }
+        void Odd::addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<node_index_type>>& levelToOddNodesMap, node_index_type node, uint_fast64_t level) const {
+            if (!levelToOddNodesMap[level].emplace(node).second) {
+                return;
+            }
+            Node const& oddNode = nodes[node];
+            if (oddNode.elseNode != noNode) {
+                this->addToLevelToOddNodesMap(levelToOddNodesMap, oddNode.elseNode, level + 1);
+                this->addToLevelToOddNodesMap(levelToOddNodesMap, oddNode.thenNode, level + 1);
             }
         }
         
+        Odd::node_index_type Odd::Builder::addTerminalNode(uint_fast64_t elseOffset, uint_fast64_t thenOffset) {
+            STORM_LOG_THROW(nodes.size() < noNode, storm::exceptions::InvalidArgumentException, "Too many ODD nodes.");
+            nodes.push_back(Node{elseOffset, thenOffset, noNode, noNode});
+            return static_cast<node_index_type>(nodes.size() - 1);
+        }
+        
+        Odd::node_index_type Odd::Builder::addNode(node_index_type elseNode, uint_fast64_t elseOffset, node_index_type thenNode, uint_fast64_t thenOffset) {
+            STORM_LOG_THROW(nodes.size() < noNode, storm::exceptions::InvalidArgumentException, "Too many ODD nodes.");
+            STORM_LOG_ASSERT(elseNode < nodes.size() && thenNode < nodes.size(), "Successors of ODD node must be added first.");
+            nodes.push_back(Node{elseOffset, thenOffset, elseNode, thenNode});
+            return static_cast<node_index_type>(nodes.size() - 1);
+        }
+        
+        uint_fast64_t Odd::Builder::getTotalOffset(node_index_type node) const {
+            return nodes[node].elseOffset + nodes[node].thenOffset;
+        }
+        
+        Odd Odd::Builder::build(node_index_type rootNode) {
+            STORM_LOG_THROW(rootNode < nodes.size(), storm::exceptions::InvalidArgumentException, "Illegal root node of ODD.");
+            nodes.shrink_to_fit();
+            auto storage = std::make_shared<std::vector<Node> const>(std::move(nodes));
+            nodes = std::vector<Node>();
+            return Odd(storage, storage->data(), rootNode);
+        }
+        
         template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<double> const& oldValues, std::vector<double>& newValues) const;
         template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<storm::RationalNumber> const& oldValues, std::vector<storm::RationalNumber>& newValues) const;
         template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<storm::RationalFunction> const& oldValues, std::vector<storm::RationalFunction>& newValues) const;
@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_DD_ODD_H_
 #define STORM_STORAGE_DD_ODD_H_
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <map>
 #include <memory>
@@ -10,16 +12,10 @@ namespace storm {
     namespace dd {
         class Odd {
         public:
-            /*!
-             * Constructs an offset-labeled DD with the given topmost DD node, else- and then-successor.
-             *
-             * @param dd The DD node associated with this ODD node.
-             * @param elseNode The else-successor of thie ODD node.
-             * @param elseOffset The offset of the else-successor.
-             * @param thenNode The then-successor of thie ODD node.
-             * @param thenOffset The offset of the then-successor.
-             */
-            Odd(std::shared_ptr<Odd> elseNode, uint_fast64_t elseOffset, std::shared_ptr<Odd> thenNode, uint_fast64_t thenOffset);
+            // The type of the indices of the nodes of an ODD.
+            typedef uint32_t node_index_type;
+            
+            class Builder;
             
             // Instantiate all copy/move constructors/assignments with the default implementation.
             Odd() = default;
@@ -31,18 +27,20 @@ namespace storm {
 #endif
             
             /*!
-             * Retrieves the then-successor of this ODD node.
+             * Retrieves the then-successor of this ODD node. Note that the successor refers to the nodes of this ODD,
+             * so it must not be used after this ODD was destroyed.
              *
              * @return The then-successor of this ODD node.
              */
-            Odd const& getThenSuccessor() const;
+            Odd getThenSuccessor() const;
             
             /*!
-             * Retrieves the else-successor of this ODD node.
+             * Retrieves the else-successor of this ODD node. Note that the successor refers to the nodes of this ODD,
+             * so it must not be used after this ODD was destroyed.
              *
              * @return The else-successor of this ODD node.
              */
-            Odd const& getElseSuccessor() const;
+            Odd getElseSuccessor() const;
             
             /*!
              * Retrieves the else-offset of this ODD node.
@@ -51,13 +49,6 @@ namespace storm {
              */
             uint_fast64_t getElseOffset() const;
             
-            /*!
-             * Sets the else-offset of this ODD node.
-             *
-             * @param newOffset The new else-offset of this ODD node.
-             */
-            void setElseOffset(uint_fast64_t newOffset);
-            
             /*!
              * Retrieves the then-offset of this ODD node.
              *
@@ -65,13 +56,6 @@ namespace storm {
              */
             uint_fast64_t getThenOffset() const;
             
-            /*!
-             * Sets the then-offset of this ODD node.
-             *
-             * @param newOffset The new then-offset of this ODD node.
-             */
-            void setThenOffset(uint_fast64_t newOffset);
-            
             /*!
              * Retrieves the total offset, i.e., the sum of the then- and else-offset.
              *
@@ -87,6 +71,14 @@ namespace storm {
              */
             uint_fast64_t getNodeCount() const;
             
+            /*!
+             * Retrieves the number of bytes occupied by the nodes that this ODD keeps alive. As the nodes are stored
+             * in one array, this does not require a traversal and counts shared nodes once.
+             *
+             * @return The size (in bytes) of the storage of this ODD.
+             */
+            uint_fast64_t getStorageSize() const;
+            
             /*!
              * Retrieves the height of the ODD.
              *
@@ -120,35 +112,110 @@ namespace storm {
             void exportToDot(std::string const& filename) const;
             
         private:
+            // A node of the ODD. The successors are given as indices into the array holding all nodes of the ODD.
+            struct Node {
+                // The offsets that need to be added if the then- or else-successor is taken, respectively.
+                uint_fast64_t elseOffset;
+                uint_fast64_t thenOffset;
+                
+                // The then- and else-successors.
+                node_index_type elseNode;
+                node_index_type thenNode;
+            };
+            
+            // The index that is used for the successors of terminal nodes.
+            static const node_index_type noNode = std::numeric_limits<node_index_type>::max();
+            
+            /*!
+             * Constructs an ODD handle for the given node.
+             *
+             * @param storage If given, the handle keeps the nodes alive.
+             * @param nodes The array of all nodes of the ODD.
+             * @param index The index of the node represented by the handle.
+             */
+            Odd(std::shared_ptr<std::vector<Node> const> const& storage, Node const* nodes, node_index_type index);
+            
             /*!
-             * Adds all nodes below the current one to the given mapping.
+             * Retrieves the node that is represented by this handle.
+             */
+            Node const& getNode() const;
+            
+            /*!
+             * Adds all nodes below the given one to the given mapping.
              *
              * @param levelToOddNodesMap A mapping of the level to the ODD node.
+             * @param node The current node.
              * @param The level of the current node.
              */
-            void addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<storm::dd::Odd const*>>& levelToOddNodesMap, uint_fast64_t level = 0) const;
+            void addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<node_index_type>>& levelToOddNodesMap, node_index_type node, uint_fast64_t level = 0) const;
             
             /*!
              * Adds the values of the old explicit values to the new explicit values where the positions in the old vector
              * are given by the current old ODD and the positions in the new vector are given by the new ODD.
              *
              * @param oldOffset The offset in the old explicit values.
-             * @param oldOdd The ODD to use for the old explicit values.
+             * @param oldNodes The nodes of the ODD to use for the old explicit values.
+             * @param oldNode The current node of the old ODD.
              * @param oldValues The vector of old values.
              * @param newOffset The offset in the new explicit values.
-             * @param newOdd The ODD to use for the new explicit values.
+             * @param newNodes The nodes of the ODD to use for the new explicit values.
+             * @param newNode The current node of the new ODD.
              * @param newValues The vector of new values.
              */
             template <typename ValueType>
-            static void expandValuesToVectorRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, storm::dd::Odd const& newOdd, std::vector<ValueType>& newValues);
+            static void expandValuesToVectorRec(uint_fast64_t oldOffset, Node const* oldNodes, node_index_type oldNode, std::vector<ValueType> const& oldValues, uint_fast64_t newOffset, Node const* newNodes, node_index_type newNode, std::vector<ValueType>& newValues);
             
-            // The then- and else-nodes.
-            std::shared_ptr<Odd> elseNode;
-            std::shared_ptr<Odd> thenNode;
+            // The storage of the nodes. This is only set for ODDs that were built (and their copies), but not for the
+            // successors retrieved from them, which avoids reference counting while traversing the ODD.
+            std::shared_ptr<std::vector<Node> const> storage;
+            
+            // The array of all nodes of the ODD and the index of the node represented by this object.
+            Node const* nodes = nullptr;
+            node_index_type index = 0;
+        };
+        
+        /*!
+         * Collects the nodes of an ODD in a flat array. The nodes need to be added bottom-up, that is the successors of
+         * a node need to be added before the node itself.
+         */
+        class Odd::Builder {
+        public:
+            /*!
+             * Adds a terminal node, i.e. a node without successors.
+             *
+             * @param elseOffset The else-offset of the node.
+             * @param thenOffset The then-offset of the node.
+             * @return The index of the new node.
+             */
+            node_index_type addTerminalNode(uint_fast64_t elseOffset, uint_fast64_t thenOffset);
             
-            // The offsets that need to be added if the then- or else-successor is taken, respectively.
-            uint_fast64_t elseOffset;
-            uint_fast64_t thenOffset;
+            /*!
+             * Adds a node with the given successors.
+             *
+             * @param elseNode The else-successor of the node.
+             * @param elseOffset The offset of the else-successor.
+             * @param thenNode The then-successor of the node.
+             * @param thenOffset The offset of the then-successor.
+             * @return The index of the new node.
+             */
+            node_index_type addNode(node_index_type elseNode, uint_fast64_t elseOffset, node_index_type thenNode, uint_fast64_t thenOffset);
+            
+            /*!
+             * Retrieves the total offset, i.e., the sum of the then- and else-offset of the given node.
+             */
+            uint_fast64_t getTotalOffset(node_index_type node) const;
+            
+            /*!
+             * Builds the ODD with the given root node. Afterwards, the builder is empty.
+             *
+             * @param rootNode The index of the root node.
+             * @return The ODD.
+             */
+            Odd build(node_index_type rootNode);
+            
+        private:
+            // The nodes added so far.
+            std::vector<Node> nodes;
         };
     }
 }
@@ -16,7 +16,7 @@ namespace storm {
             template <storm::dd::DdType DdType, typename ValueType>
             class NondeterministicModelPartitionRefiner : public PartitionRefiner<DdType, ValueType> {
             public:
-                NondeterministicModelPartitionRefiner(storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition);
+                NondeterministicModelPartitionRefiner(storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition, bool incrementalSignatures = false);
                 
                 /*!
                  * Refines the partition.
@@ -20,7 +20,13 @@ namespace storm {
             template <storm::dd::DdType DdType, typename ValueType>
             class PartitionRefiner {
             public:
-                PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition);
+                /*!
+                 * Creates a refiner for the given model.
+                 *
+                 * @param incrementalSignatures If set, the full signatures are computed incrementally from the ones of
+                 * the previous refinement.
+                 */
+                PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition, bool incrementalSignatures = false);
                 
                 virtual ~PartitionRefiner() = default;
                 
@@ -24,6 +24,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -228,7 +229,7 @@ namespace storm {
             template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
             class InternalSparseQuotientExtractorBase {
             public:
-                InternalSparseQuotientExtractorBase(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& partitionBdd, storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks, storm::dd::Bdd<DdType> const& representatives) : model(model), manager(model.getManager()), isNondeterministic(false), partitionBdd(partitionBdd), numberOfBlocks(numberOfBlocks), blockVariable(blockVariable), representatives(representatives), matrixEntriesCreated(false) {
+                InternalSparseQuotientExtractorBase(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& partitionBdd, storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks, storm::dd::Bdd<DdType> const& representatives) : model(model), manager(model.getManager()), isNondeterministic(false), partitionBdd(partitionBdd), numberOfBlocks(numberOfBlocks), blockVariable(blockVariable), representatives(representatives), numberOfThreads(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getQuotientNumberOfThreads()), countingMatrixEntries(false) {
                     // Create cubes.
                     rowVariablesCube = manager.getBddOne();
                     for (auto const& variable : model.getRowVariables()) {
@@ -297,14 +298,48 @@ namespace storm {
                 virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<DdType, ValueType> const& vector, storm::dd::Bdd<DdType> const& variablesCube, storm::dd::Odd const& odd) = 0;
                 
                 storm::storage::SparseMatrix<ExportValueType> createMatrixFromEntries() {
-                    for (auto& row : matrixEntries) {
-                        std::sort(row.begin(), row.end(),
-                                  [] (storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a, storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) {
-                                      return a.getColumn() < b.getColumn();
-                                  });
+                    this->finalizeMatrixEntries();
+                    uint64_t numberOfRows = rowIndications.size() - 1;
+                    
+                    // Sort the entries of every row and merge the entries that lead to the same block. As the rows are
+                    // independent, this is done in parallel (if requested).
+                    std::vector<uint64_t> rowSizes(numberOfRows);
+                    uint64_t const rowsPerChunk = 4096;
+                    uint64_t numberOfChunks = (numberOfRows + rowsPerChunk - 1) / rowsPerChunk;
+                    auto compactRows = [this, &rowSizes, numberOfRows, rowsPerChunk] (uint64_t chunk) {
+                        uint64_t lastRow = std::min(numberOfRows, (chunk + 1) * rowsPerChunk);
+                        for (uint64_t row = chunk * rowsPerChunk; row < lastRow; ++row) {
+                            auto first = matrixEntries.begin() + rowIndications[row];
+                            auto last = matrixEntries.begin() + rowIndications[row + 1];
+                            std::sort(first, last,
+                                      [] (storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a, storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) {
+                                          return a.getColumn() < b.getColumn();
+                                      });
+                            
+                            auto current = first;
+                            for (auto it = first; it != last; ++it) {
+                                if (current != first && std::prev(current)->getColumn() == it->getColumn()) {
+                                    std::prev(current)->setValue(std::prev(current)->getValue() + it->getValue());
+                                } else {
+                                    if (current != it) {
+                                        *current = std::move(*it);
+                                    }
+                                    ++current;
+                                }
+                            }
+                            rowSizes[row] = std::distance(first, current);
+                        }
+                    };
+                    // Arithmetic on other value types is not thread-safe, so we only use multiple threads for doubles.
+                    if (std::is_same<ExportValueType, double>::value && numberOfThreads != 1 && numberOfChunks > 1) {
+                        storm::utility::getThreadPool().execute(numberOfChunks, compactRows, numberOfThreads);
+                    } else {
+                        for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                            compactRows(chunk);
+                        }
                     }
                     
-                    rowPermutation = std::vector<uint64_t>(matrixEntries.size());
+                    rowPermutation = std::vector<uint64_t>(numberOfRows);
                     std::iota(rowPermutation.begin(), rowPermutation.end(), 0ull);
                     if (this->isNondeterministic) {
                         std::stable_sort(rowPermutation.begin(), rowPermutation.end(), [this] (uint64_t first, uint64_t second) { return this->rowToState[first] < this->rowToState[second]; } );
@@ -312,7 +347,7 @@ namespace storm {
                     
                     uint64_t rowCounter = 0;
                     uint64_t lastState = this->isNondeterministic ? rowToState[rowPermutation.front()] : 0;
-                    storm::storage::SparseMatrixBuilder<ExportValueType> builder(matrixEntries.size(), this->numberOfBlocks, 0, true, this->isNondeterministic);
+                    storm::storage::SparseMatrixBuilder<ExportValueType> builder(numberOfRows, this->numberOfBlocks, std::accumulate(rowSizes.begin(), rowSizes.end(), 0ull), true, this->isNondeterministic);
                     if (this->isNondeterministic) {
                         builder.newRowGroup(0);
                     }
@@ -323,41 +358,56 @@ namespace storm {
                             lastState = rowToState[rowIdx];
                         }
                         
-                        auto& row = matrixEntries[rowIdx];
-                        for (auto const& entry : row) {
-                            builder.addNextValue(rowCounter, entry.getColumn(), entry.getValue());
+                        for (auto it = matrixEntries.begin() + rowIndications[rowIdx], ite = it + rowSizes[rowIdx]; it != ite; ++it) {
+                            builder.addNextValue(rowCounter, it->getColumn(), it->getValue());
                         }
                         
-                        // Free storage for row.
-                        row.clear();
-                        row.shrink_to_fit();
-                        
                         ++rowCounter;
                     }
                     
                     rowToState.clear();
                     rowToState.shrink_to_fit();
+                    rowIndications.clear();
+                    rowIndications.shrink_to_fit();
                     matrixEntries.clear();
                     matrixEntries.shrink_to_fit();
                     
                     return builder.build();
                 }
+                
+                void countMatrixEntry(uint64_t row) {
+                    ++this->rowIndications[row + 1];
+                }
 
                 void addMatrixEntry(uint64_t row, uint64_t column, ExportValueType const& value) {
-                    this->matrixEntries[row].emplace_back(column, value);
+                    this->matrixEntries[this->rowIndications[row]++] = storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>(column, value);
                 }
                 
                 void createMatrixEntryStorage() {
-                    if (matrixEntriesCreated) {
-                        matrixEntries.clear();
-                        if (isNondeterministic) {
-                            rowToState.clear();
-                        }
-                    }
-                    matrixEntries.resize(this->isNondeterministic ? nondeterminismOdd.getTotalOffset() : odd.getTotalOffset());
+                    rowIndications.assign((this->isNondeterministic ? nondeterminismOdd.getTotalOffset() : odd.getTotalOffset()) + 1, 0);
                     if (isNondeterministic) {
-                        rowToState.resize(matrixEntries.size());
+                        rowToState.resize(rowIndications.size() - 1);
                     }
+                    countingMatrixEntries = true;
+                }
+                
+                void allocateMatrixEntries() {
+                    // Turn the counts into the positions of the first entries of the rows. While the entries are added,
+                    // these positions are advanced until they point to the first entries of the next rows.
+                    for (uint64_t row = 1; row < rowIndications.size(); ++row) {
+                        rowIndications[row] += rowIndications[row - 1];
+                    }
+                    matrixEntries.resize(rowIndications.back());
+                    countingMatrixEntries = false;
+                }
+                
+                void finalizeMatrixEntries() {
+                    // After all entries were added, every row indication points to the start of the next row, so we
+                    // shift them by one row to obtain the starts of the rows themselves.
+                    for (uint64_t row = rowIndications.size() - 1; row > 0; --row) {
+                        rowIndications[row] = rowIndications[row - 1];
+                    }
+                    rowIndications[0] = 0;
                 }
                 
                 void assignRowToState(uint64_t row, uint64_t state) {
@@ -386,11 +436,17 @@ namespace storm {
                 storm::dd::Odd odd;
                 storm::dd::Odd nondeterminismOdd;
                 
-                // A flag that stores whether the underlying storage for matrix entries has been created.
-                bool matrixEntriesCreated;
+                // The number of threads used to build the quotient matrix.
+                uint64_t numberOfThreads;
+                
+                // A flag that stores whether the matrix entries are only counted (as opposed to being added).
+                bool countingMatrixEntries;
                 
-                // The entries of the quotient matrix that is built.
-                std::vector<std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>>> matrixEntries;
+                // The entries of the quotient matrix that is built (stored row after row) and the indices at which the
+                // rows start. While the entries are counted or added, the indices are used to count the entries of or to
+                // store the position of the next entry in a row, respectively.
+                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>> matrixEntries;
+                std::vector<uint64_t> rowIndications;
                 
                 // A vector storing for each row which state it belongs to.
                 std::vector<uint64_t> rowToState;
@@ -408,8 +464,12 @@ namespace storm {
             
             private:
                 virtual storm::storage::SparseMatrix<ValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::CUDD, ValueType> const& matrix) override {
+                    // Traverse the matrix twice: first to count the entries of every row and then to add them. This way,
+                    // the entries can be stored in one contiguous array instead of growing a container per row.
                     this->createMatrixEntryStorage();
                     extractTransitionMatrixRec(matrix.getInternalAdd().getCuddDdNode(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getCuddDdNode(), this->representatives.getInternalBdd().getCuddDdNode(), this->allSourceVariablesCube.getInternalBdd().getCuddDdNode(), this->nondeterminismVariablesCube.getInternalBdd().getCuddDdNode(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                    this->allocateMatrixEntries();
+                    extractTransitionMatrixRec(matrix.getInternalAdd().getCuddDdNode(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getCuddDdNode(), this->representatives.getInternalBdd().getCuddDdNode(), this->allSourceVariablesCube.getInternalBdd().getCuddDdNode(), this->nondeterminismVariablesCube.getInternalBdd().getCuddDdNode(), this->isNondeterministic ? &this->odd : nullptr, 0);
                     return this->createMatrixFromEntries();
                 }
                 
@@ -515,7 +575,11 @@ namespace storm {
                     // If we have moved through all source variables, we must have arrived at a target block encoding.
                     if (Cudd_IsConstant(variables)) {
                         STORM_LOG_ASSERT(Cudd_IsConstant(transitionMatrixNode), "Expected constant node.");
-                        this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), Cudd_V(transitionMatrixNode));
+                        if (this->countingMatrixEntries) {
+                            this->countMatrixEntry(sourceOffset);
+                        } else {
+                            this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), Cudd_V(transitionMatrixNode));
+                        }
                         if (stateOdd) {
                             this->assignRowToState(sourceOffset, stateOffset);
                         }
@@ -607,10 +671,12 @@ namespace storm {
                                 representativesE = Cudd_Not(representativesE);
                             }
                             
-                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
-                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                            storm::dd::Odd stateElseOdd = stateOdd ? stateOdd->getElseSuccessor() : storm::dd::Odd();
+                            storm::dd::Odd stateThenOdd = stateOdd ? stateOdd->getThenSuccessor() : storm::dd::Odd();
+                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateElseOdd : stateOdd, stateOffset);
+                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateElseOdd : stateOdd, stateOffset);
+                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateThenOdd : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateThenOdd : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
                         }
                     }
                 }
@@ -630,8 +696,12 @@ namespace storm {
                 
             private:
                 virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
+                    // Traverse the matrix twice: first to count the entries of every row and then to add them. This way,
+                    // the entries can be stored in one contiguous array instead of growing a container per row.
                     this->createMatrixEntryStorage();
                     extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                    this->allocateMatrixEntries();
+                    extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
                     return this->createMatrixFromEntries();
                 }
                 
@@ -723,7 +793,11 @@ namespace storm {
                     // If we have moved through all source variables, we must have arrived at a target block encoding.
                     if (sylvan_isconst(variables)) {
                         STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
-                        this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(transitionMatrixNode)));
+                        if (this->countingMatrixEntries) {
+                            this->countMatrixEntry(sourceOffset);
+                        } else {
+                            this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(transitionMatrixNode)));
+                        }
                         if (stateOdd) {
                             this->assignRowToState(sourceOffset, stateOffset);
                         }
@@ -805,10 +879,12 @@ namespace storm {
                                 representativesT = representativesE = representativesNode;
                             }
                             
-                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
-                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                            storm::dd::Odd stateElseOdd = stateOdd ? stateOdd->getElseSuccessor() : storm::dd::Odd();
+                            storm::dd::Odd stateThenOdd = stateOdd ? stateOdd->getThenSuccessor() : storm::dd::Odd();
+                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateElseOdd : stateOdd, stateOffset);
+                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateElseOdd : stateOdd, stateOffset);
+                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateThenOdd : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateThenOdd : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
                         }
                     }
                 }
@@ -54,22 +54,22 @@ namespace storm {
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::models::symbolic::Model<DdType, ValueType> const& model, SignatureMode const& mode, bool ensureQualitative) : SignatureComputer(model.getTransitionMatrix(), boost::none, model.getColumnVariables(), mode, ensureQualitative) {
+            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::models::symbolic::Model<DdType, ValueType> const& model, SignatureMode const& mode, bool ensureQualitative, bool incremental) : SignatureComputer(model.getTransitionMatrix(), boost::none, model.getColumnVariables(), mode, ensureQualitative, incremental) {
                 // Intentionally left empty.
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative) : SignatureComputer(transitionMatrix, boost::none, columnVariables, mode, ensureQualitative) {
+            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative, bool incremental) : SignatureComputer(transitionMatrix, boost::none, columnVariables, mode, ensureQualitative, incremental) {
                 // Intentionally left empty.
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Bdd<DdType> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative) : SignatureComputer(qualitativeTransitionMatrix.template toAdd<ValueType>(), boost::none, columnVariables, mode, ensureQualitative) {
+            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Bdd<DdType> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative, bool incremental) : SignatureComputer(qualitativeTransitionMatrix.template toAdd<ValueType>(), boost::none, columnVariables, mode, ensureQualitative, incremental) {
                 // Intentionally left empty.
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, boost::optional<storm::dd::Bdd<DdType>> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative) : transitionMatrix(transitionMatrix), columnVariables(columnVariables), mode(mode), ensureQualitative(ensureQualitative) {
+            SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, boost::optional<storm::dd::Bdd<DdType>> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode, bool ensureQualitative, bool incremental) : transitionMatrix(transitionMatrix), columnVariables(columnVariables), mode(mode), ensureQualitative(ensureQualitative), incremental(incremental) {
                 if (DdType == storm::dd::DdType::Sylvan) {
                     this->transitionMatrix = this->transitionMatrix.notZero().ite(this->transitionMatrix, this->transitionMatrix.getDdManager().template getAddUndefined<ValueType>());
                 }
@@ -103,16 +103,50 @@ namespace storm {
                 if (partition.storedAsBdd()) {
                     if (partition.hasChangedStates()) {
                         return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
-                    } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
                     }
                 } else {
                     if (partition.hasChangedStates()) {
                         return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
-                    } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
                     }
                 }
+                
+                if (incremental && lastPartition && lastPartition.get().storedAsBdd() == partition.storedAsBdd()) {
+                    storm::dd::Add<DdType, ValueType> signature = this->getIncrementalFullSignature(partition);
+                    lastPartition = partition;
+                    lastSignature = signature;
+                    return Signature<DdType, ValueType>(signature);
+                }
+                
+                storm::dd::Add<DdType, ValueType> signature = partition.storedAsBdd() ? this->transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables) : this->transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables);
+                if (incremental) {
+                    lastPartition = partition;
+                    lastSignature = signature;
+                }
+                return Signature<DdType, ValueType>(signature);
+            }
+            
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> SignatureComputer<DdType, ValueType>::getIncrementalFullSignature(Partition<DdType, ValueType> const& partition) const {
+                // Determine the blocks whose states changed since the last full signature was computed. As block numbers
+                // are reused, these are the blocks that were split off as well as the blocks they were split off from.
+                storm::dd::Bdd<DdType> difference;
+                if (partition.storedAsBdd()) {
+                    difference = partition.asBdd().exclusiveOr(lastPartition.get().asBdd());
+                } else {
+                    difference = partition.asAdd().notEquals(lastPartition.get().asAdd());
+                }
+                if (difference.isZero()) {
+                    return lastSignature.get();
+                }
+                std::set<storm::expressions::Variable> stateVariables = difference.getContainedMetaVariables();
+                stateVariables.erase(partition.getBlockVariable());
+                storm::dd::Bdd<DdType> changedBlocks = difference.existsAbstract(stateVariables);
+                
+                // The signature of a state consists of the probabilities to move to each block. For the blocks that did
+                // not change, these are still the same, so we only multiply with the changed blocks and keep the parts
+                // of the last signature for all other blocks.
+                storm::dd::Add<DdType, ValueType> changedSignatures = partition.storedAsBdd() ? this->transitionMatrix.multiplyMatrix(partition.asBdd() && changedBlocks, columnVariables) : this->transitionMatrix.multiplyMatrix(partition.asAdd() * changedBlocks.template toAdd<ValueType>(), columnVariables);
+                return changedBlocks.ite(changedSignatures, lastSignature.get());
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
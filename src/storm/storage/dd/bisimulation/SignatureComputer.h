@@ -42,10 +42,11 @@ namespace storm {
             public:
                 friend class SignatureIterator<DdType, ValueType>;
                 
-                SignatureComputer(storm::models::symbolic::Model<DdType, ValueType> const& model, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false);
-                SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false);
-                SignatureComputer(storm::dd::Bdd<DdType> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false);
-                SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, boost::optional<storm::dd::Bdd<DdType>> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false);
+                /// If incremental is set, the full signatures are computed incrementally from the last full signature.
+                SignatureComputer(storm::models::symbolic::Model<DdType, ValueType> const& model, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false, bool incremental = false);
+                SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false, bool incremental = false);
+                SignatureComputer(storm::dd::Bdd<DdType> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false, bool incremental = false);
+                SignatureComputer(storm::dd::Add<DdType, ValueType> const& transitionMatrix, boost::optional<storm::dd::Bdd<DdType>> const& qualitativeTransitionMatrix, std::set<storm::expressions::Variable> const& columnVariables, SignatureMode const& mode = SignatureMode::Eager, bool ensureQualitative = false, bool incremental = false);
 
                 void setSignatureMode(SignatureMode const& newMode);
 
@@ -61,6 +62,11 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> const& getQualitativeTransitionMatrixAsAdd() const;
                 
                 SignatureMode const& getSignatureMode() const;
+                
+                /// Computes the full signature wrt. the given partition by updating the last full signature. The part of
+                /// the signature that belongs to a block (i.e. the probabilities to move to the block) is only recomputed
+                /// if the states of the block changed. The parts of all other blocks are taken from the last signature.
+                storm::dd::Add<DdType, ValueType> getIncrementalFullSignature(Partition<DdType, ValueType> const& partition) const;
                                 
                 /// The transition matrix to use for the signature computation.
                 storm::dd::Add<DdType, ValueType> transitionMatrix;
@@ -76,6 +82,14 @@ namespace storm {
                 
                 /// Only used when using lazy signatures is enabled.
                 mutable boost::optional<boost::variant<storm::dd::Bdd<DdType>, storm::dd::Add<DdType, ValueType>>> transitionMatrix01;
+                
+                /// A flag indicating whether full signatures are computed incrementally from the last full signature.
+                bool incremental;
+                
+                /// Only used when incremental signatures are enabled: the last full signature and the partition wrt. which
+                /// it was computed.
+                mutable boost::optional<Partition<DdType, ValueType>> lastPartition;
+                mutable boost::optional<storm::dd::Add<DdType, ValueType>> lastSignature;
             };
             
         }
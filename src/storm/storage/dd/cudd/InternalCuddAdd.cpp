@@ -242,6 +242,12 @@ namespace storm {
             return this->multiplyMatrix(otherMatrix.template toAdd<ValueType>(), summationDdVariables);
         }
         
+        template<typename ValueType>
+        InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::multiplyMatrixAndAbstract(InternalAdd<DdType::CUDD, ValueType> const& otherMatrix, std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables, InternalAdd<DdType::CUDD, ValueType> const& offset, InternalBdd<DdType::CUDD> const& abstractionCube, bool maximize) const {
+            InternalAdd<DdType::CUDD, ValueType> result = this->multiplyMatrix(otherMatrix, summationDdVariables) + offset;
+            return maximize ? result.maxAbstract(abstractionCube) : result.minAbstract(abstractionCube);
+        }
+        
         template<typename ValueType>
         InternalBdd<DdType::CUDD> InternalAdd<DdType::CUDD, ValueType>::greater(ValueType const& value) const {
             return InternalBdd<DdType::CUDD>(ddManager, this->getCuddAdd().BddStrictThreshold(value));
@@ -431,17 +437,17 @@ namespace storm {
         template<typename ValueType>
         Odd InternalAdd<DdType::CUDD, ValueType>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
             // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-            std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+            std::vector<std::unordered_map<DdNode*, Odd::node_index_type>> uniqueTableForLevels(ddVariableIndices.size() + 1);
             
             // Now construct the ODD structure from the ADD.
-            std::shared_ptr<Odd> rootOdd = createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
-
-            // Return a copy of the root node to remove the shared_ptr encapsulation.
-            return Odd(*rootOdd);
+            Odd::Builder builder;
+            Odd::node_index_type rootNode = createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
+            
+            return builder.build(rootNode);
         }
         
         template<typename ValueType>
-        std::shared_ptr<Odd> InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+        Odd::node_index_type InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode*, Odd::node_index_type>>& uniqueTableForLevels, Odd::Builder& builder) {
             // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
             auto const& iterator = uniqueTableForLevels[currentLevel].find(dd);
             if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -460,26 +466,26 @@ namespace storm {
                         thenOffset = 1;
                     }
                     
-                    auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+                    Odd::node_index_type oddNode = builder.addTerminalNode(elseOffset, thenOffset);
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
                     // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
                     // node for the then-successor as well.
-                    std::shared_ptr<Odd> elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = elseNode;
-                    auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode, thenNode->getElseOffset() + thenNode->getThenOffset());
+                    Odd::node_index_type elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = elseNode;
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, builder.getTotalOffset(elseNode), thenNode, builder.getTotalOffset(thenNode));
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else {
                     // Otherwise, we compute the ODDs for both the then- and else successors.
-                    std::shared_ptr<Odd> elseNode = createOddRec(Cudd_E(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = createOddRec(Cudd_T(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+                    Odd::node_index_type elseNode = createOddRec(Cudd_E(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = createOddRec(Cudd_T(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
 
-                    uint_fast64_t totalElseOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-                    uint_fast64_t totalThenOffset = thenNode->getElseOffset() + thenNode->getThenOffset();
+                    uint_fast64_t totalElseOffset = builder.getTotalOffset(elseNode);
+                    uint_fast64_t totalThenOffset = builder.getTotalOffset(thenNode);
 
-                    auto oddNode = std::make_shared<Odd>(elseNode, totalElseOffset, thenNode, totalThenOffset);
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, totalElseOffset, thenNode, totalThenOffset);
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 }
@@ -359,6 +359,20 @@ namespace storm {
              */
             InternalAdd<DdType::CUDD, ValueType> multiplyMatrix(InternalBdd<DdType::CUDD> const& otherMatrix, std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables) const;
 
+            /*!
+             * Multiplies the current ADD (representing a matrix) with the given matrix by summing over the given DD
+             * variables, adds the given offset and abstracts from the variables in the given cube by taking the
+             * minimum or maximum.
+             *
+             * @param otherMatrix The matrix with which to multiply.
+             * @param summationDdVariables The DD variables (represented as ADDs) over which to sum.
+             * @param offset The ADD that is added to the product.
+             * @param abstractionCube The cube of variables from which to abstract after adding the offset.
+             * @param maximize If set, the maximum is taken when abstracting and the minimum otherwise.
+             * @return The resulting ADD.
+             */
+            InternalAdd<DdType::CUDD, ValueType> multiplyMatrixAndAbstract(InternalAdd<DdType::CUDD, ValueType> const& otherMatrix, std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables, InternalAdd<DdType::CUDD, ValueType> const& offset, InternalBdd<DdType::CUDD> const& abstractionCube, bool maximize) const;
+
             /*!
              * Computes a BDD that represents the function in which all assignments with a function value strictly
              * larger than the given value are mapped to one and all others to zero.
@@ -725,9 +739,10 @@ namespace storm {
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
              * ODD nodes for the same DD and level unique.
-             * @return A pointer to the constructed ODD for the given arguments.
+             * @param builder The builder that collects the nodes of the ODD.
+             * @return The index of the constructed ODD node for the given arguments.
              */
-            static std::shared_ptr<Odd> createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>>& uniqueTableForLevels);
+            static Odd::node_index_type createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode*, Odd::node_index_type>>& uniqueTableForLevels, Odd::Builder& builder);
             
             InternalDdManager<DdType::CUDD> const* ddManager;
             
@@ -317,13 +317,13 @@ namespace storm {
         
         Odd InternalBdd<DdType::CUDD>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
             // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-            std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+            std::vector<std::unordered_map<DdNode const*, Odd::node_index_type>> uniqueTableForLevels(ddVariableIndices.size() + 1);
             
             // Now construct the ODD structure from the BDD.
-            std::shared_ptr<Odd> rootOdd = createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+            Odd::Builder builder;
+            Odd::node_index_type rootNode = createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
             
-            // Return a copy of the root node to remove the shared_ptr encapsulation.
-            return Odd(*rootOdd);
+            return builder.build(rootNode);
         }
         
         std::size_t InternalBdd<DdType::CUDD>::HashFunctor::operator()(std::pair<DdNode const*, bool> const& key) const {
@@ -333,7 +333,7 @@ namespace storm {
             return result;
         }
         
-        std::shared_ptr<Odd> InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+        Odd::node_index_type InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode const*, Odd::node_index_type>>& uniqueTableForLevels, Odd::Builder& builder) {
             // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
             auto it = uniqueTableForLevels[currentLevel].find(dd);
             if (it != uniqueTableForLevels[currentLevel].end()) {
@@ -344,16 +344,16 @@ namespace storm {
                 // If we are already at the maximal level that is to be considered, we can simply create an Odd without
                 // successors
                 if (currentLevel == maxLevel) {
-                    auto oddNode = std::make_shared<Odd>(nullptr, 0, nullptr, dd != Cudd_ReadLogicZero(manager.getManager()) ? 1 : 0);
+                    Odd::node_index_type oddNode = builder.addTerminalNode(0, dd != Cudd_ReadLogicZero(manager.getManager()) ? 1 : 0);
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
                     // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
                     // node for the then-successor as well.
-                    std::shared_ptr<Odd> elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = elseNode;
+                    Odd::node_index_type elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = elseNode;
                     
-                    auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getTotalOffset(), thenNode, elseNode->getTotalOffset());
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, builder.getTotalOffset(elseNode), thenNode, builder.getTotalOffset(elseNode));
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else {
@@ -366,10 +366,10 @@ namespace storm {
                         elseDdNode = Cudd_Not(elseDdNode);
                     }
                     
-                    std::shared_ptr<Odd> elseNode = createOddRec(elseDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = createOddRec(thenDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+                    Odd::node_index_type elseNode = createOddRec(elseDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = createOddRec(thenDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
                     
-                    auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getTotalOffset(), thenNode, thenNode->getTotalOffset());
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, builder.getTotalOffset(elseNode), thenNode, builder.getTotalOffset(thenNode));
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 }
@@ -12,6 +12,7 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalBdd.h"
 #include "storm/storage/dd/InternalAdd.h"
+#include "storm/storage/dd/Odd.h"
 
 // Include the C++-interface of CUDD.
 #include "cuddObj.hh"
@@ -28,8 +29,6 @@ namespace storm {
         template<DdType LibraryType, typename ValueType>
         class InternalAdd;
         
-        class Odd;
-        
         template<>
         class InternalBdd<DdType::CUDD> {
         public:
@@ -447,9 +446,10 @@ namespace storm {
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
              * ODD nodes for the same DD and level unique.
-             * @return A pointer to the constructed ODD for the given arguments.
+             * @param builder The builder that collects the nodes of the ODD.
+             * @return The index of the constructed ODD node for the given arguments.
              */
-            static std::shared_ptr<Odd> createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>>& uniqueTableForLevels);
+            static Odd::node_index_type createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode const*, Odd::node_index_type>>& uniqueTableForLevels, Odd::Builder& builder);
             
             /*!
              * Adds the selected values the target vector.
@@ -652,6 +652,32 @@ namespace storm {
             return InternalAdd<DdType::Sylvan, storm::RationalNumber>(ddManager, this->sylvanMtbdd.AndExistsRN(sylvan::Bdd(otherMatrix.getSylvanBdd().GetBDD()), summationVariables.getSylvanBdd()));
         }
 
+        template<typename ValueType>
+        InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::multiplyMatrixAndAbstract(InternalAdd<DdType::Sylvan, ValueType> const& otherMatrix, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables, InternalAdd<DdType::Sylvan, ValueType> const& offset, InternalBdd<DdType::Sylvan> const& abstractionCube, bool maximize) const {
+            InternalBdd<DdType::Sylvan> summationVariables = ddManager->getBddOne();
+            for (auto const& ddVariable : summationDdVariables) {
+                summationVariables &= ddVariable;
+            }
+            
+            return InternalAdd<DdType::Sylvan, ValueType>(ddManager, this->sylvanMtbdd.AndExistsPlusAbstractMinMax(otherMatrix.sylvanMtbdd, summationVariables.getSylvanBdd(), offset.sylvanMtbdd, abstractionCube.sylvanBdd, maximize));
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalAdd<DdType::Sylvan, storm::RationalFunction>::multiplyMatrixAndAbstract(InternalAdd<DdType::Sylvan, storm::RationalFunction> const& otherMatrix, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables, InternalAdd<DdType::Sylvan, storm::RationalFunction> const& offset, InternalBdd<DdType::Sylvan> const& abstractionCube, bool maximize) const {
+            // The fused operation is only available for the built-in leaf types, so we perform the steps separately.
+            InternalAdd<DdType::Sylvan, storm::RationalFunction> result = this->multiplyMatrix(otherMatrix, summationDdVariables) + offset;
+            return maximize ? result.maxAbstract(abstractionCube) : result.minAbstract(abstractionCube);
+        }
+#endif
+        
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, storm::RationalNumber>::multiplyMatrixAndAbstract(InternalAdd<DdType::Sylvan, storm::RationalNumber> const& otherMatrix, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables, InternalAdd<DdType::Sylvan, storm::RationalNumber> const& offset, InternalBdd<DdType::Sylvan> const& abstractionCube, bool maximize) const {
+            // The fused operation is only available for the built-in leaf types, so we perform the steps separately.
+            InternalAdd<DdType::Sylvan, storm::RationalNumber> result = this->multiplyMatrix(otherMatrix, summationDdVariables) + offset;
+            return maximize ? result.maxAbstract(abstractionCube) : result.minAbstract(abstractionCube);
+        }
+        
         template<typename ValueType>
         InternalBdd<DdType::Sylvan> InternalAdd<DdType::Sylvan, ValueType>::greater(ValueType const& value) const {
             return InternalBdd<DdType::Sylvan>(ddManager, this->sylvanMtbdd.BddStrictThreshold(value));
@@ -819,17 +845,17 @@ namespace storm {
         template<typename ValueType>
         Odd InternalAdd<DdType::Sylvan, ValueType>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
             // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-            std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+            std::vector<std::unordered_map<BDD, Odd::node_index_type>> uniqueTableForLevels(ddVariableIndices.size() + 1);
             
             // Now construct the ODD structure from the ADD.
-            std::shared_ptr<Odd> rootOdd = createOddRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+            Odd::Builder builder;
+            Odd::node_index_type rootNode = createOddRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
             
-            // Return a copy of the root node to remove the shared_ptr encapsulation.
-            return Odd(*rootOdd);
+            return builder.build(rootNode);
         }
         
         template<typename ValueType>
-        std::shared_ptr<Odd> InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+        Odd::node_index_type InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<BDD, Odd::node_index_type>>& uniqueTableForLevels, Odd::Builder& builder) {
             // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
             auto const& iterator = uniqueTableForLevels[currentLevel].find(dd);
             if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -850,26 +876,26 @@ namespace storm {
                         thenOffset = 1;
                     }
 
-                    auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+                    Odd::node_index_type oddNode = builder.addTerminalNode(elseOffset, thenOffset);
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
                     // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
                     // node for the then-successor as well.
-                    std::shared_ptr<Odd> elseNode = createOddRec(dd, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = elseNode;
-                    auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode, thenNode->getElseOffset() + thenNode->getThenOffset());
+                    Odd::node_index_type elseNode = createOddRec(dd, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = elseNode;
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, builder.getTotalOffset(elseNode), thenNode, builder.getTotalOffset(thenNode));
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 } else {
                     // Otherwise, we compute the ODDs for both the then- and else successors.
-                    std::shared_ptr<Odd> elseNode = createOddRec(mtbdd_regular(mtbdd_getlow(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = createOddRec(mtbdd_regular(mtbdd_gethigh(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+                    Odd::node_index_type elseNode = createOddRec(mtbdd_regular(mtbdd_getlow(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = createOddRec(mtbdd_regular(mtbdd_gethigh(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
                     
-                    uint_fast64_t totalElseOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-                    uint_fast64_t totalThenOffset = thenNode->getElseOffset() + thenNode->getThenOffset();
+                    uint_fast64_t totalElseOffset = builder.getTotalOffset(elseNode);
+                    uint_fast64_t totalThenOffset = builder.getTotalOffset(thenNode);
                     
-                    auto oddNode = std::make_shared<Odd>(elseNode, totalElseOffset, thenNode, totalThenOffset);
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, totalElseOffset, thenNode, totalThenOffset);
                     uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
                     return oddNode;
                 }
@@ -302,13 +302,13 @@ namespace storm {
         
         Odd InternalBdd<DdType::Sylvan>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
             // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-            std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+            std::vector<std::unordered_map<std::pair<BDD, bool>, Odd::node_index_type, HashFunctor>> uniqueTableForLevels(ddVariableIndices.size() + 1);
             
             // Now construct the ODD structure from the BDD.
-            std::shared_ptr<Odd> rootOdd = createOddRec(bdd_regular(this->getSylvanBdd().GetBDD()), bdd_isnegated(this->getSylvanBdd().GetBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+            Odd::Builder builder;
+            Odd::node_index_type rootNode = createOddRec(bdd_regular(this->getSylvanBdd().GetBDD()), bdd_isnegated(this->getSylvanBdd().GetBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
             
-            // Return a copy of the root node to remove the shared_ptr encapsulation.
-            return Odd(*rootOdd);
+            return builder.build(rootNode);
         }
         
         std::size_t InternalBdd<DdType::Sylvan>::HashFunctor::operator()(std::pair<BDD, bool> const& key) const {
@@ -318,7 +318,7 @@ namespace storm {
             return result;
         }
         
-        std::shared_ptr<Odd> InternalBdd<DdType::Sylvan>::createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>>& uniqueTableForLevels) {
+        Odd::node_index_type InternalBdd<DdType::Sylvan>::createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<std::pair<BDD, bool>, Odd::node_index_type, HashFunctor>>& uniqueTableForLevels, Odd::Builder& builder) {
             // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
             auto const& iterator = uniqueTableForLevels[currentLevel].find(std::make_pair(dd, complement));
             if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -342,16 +342,16 @@ namespace storm {
                         thenOffset = 1 - thenOffset;
                     }
                     
-                    auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+                    Odd::node_index_type oddNode = builder.addTerminalNode(elseOffset, thenOffset);
                     uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
                     return oddNode;
                 } else if (bdd_isterminal(dd) || ddVariableIndices[currentLevel] < sylvan_var(dd)) {
                     // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
                     // node for the then-successor as well.
-                    std::shared_ptr<Odd> elseNode = createOddRec(dd, complement, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = elseNode;
-                    uint_fast64_t totalOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-                    auto oddNode = std::make_shared<Odd>(elseNode, totalOffset, thenNode, totalOffset);
+                    Odd::node_index_type elseNode = createOddRec(dd, complement, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = elseNode;
+                    uint_fast64_t totalOffset = builder.getTotalOffset(elseNode);
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, totalOffset, thenNode, totalOffset);
                     uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
                     return oddNode;
                 } else {
@@ -363,10 +363,10 @@ namespace storm {
                     bool elseComplemented = bdd_isnegated(elseDdNode) ^ complement;
                     bool thenComplemented = bdd_isnegated(thenDdNode) ^ complement;
                     
-                    std::shared_ptr<Odd> elseNode = createOddRec(bdd_regular(elseDdNode), elseComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-                    std::shared_ptr<Odd> thenNode = createOddRec(bdd_regular(thenDdNode), thenComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+                    Odd::node_index_type elseNode = createOddRec(bdd_regular(elseDdNode), elseComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+                    Odd::node_index_type thenNode = createOddRec(bdd_regular(thenDdNode), thenComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
                     
-                    auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode, thenNode->getElseOffset() + thenNode->getThenOffset());
+                    Odd::node_index_type oddNode = builder.addNode(elseNode, builder.getTotalOffset(elseNode), thenNode, builder.getTotalOffset(thenNode));
                     uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
                     return oddNode;
                 }
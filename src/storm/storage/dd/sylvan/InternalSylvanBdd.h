@@ -12,6 +12,7 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalBdd.h"
 #include "storm/storage/dd/InternalAdd.h"
+#include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/sylvan.h"
 
@@ -24,8 +25,6 @@ namespace storm {
         template<DdType LibraryType>
         class InternalDdManager;
         
-        class Odd;
-        
         template<>
         class InternalBdd<DdType::Sylvan> {
         public:
@@ -420,9 +419,10 @@ namespace storm {
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
              * ODD nodes for the same DD and level unique.
-             * @return A pointer to the constructed ODD for the given arguments.
+             * @param builder The builder that collects the nodes of the ODD.
+             * @return The index of the constructed ODD node for the given arguments.
              */
-            static std::shared_ptr<Odd> createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>>& uniqueTableForLevels);
+            static Odd::node_index_type createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<std::pair<BDD, bool>, Odd::node_index_type, HashFunctor>>& uniqueTableForLevels, Odd::Builder& builder);
             
             /*!
              * Helper function to convert the DD into a bit vector.
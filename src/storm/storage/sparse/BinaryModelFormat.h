@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+            namespace binary {
+                
+                /*
+                 * The binary model format stores a sparse model as a sequence of arrays that can be used directly
+                 * from a memory-mapped file. All numbers are stored in the byte order of the machine that wrote the
+                 * file and every array starts at an offset that is a multiple of eight bytes.
+                 *
+                 * The file starts with a header (see below) that is followed by these sections:
+                 *  - the transition matrix
+                 *  - the state labels: for each label, its name and the bits of the labeled states
+                 *  - the choice labels (if any): for each label, its name and the bits of the labeled choices
+                 *  - the exit rates (for CTMCs and Markov automata)
+                 *  - the bits of the Markovian states (for Markov automata)
+                 *  - the reward models: for each reward model, its name, a word with the reward flags and the state
+                 *    reward vector, state-action reward vector and transition reward matrix (as far as present)
+                 *
+                 * A matrix is stored as the number of its entries, the row indications (one more than the number of
+                 * rows), the row group indices (one more than the number of states, only for nondeterministic models)
+                 * and the entries in the layout of storm::storage::MatrixEntry, i.e. the column index of each entry
+                 * directly followed by its value. A name is stored as its length
+                 * followed by its characters (padded to a multiple of eight bytes) and a set of bits is stored as
+                 * 64-bit words.
+                 */
+                
+                // The magic bytes at the beginning of each file.
+                static const char magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+                
+                // The version of the format. This needs to be increased whenever the layout changes.
+                static const uint64_t version = 1;
+                
+                // A value that allows to detect files written on a machine with different byte order.
+                static const uint64_t byteOrderMark = 0x0102030405060708ull;
+                
+                // The codes of the supported model types.
+                enum class ModelTypeCode : uint64_t { Dtmc = 0, Ctmc = 1, Mdp = 2, MarkovAutomaton = 3 };
+                
+                // The flags of the header.
+                static const uint64_t nondeterministicFlag = 1ull << 0;
+                static const uint64_t exitRatesFlag = 1ull << 1;
+                static const uint64_t markovianStatesFlag = 1ull << 2;
+                static const uint64_t choiceLabelingFlag = 1ull << 3;
+                
+                // The flags of a reward model.
+                static const uint64_t stateRewardsFlag = 1ull << 0;
+                static const uint64_t stateActionRewardsFlag = 1ull << 1;
+                static const uint64_t transitionRewardsFlag = 1ull << 2;
+                
+                struct Header {
+                    char magic[8];
+                    uint64_t version;
+                    uint64_t byteOrderMark;
+                    uint64_t valueSize;
+                    uint64_t modelType;
+                    uint64_t flags;
+                    uint64_t numberOfStates;
+                    uint64_t numberOfChoices;
+                    uint64_t numberOfStateLabels;
+                    uint64_t numberOfChoiceLabels;
+                    uint64_t numberOfRewardModels;
+                };
+            
+            }
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include "storm/storage/sparse/StateStorage.h"
 
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidStateException.h"
+
 namespace storm {
     namespace storage {
         namespace sparse {
@@ -9,8 +12,48 @@ namespace storm {
                 // Intentionally left empty.
             }
 
+            template <typename StateType>
+            void StateStorage<StateType>::spillStatesToDisk(std::string const& directory, uint64_t maximalNumberOfResidentStates) {
+                STORM_LOG_THROW(getNumberOfStates() == 0, storm::exceptions::InvalidStateException, "Writing states to disk must be enabled before adding states.");
+                spillingStateToId = std::make_unique<storm::storage::SpillingBitVectorHashMap<StateType>>(bitsPerState, maximalNumberOfResidentStates, directory);
+                
+                // Release the storage that is not going to be used.
+                stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, 1);
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::findOrAddState(storm::storage::BitVector const& state, StateType const& index) {
+                if (spillingStateToId) {
+                    return spillingStateToId->findOrAdd(state, index);
+                }
+                return stateToId.findOrAdd(state, index);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::forEachState(std::function<void (storm::storage::BitVector const&, StateType const&)> const& callback) const {
+                if (spillingStateToId) {
+                    spillingStateToId->forEach(callback);
+                } else {
+                    for (auto const& stateIndexPair : stateToId) {
+                        callback(stateIndexPair.first, stateIndexPair.second);
+                    }
+                }
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::remapStateIndices(std::function<StateType (StateType const&)> const& remapping) {
+                if (spillingStateToId) {
+                    spillingStateToId->remap(remapping);
+                } else {
+                    stateToId.remap(remapping);
+                }
+            }
+            
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
+                if (spillingStateToId) {
+                    return spillingStateToId->size();
+                }
                 return stateToId.size();
             }
             
@@ -2,8 +2,12 @@
 #define STORM_STORAGE_SPARSE_STATESTORAGE_H_
 
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SpillingBitVectorHashMap.h"
 
 namespace storm {
     namespace storage {
@@ -18,6 +22,10 @@ namespace storm {
                 // This member stores all the states and maps them to their unique indices.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
+                // If set, this member stores the states instead of stateToId and holds only a bounded number of them
+                // in memory, while the remaining ones are written to disk.
+                std::unique_ptr<storm::storage::SpillingBitVectorHashMap<StateType>> spillingStateToId;
+                
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
                 
@@ -27,6 +35,19 @@ namespace storm {
                 // The number of bits of each state.
                 uint64_t bitsPerState;
                 
+                // Lets the storage hold at most the given number of states in memory and write the remaining ones to
+                // files in the given directory. This must be requested before the first state is added.
+                void spillStatesToDisk(std::string const& directory, uint64_t maximalNumberOfResidentStates);
+                
+                // Retrieves the index of the given state or adds the state with the given index if it is not stored yet.
+                StateType findOrAddState(storm::storage::BitVector const& state, StateType const& index);
+                
+                // Calls the given function for all stored states and their indices (in no particular order).
+                void forEachState(std::function<void (storm::storage::BitVector const&, StateType const&)> const& callback) const;
+                
+                // Replaces the indices of all stored states according to the given remapping.
+                void remapStateIndices(std::function<StateType (StateType const&)> const& remapping);
+                
                 // Get the number of states that were found in the exploration so far.
                 uint_fast64_t getNumberOfStates() const;
             };
@@ -0,0 +1,230 @@
+#include "storm/utility/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <cstring>
+#include <type_traits>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/sparse/BinaryModelFormat.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+
+
+namespace storm {
+    namespace exporter {
+        
+        namespace {
+            /*!
+             * Writes the sections of the binary model format and takes care of the alignment.
+             */
+            class BinaryWriter {
+            public:
+                BinaryWriter(std::ostream& os) : os(os), bufferedWords(0) {
+                    // Intentionally left empty.
+                }
+                
+                void writeBytes(void const* data, uint64_t numberOfBytes) {
+                    flush();
+                    os.write(static_cast<char const*>(data), numberOfBytes);
+                    uint64_t padding = (8 - numberOfBytes % 8) % 8;
+                    if (padding > 0) {
+                        char const zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+                        os.write(zeros, padding);
+                    }
+                    STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Error while writing binary model.");
+                }
+                
+                void writeWord(uint64_t word) {
+                    writeBytes(&word, sizeof(uint64_t));
+                }
+                
+                /*!
+                 * Appends the given 64-bit value to the current section. The values are collected in a small buffer,
+                 * so arrays can be written element by element without building a copy of the whole array first.
+                 * As the values are 64 bits wide, no padding is needed.
+                 */
+                template<typename T>
+                void appendWord(T const& value) {
+                    static_assert(sizeof(T) == 8, "Only 64-bit values can be written.");
+                    if (bufferedWords == buffer.size()) {
+                        flush();
+                    }
+                    std::memcpy(&buffer[bufferedWords], &value, sizeof(T));
+                    ++bufferedWords;
+                }
+                
+                /*!
+                 * Writes the words that were appended but not yet written.
+                 */
+                void flush() {
+                    if (bufferedWords > 0) {
+                        os.write(reinterpret_cast<char const*>(buffer.data()), bufferedWords * sizeof(uint64_t));
+                        bufferedWords = 0;
+                        STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Error while writing binary model.");
+                    }
+                }
+                
+                template<typename T>
+                void writeVector(std::vector<T> const& vector) {
+                    static_assert(sizeof(T) == 8, "Only 64-bit values can be written.");
+                    writeBytes(vector.data(), vector.size() * sizeof(T));
+                }
+                
+                void writeName(std::string const& name) {
+                    writeWord(name.size());
+                    writeBytes(name.data(), name.size());
+                }
+                
+                void writeBits(storm::storage::BitVector const& bits) {
+                    for (uint64_t word = 0; word * 64 < bits.size(); ++word) {
+                        appendWord(bits.getAsInt(word * 64, std::min<uint64_t>(64, bits.size() - word * 64)));
+                    }
+                    flush();
+                }
+                
+                template<typename ValueType>
+                void writeMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool writeRowGroups) {
+                    writeWord(matrix.getEntryCount());
+                    
+                    // The sections are streamed from the matrix to avoid copying its arrays.
+                    appendWord<uint64_t>(0);
+                    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                        appendWord<uint64_t>(std::distance(matrix.begin(), matrix.end(row)));
+                    }
+                    if (writeRowGroups) {
+                        for (auto const& rowGroupIndex : matrix.getRowGroupIndices()) {
+                            appendWord<uint64_t>(rowGroupIndex);
+                        }
+                    }
+                    flush();
+                    
+                    // The entries are written in the layout of the matrix, so they can be read back in one go.
+                    typedef storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> EntryType;
+                    static_assert(sizeof(EntryType) == sizeof(uint64_t) + sizeof(ValueType), "Unexpected layout of matrix entries.");
+                    uint64_t numberOfEntries = std::distance(matrix.begin(), matrix.end());
+                    if (numberOfEntries > 0) {
+                        writeBytes(&*matrix.begin(), numberOfEntries * sizeof(EntryType));
+                    }
+                }
+            
+            private:
+                std::ostream& os;
+                
+                // The words that were appended but not yet written.
+                std::array<uint64_t, 4096> buffer;
+                uint64_t bufferedWords;
+            };
+        }
+        
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+            static_assert(std::is_same<ValueType, double>::value, "The binary model format only supports double values.");
+            namespace binary = storm::storage::sparse::binary;
+            
+            binary::Header header;
+            std::memcpy(header.magic, binary::magic, sizeof(header.magic));
+            header.version = binary::version;
+            header.byteOrderMark = binary::byteOrderMark;
+            header.valueSize = sizeof(ValueType);
+            header.flags = 0;
+            header.numberOfStates = sparseModel->getNumberOfStates();
+            header.numberOfChoices = sparseModel->getNumberOfChoices();
+            header.numberOfStateLabels = sparseModel->getStateLabeling().getLabels().size();
+            header.numberOfChoiceLabels = sparseModel->hasChoiceLabeling() ? sparseModel->getChoiceLabeling().getLabels().size() : 0;
+            header.numberOfRewardModels = sparseModel->getRewardModels().size();
+            
+            // Notice that for CTMCs we write the rate matrix instead of probabilities.
+            std::vector<ValueType> exitRates;
+            boost::optional<storm::storage::BitVector> markovianStates;
+            switch (sparseModel->getType()) {
+                case storm::models::ModelType::Dtmc:
+                    header.modelType = static_cast<uint64_t>(binary::ModelTypeCode::Dtmc);
+                    break;
+                case storm::models::ModelType::Ctmc:
+                    header.modelType = static_cast<uint64_t>(binary::ModelTypeCode::Ctmc);
+                    header.flags |= binary::exitRatesFlag;
+                    exitRates = sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
+                    break;
+                case storm::models::ModelType::Mdp:
+                    header.modelType = static_cast<uint64_t>(binary::ModelTypeCode::Mdp);
+                    header.flags |= binary::nondeterministicFlag;
+                    break;
+                case storm::models::ModelType::MarkovAutomaton:
+                    header.modelType = static_cast<uint64_t>(binary::ModelTypeCode::MarkovAutomaton);
+                    header.flags |= binary::nondeterministicFlag | binary::exitRatesFlag | binary::markovianStatesFlag;
+                    exitRates = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
+                    markovianStates = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getMarkovianStates();
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models of type " << sparseModel->getType() << " can not be exported in the binary format.");
+            }
+            if (sparseModel->hasChoiceLabeling()) {
+                header.flags |= binary::choiceLabelingFlag;
+            }
+            STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "The state valuations are not exported in the binary format.");
+            STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "The choice origins are not exported in the binary format.");
+            
+            BinaryWriter writer(os);
+            writer.writeBytes(&header, sizeof(header));
+            
+            bool nondeterministic = (header.flags & binary::nondeterministicFlag) != 0;
+            writer.writeMatrix(sparseModel->getTransitionMatrix(), nondeterministic);
+            
+            for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+                writer.writeName(label);
+                writer.writeBits(sparseModel->getStateLabeling().getStates(label));
+            }
+            if (sparseModel->hasChoiceLabeling()) {
+                for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+                    writer.writeName(label);
+                    writer.writeBits(sparseModel->getChoiceLabeling().getChoices(label));
+                }
+            }
+            if (header.flags & binary::exitRatesFlag) {
+                writer.writeVector(exitRates);
+            }
+            if (markovianStates) {
+                writer.writeBits(markovianStates.get());
+            }
+            
+            // Write the reward models in a fixed order.
+            std::vector<std::string> rewardModelNames;
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                rewardModelNames.push_back(rewardModel.first);
+            }
+            std::sort(rewardModelNames.begin(), rewardModelNames.end());
+            for (auto const& rewardModelName : rewardModelNames) {
+                auto const& rewardModel = sparseModel->getRewardModel(rewardModelName);
+                writer.writeName(rewardModelName);
+                uint64_t rewardFlags = 0;
+                if (rewardModel.hasStateRewards()) {
+                    rewardFlags |= binary::stateRewardsFlag;
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    rewardFlags |= binary::stateActionRewardsFlag;
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    rewardFlags |= binary::transitionRewardsFlag;
+                }
+                writer.writeWord(rewardFlags);
+                if (rewardModel.hasStateRewards()) {
+                    writer.writeVector(rewardModel.getStateRewardVector());
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    writer.writeVector(rewardModel.getStateActionRewardVector());
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    writer.writeMatrix(rewardModel.getTransitionRewardMatrix(), nondeterministic);
+                }
+            }
+        }
+        
+        template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+        
+        /*!
+         * Exports a sparse model into the binary model format that can be memory-mapped when loading the model again
+         * (see storm/storage/sparse/BinaryModelFormat.h). State valuations and choice origins are not exported.
+         *
+         * @param os           Stream to export to. The stream must be opened in binary mode.
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+    
+    }
+}
@@ -0,0 +1,153 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <algorithm>
+
+namespace storm {
+    namespace utility {
+        
+        namespace {
+            // The index of the current thread within the pool it belongs to.
+            thread_local uint64_t currentThreadIndex = 0;
+            
+            // A flag indicating whether the current thread is currently executing tasks of some pool.
+            thread_local bool executingTasks = false;
+            
+            uint64_t resolveNumberOfThreads(uint64_t numberOfThreads) {
+                if (numberOfThreads == 0) {
+                    return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+                }
+                return numberOfThreads;
+            }
+        }
+        
+        ThreadPool::ThreadPool(uint64_t numberOfThreads) : generation(0), shutdown(false), activeWorkers(0), participatingWorkers(0), currentTask(nullptr), numberOfTasks(0), nextTask(0) {
+            numberOfThreads = resolveNumberOfThreads(numberOfThreads);
+            workers.reserve(numberOfThreads - 1);
+            for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                workers.emplace_back(&ThreadPool::work, this, threadIndex);
+            }
+        }
+        
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                shutdown = true;
+            }
+            workAvailable.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+        
+        uint64_t ThreadPool::getNumberOfThreads() const {
+            return workers.size() + 1;
+        }
+        
+        void ThreadPool::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task, uint64_t maximalNumberOfThreads) {
+            // There is no point in waking more workers than there are tasks left for them.
+            uint64_t numberOfWorkers = std::min<uint64_t>(workers.size(), numberOfTasks == 0 ? 0 : numberOfTasks - 1);
+            if (maximalNumberOfThreads > 0) {
+                numberOfWorkers = std::min<uint64_t>(numberOfWorkers, maximalNumberOfThreads - 1);
+            }
+            
+            std::unique_lock<std::mutex> executionLock(executionMutex, std::defer_lock);
+            if (executingTasks || numberOfWorkers == 0 || !executionLock.try_lock()) {
+                for (uint64_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex) {
+                    task(taskIndex);
+                }
+                return;
+            }
+            
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                this->currentTask = &task;
+                this->numberOfTasks = numberOfTasks;
+                this->nextTask = 0;
+                this->exception = nullptr;
+                this->activeWorkers = numberOfWorkers;
+                this->participatingWorkers = numberOfWorkers;
+                ++this->generation;
+            }
+            workAvailable.notify_all();
+            
+            processTasks();
+            
+            std::exception_ptr taskException;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                workDone.wait(lock, [this] { return activeWorkers == 0; });
+                this->currentTask = nullptr;
+                std::swap(taskException, this->exception);
+            }
+            if (taskException) {
+                std::rethrow_exception(taskException);
+            }
+        }
+        
+        uint64_t ThreadPool::getCurrentThreadIndex() {
+            return currentThreadIndex;
+        }
+        
+        void ThreadPool::work(uint64_t threadIndex) {
+            currentThreadIndex = threadIndex;
+            uint64_t processedGeneration = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workAvailable.wait(lock, [this, processedGeneration] { return shutdown || generation != processedGeneration; });
+                    if (shutdown) {
+                        return;
+                    }
+                    processedGeneration = generation;
+                    
+                    // Workers that do not take part in the current batch wait for the next one.
+                    if (threadIndex > participatingWorkers) {
+                        continue;
+                    }
+                }
+                
+                processTasks();
+                
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --activeWorkers;
+                    if (activeWorkers == 0) {
+                        workDone.notify_one();
+                    }
+                }
+            }
+        }
+        
+        void ThreadPool::processTasks() {
+            executingTasks = true;
+            while (true) {
+                uint64_t taskIndex = nextTask.fetch_add(1);
+                if (taskIndex >= numberOfTasks) {
+                    break;
+                }
+                try {
+                    (*currentTask)(taskIndex);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    // Skip the remaining tasks.
+                    nextTask = numberOfTasks;
+                }
+            }
+            executingTasks = false;
+        }
+        
+        ThreadPool& getThreadPool() {
+            // The pool is created once (in a thread-safe way) and lives until the end of the program.
+            static ThreadPool pool(0);
+            return pool;
+        }
+        
+        uint64_t getNumberOfThreads(uint64_t numberOfThreads) {
+            return std::min<uint64_t>(resolveNumberOfThreads(numberOfThreads), getThreadPool().getNumberOfThreads());
+        }
+    
+    }
+}
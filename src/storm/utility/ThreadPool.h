@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        
+        /*!
+         * A simple pool of worker threads that executes a number of independent tasks. The calling thread takes part
+         * in the execution, so a pool with n threads spawns n - 1 workers.
+         */
+        class ThreadPool {
+        public:
+            /*!
+             * Creates a pool with the given number of threads (including the calling thread). A value of zero means
+             * that the number of hardware threads is used.
+             */
+            explicit ThreadPool(uint64_t numberOfThreads);
+            ~ThreadPool();
+            
+            ThreadPool(ThreadPool const& other) = delete;
+            ThreadPool& operator=(ThreadPool const& other) = delete;
+            
+            /*!
+             * Retrieves the number of threads of this pool (including the calling thread).
+             */
+            uint64_t getNumberOfThreads() const;
+            
+            /*!
+             * Executes task(i) for all i in [0, numberOfTasks) and returns once all tasks have been completed. Tasks
+             * are handed out dynamically, so they do not need to be of equal size. If the pool is already executing
+             * tasks (for example because this is called from within a task), the tasks are executed sequentially by
+             * the calling thread. If a task throws, the remaining tasks are skipped and the first exception is
+             * rethrown by this method.
+             *
+             * @param numberOfTasks The number of tasks.
+             * @param task The function that executes a task with the given index.
+             * @param maximalNumberOfThreads The maximal number of threads (including the calling thread) that take
+             * part in the execution. A value of zero means that all threads of the pool take part.
+             */
+            void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task, uint64_t maximalNumberOfThreads = 0);
+            
+            /*!
+             * Retrieves the index of the calling thread within the pool that is currently executing tasks. The
+             * calling thread of execute has index 0, the workers have the indices 1 to n - 1, where n is the number of
+             * threads that take part in the execution. Threads that do not belong to a pool have index 0.
+             */
+            static uint64_t getCurrentThreadIndex();
+        
+        private:
+            void work(uint64_t threadIndex);
+            void processTasks();
+            
+            // The workers of the pool.
+            std::vector<std::thread> workers;
+            
+            // Used to ensure that only one batch of tasks is processed at a time.
+            std::mutex executionMutex;
+            
+            // Protects the fields below and is used in combination with the condition variables.
+            std::mutex mutex;
+            std::condition_variable workAvailable;
+            std::condition_variable workDone;
+            
+            // Incremented whenever a new batch of tasks is available.
+            uint64_t generation;
+            bool shutdown;
+            uint64_t activeWorkers;
+            
+            // The number of workers that take part in processing the current batch of tasks.
+            uint64_t participatingWorkers;
+            
+            // The current batch of tasks.
+            std::function<void(uint64_t)> const* currentTask;
+            uint64_t numberOfTasks;
+            std::atomic<uint64_t> nextTask;
+            std::exception_ptr exception;
+        };
+        
+        /*!
+         * Retrieves the pool that is shared by all callers. It is created on first use with one thread per hardware
+         * thread and is never resized, so references to it stay valid. Callers that want to use fewer threads limit
+         * the parallelism of their executions via the number of tasks or the thread limit of ThreadPool::execute.
+         */
+        ThreadPool& getThreadPool();
+        
+        /*!
+         * Retrieves the number of threads that the shared pool actually uses if the given number of threads is
+         * requested, i.e. the given number (where zero means the number of hardware threads) limited to the size of
+         * the shared pool.
+         */
+        uint64_t getNumberOfThreads(uint64_t numberOfThreads);
+        
+        /*!
+         * Splits the range [0, numberOfItems) into (at most) the given number of consecutive chunks that carry
+         * roughly the same weight.
+         *
+         * @param numberOfItems The number of items.
+         * @param numberOfChunks The desired number of chunks.
+         * @param weightPrefixSum A function that maps i to the accumulated weight of the items in [0, i). It must be
+         * monotonically increasing.
+         * @return The boundaries of the chunks, i.e. chunk j is [result[j], result[j + 1]).
+         */
+        template<typename WeightPrefixSumFunction>
+        std::vector<uint64_t> partitionByWeight(uint64_t numberOfItems, uint64_t numberOfChunks, WeightPrefixSumFunction const& weightPrefixSum) {
+            std::vector<uint64_t> result;
+            result.push_back(0);
+            if (numberOfChunks == 0 || numberOfItems == 0) {
+                result.push_back(numberOfItems);
+                return result;
+            }
+            uint64_t totalWeight = weightPrefixSum(numberOfItems);
+            for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+                uint64_t targetWeight = totalWeight / numberOfChunks * chunk + totalWeight % numberOfChunks * chunk / numberOfChunks;
+                
+                // Search for the first item boundary whose accumulated weight reaches the target weight.
+                uint64_t low = result.back();
+                uint64_t high = numberOfItems;
+                while (low < high) {
+                    uint64_t middle = low + (high - low) / 2;
+                    if (weightPrefixSum(middle) < targetWeight) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                if (low > result.back() && low < numberOfItems) {
+                    result.push_back(low);
+                }
+            }
+            result.push_back(numberOfItems);
+            return result;
+        }
+    
+    }
+}
@@ -3,6 +3,7 @@
 
 #include <set>
 #include <limits>
+#include <functional>
 
 #include "storm/utility/OsDetection.h"
 
@@ -15,6 +16,8 @@
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
+    class Environment;
+    
     namespace storage {
         class BitVector;
         template<typename VT> class SparseMatrix;
@@ -100,6 +103,35 @@ namespace storm {
             template<typename T>
             std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, boost::optional<storm::storage::BitVector> const& subsystem = boost::none);
             
+            /*!
+             * Retrieves the number of threads that the qualitative analyses of sparse models with the given value type
+             * use in the given environment. As the value types other than double are not thread-safe, the analyses of
+             * such models are always sequential.
+             *
+             * @return The number of threads (one means sequential, zero means the number of hardware threads).
+             */
+            template<typename T>
+            uint64_t getNumberOfGraphAnalysisThreads(Environment const& env);
+            
+            /*!
+             * Performs a breadth-first search through the given graph structure. The search proceeds level by level
+             * and the states of each level are expanded by the given number of threads. A state that is not yet
+             * reached is added to the next level if it is a candidate. As the set of reached states only changes in
+             * between levels, the candidate check may safely inspect it.
+             *
+             * @param graph The graph to search. The successors of a state are the entries of its row group.
+             * @param reachedStates The states that are already reached. As a side effect, all states that the search
+             * reaches are added.
+             * @param initialStates The states from which to start the search. They need to be contained in the reached
+             * states.
+             * @param isCandidate A function that decides whether a state that is not yet reached is to be added. It is
+             * called concurrently and must therefore not modify any shared data.
+             * @param numberOfThreads The number of threads to use (zero means the number of hardware threads).
+             * @param ignoreZeroEntries If set, entries whose value is zero are not treated as edges.
+             */
+            template<typename T>
+            void performParallelSearch(storm::storage::SparseMatrix<T> const& graph, storm::storage::BitVector& reachedStates, std::vector<uint_fast64_t> const& initialStates, std::function<bool (uint_fast64_t)> const& isCandidate, uint64_t numberOfThreads, bool ignoreZeroEntries = false);
+            
             /*!
              * Performs a backward depth-first search trough the underlying graph structure
              * of the given model to determine which states of the model have a positive probability
@@ -110,10 +142,11 @@ namespace storm {
              * @param psiStates A bit vector of all states satisfying psi.
              * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
              * @param maximalSteps The maximal number of steps to reach the psi states.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector with all indices of states that have a probability greater than 0.
              */
             template <typename T>
-            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the set of states of the given model for which all paths lead to
@@ -127,10 +160,11 @@ namespace storm {
              * @param psiStates A bit vector of all states satisfying psi.
              * @param statesWithProbabilityGreater0 A reference to a bit vector of states that possess a positive
              * probability mass of satisfying phi until psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector with all indices of states that have a probability greater than 1.
              */
             template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the set of states of the given model for which all paths lead to
@@ -142,10 +176,11 @@ namespace storm {
              * @param backwardTransitions The reversed transition relation of the graph structure to search.
              * @param phiStates A bit vector of all states satisfying phi.
              * @param psiStates A bit vector of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector with all indices of states that have a probability greater than 1.
              */
             template <typename T>
-            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
@@ -154,11 +189,12 @@ namespace storm {
              * @param model The model whose graph structure to search.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A pair of bit vectors such that the first bit vector stores the indices of all states
              * with probability 0 and the second stores all indices of states with probability 1.
              */
             template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
@@ -167,11 +203,12 @@ namespace storm {
              * @param backwardTransitions The backward transitions of the model whose graph structure to search.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A pair of bit vectors such that the first bit vector stores the indices of all states
              * with probability 0 and the second stores all indices of states with probability 1.
              */
             template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the set of states that has a positive probability of reaching psi states after only passing
@@ -313,13 +350,14 @@ namespace storm {
              * @param psiStates The set of all states satisfying psi.
              * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
              * @param maximalSteps The maximal number of steps to reach the psi states.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 0.
              */
             template <typename T>
-            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
+            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1) ;
             
             template <typename T>
-            storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -332,10 +370,11 @@ namespace storm {
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
              * @param choiceConstraint If given, only the selected choices are considered.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 1.
              */
             template <typename T>
-            storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+            storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -347,13 +386,14 @@ namespace storm {
              * @param backwardTransitions The reversed transition relation of the model.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 1.
              */
             template <typename T, typename RM>
-            storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1) ;
 
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -363,10 +403,11 @@ namespace storm {
              * @param model The model whose graph structure to search.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A pair of bit vectors that represent all states with probability 0 and 1, respectively.
              */
             template <typename T, typename RM>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1) ;
             
             /*!
              * Computes the sets of states that have probability greater 0 of satisfying phi until psi under any
@@ -380,10 +421,11 @@ namespace storm {
              * @param psiStates The set of all states satisfying psi.
              * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
              * @param maximalSteps The maximal number of steps to reach the psi states.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 0.
              */
             template <typename T>
-            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the sets of states that have probability 0 of satisfying phi until psi under at least
@@ -395,12 +437,13 @@ namespace storm {
              * @param backwardTransitions The reversed transition relation of the model.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 0.
              */
             template <typename T, typename RM>
-            storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             template <typename T>
-            storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,  storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1) ;
             
             /*!
              * Computes the sets of states that have probability 1 of satisfying phi until psi under all
@@ -412,16 +455,17 @@ namespace storm {
              * @param backwardTransitions The reversed transition relation of the model.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A bit vector that represents all states with probability 0.
              */
             template <typename T, typename RM>
-            storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
             template <typename T>
-            storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             template <typename T>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) ;
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1) ;
 
             /*!
              * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -431,10 +475,11 @@ namespace storm {
              * @param model The model whose graph structure to search.
              * @param phiStates The set of all states satisfying phi.
              * @param psiStates The set of all states satisfying psi.
+             * @param numberOfThreads The number of threads to use (one means sequential, zero means the number of hardware threads).
              * @return A pair of bit vectors that represent all states with probability 0 and 1, respectively.
              */
             template <typename T, typename RM>
-            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
             
             /*!
              * Computes the set of states for which there exists a scheduler that achieves a probability greater than
@@ -12,6 +12,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
@@ -695,3 +696,37 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+TEST(DdJaniModelBuilderTest_Sylvan, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/variable_order.nm");
+    storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    
+    // The variables that are changed together are placed next to each other. As every edge reads the location
+    // variable, its position is not fixed, so we only check the order of the other variables.
+    std::vector<std::string> variableNames;
+    for (auto const& variable : storm::builder::DdVariableOrdering::computeOrder(janiModel)) {
+        if (variable != janiModel.getAutomaton(0).getLocationExpressionVariable()) {
+            variableNames.push_back(variable.getName());
+        }
+    }
+    EXPECT_EQ(std::vector<std::string>({"a1", "b1", "a2", "b2", "a3", "b3"}), variableNames);
+    
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declaredModel = builder.build(janiModel, options);
+    
+    options.computeVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> orderedModel = builder.build(janiModel, options);
+    
+    options.computeVariableOrder = false;
+    options.siftVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> siftedModel = builder.build(janiModel, options);
+    
+    for (auto const& model : {declaredModel, orderedModel, siftedModel}) {
+        EXPECT_EQ(8ul, model->getNumberOfStates());
+        EXPECT_EQ(48ul, model->getNumberOfTransitions());
+        EXPECT_EQ(24ul, model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+    }
+    EXPECT_LT(orderedModel->getTransitionMatrix().getNodeCount(), declaredModel->getTransitionMatrix().getNodeCount());
+    EXPECT_LT(siftedModel->getTransitionMatrix().getNodeCount(), declaredModel->getTransitionMatrix().getNodeCount());
+}
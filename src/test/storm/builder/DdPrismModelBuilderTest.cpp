@@ -10,6 +10,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -319,3 +320,48 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+TEST(DdPrismModelBuilderTest_Sylvan, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/variable_order.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    // The variables that are changed together are placed next to each other.
+    std::vector<std::string> variableNames;
+    for (auto const& variable : storm::builder::DdVariableOrdering::computeOrder(program)) {
+        variableNames.push_back(variable.getName());
+    }
+    EXPECT_EQ(std::vector<std::string>({"a1", "b1", "a2", "b2", "a3", "b3"}), variableNames);
+    
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declaredModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    
+    options.computeVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> orderedModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    
+    // Sifting has to find a better order on its own, starting from the declaration order.
+    options.computeVariableOrder = false;
+    options.siftVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> siftedModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    
+    for (auto const& model : {declaredModel, orderedModel, siftedModel}) {
+        EXPECT_EQ(8ul, model->getNumberOfStates());
+        EXPECT_EQ(48ul, model->getNumberOfTransitions());
+        EXPECT_EQ(24ul, model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+    }
+    EXPECT_LT(orderedModel->getTransitionMatrix().getNodeCount(), declaredModel->getTransitionMatrix().getNodeCount());
+    EXPECT_LT(siftedModel->getTransitionMatrix().getNodeCount(), declaredModel->getTransitionMatrix().getNodeCount());
+    
+    // Ordering and sifting do not change the model.
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    program = modelDescription.preprocess().asPrismProgram();
+    options.computeVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+    EXPECT_EQ(436ul, model->getNumberOfTransitions());
+    EXPECT_EQ(254ul, model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/settings/SettingMemento.h"
@@ -42,6 +43,25 @@ TEST(ExplicitJaniModelBuilderTest, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitJaniModelBuilderTest, ExactDtmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/exact_guards.pm");
+    storm::jani::Model janiModel = program.toJani();
+    
+    // The guards and probabilities need to be evaluated exactly, so x=4 is reachable.
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model = storm::builder::ExplicitModelBuilder<storm::RationalNumber>(janiModel).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(8ul, model->getNumberOfTransitions());
+    storm::RationalNumber oneThird = storm::utility::convertNumber<storm::RationalNumber>(1.0); oneThird /= storm::utility::convertNumber<storm::RationalNumber>(3.0);
+    for (auto const& entry : model->getTransitionMatrix().getRow(0)) {
+        EXPECT_EQ(entry.getColumn() == 0 ? oneThird + oneThird : oneThird, entry.getValue());
+    }
+    
+    // In floating point arithmetic, the guard x*0.1=0.3 does not hold.
+    std::shared_ptr<storm::models::sparse::Model<double>> doubleModel = storm::builder::ExplicitModelBuilder<double>(janiModel).build();
+    EXPECT_EQ(4ul, doubleModel->getNumberOfStates());
+    EXPECT_EQ(7ul, doubleModel->getNumberOfTransitions());
+}
+
 TEST(ExplicitJaniModelBuilderTest, Ctmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
     storm::jani::Model janiModel = program.toJani();
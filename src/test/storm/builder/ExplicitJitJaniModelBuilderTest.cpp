@@ -8,6 +8,9 @@
 #include "storm/storage/jani/Model.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/JitBuilderSettings.h"
+
+#include <boost/filesystem.hpp>
 
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -158,3 +161,37 @@ TEST(ExplicitJitJaniModelBuilderTest, IllegalSynchronizingWrites) {
     ASSERT_THROW(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel, options).build(), storm::exceptions::WrongFormatException);
 }
 
+TEST(ExplicitJitJaniModelBuilderTest, Cache) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model janiModel = program.toJani();
+    
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-jit-cache-%%%%-%%%%-%%%%-%%%%");
+    storm::settings::mutableManager().setFromString("--jitbuilder:cache " + cacheDirectory.string());
+    {
+        storm::settings::SettingMemento cacheMemento(storm::settings::mutableManager().getModule(storm::settings::modules::JitBuilderSettings::moduleName), "cache", false);
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel).build();
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+        EXPECT_EQ(20ul, model->getNumberOfTransitions());
+        
+        // The cache holds the shared library and its key.
+        std::vector<boost::filesystem::path> libraries;
+        for (auto const& entry : boost::filesystem::directory_iterator(cacheDirectory)) {
+            if (entry.path().extension() != ".key") {
+                libraries.push_back(entry.path());
+            }
+        }
+        ASSERT_EQ(1ul, libraries.size());
+        EXPECT_TRUE(boost::filesystem::exists(boost::filesystem::path(libraries.front()).replace_extension(".key")));
+        
+        // Backdate the library, so that storing a newly compiled library would be noticed.
+        boost::filesystem::last_write_time(libraries.front(), 0);
+        
+        model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel).build();
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+        EXPECT_EQ(20ul, model->getNumberOfTransitions());
+        EXPECT_EQ(0, boost::filesystem::last_write_time(libraries.front()));
+        EXPECT_EQ(2ul, std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator()));
+    }
+    boost::filesystem::remove_all(cacheDirectory);
+}
@@ -1,9 +1,18 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/environment/Environment.h"
+
+#include <boost/filesystem.hpp>
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -34,6 +43,24 @@ TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ExactDtmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/exact_guards.pm");
+    
+    // The guards and probabilities need to be evaluated exactly, so x=4 is reachable.
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model = storm::builder::ExplicitModelBuilder<storm::RationalNumber>(program).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(8ul, model->getNumberOfTransitions());
+    storm::RationalNumber oneThird = storm::utility::convertNumber<storm::RationalNumber>(1.0); oneThird /= storm::utility::convertNumber<storm::RationalNumber>(3.0);
+    for (auto const& entry : model->getTransitionMatrix().getRow(0)) {
+        EXPECT_EQ(entry.getColumn() == 0 ? oneThird + oneThird : oneThird, entry.getValue());
+    }
+    
+    // In floating point arithmetic, the guard x*0.1=0.3 does not hold.
+    std::shared_ptr<storm::models::sparse::Model<double>> doubleModel = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(4ul, doubleModel->getNumberOfStates());
+    EXPECT_EQ(7ul, doubleModel->getNumberOfTransitions());
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ctmc) {
 
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
@@ -120,6 +147,72 @@ TEST(ExplicitPrismModelBuilderTest, Ma) {
     EXPECT_EQ(7ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    std::vector<std::string> files = {"/dtmc/crowds-5-5.pm", "/dtmc/nand-5-2.pm", "/mdp/csma2-2.nm", "/mdp/firewire3-0.5.nm", "/ma/hybrid_states.ma"};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels().setBuildAllRewardModels();
+        
+        storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+        sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+        sequentialOptions.numberOfThreads = 1;
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        
+        // The parallel exploration has to yield exactly the same state numbering as the sequential one.
+        storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+        parallelOptions.numberOfThreads = 4;
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        
+        ASSERT_EQ(sequentialModel->getType(), parallelModel->getType()) << file;
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, OutOfCore) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    
+    storm::builder::ExplicitModelBuilder<double>::Options inMemoryOptions;
+    inMemoryOptions.numberOfThreads = 1;
+    std::shared_ptr<storm::models::sparse::Model<double>> inMemoryModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, inMemoryOptions).build();
+    
+    // With 32KB, only a few hundred of the 8607 states and about a thousand of the 15113 transitions fit in memory.
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directory(directory);
+    storm::builder::ExplicitModelBuilder<double>::Options outOfCoreOptions = inMemoryOptions;
+    outOfCoreOptions.outOfCoreDirectory = directory.string();
+    outOfCoreOptions.outOfCoreMemoryLimit = 32 * 1024;
+    std::shared_ptr<storm::models::sparse::Model<double>> outOfCoreModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, outOfCoreOptions).build();
+    
+    // All files that were written during the exploration are removed afterwards.
+    EXPECT_TRUE(boost::filesystem::is_empty(directory));
+    boost::filesystem::remove_all(directory);
+    
+    ASSERT_EQ(storm::models::ModelType::Dtmc, outOfCoreModel->getType());
+    EXPECT_EQ(8607ul, outOfCoreModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, outOfCoreModel->getNumberOfTransitions());
+    EXPECT_TRUE(inMemoryModel->getTransitionMatrix() == outOfCoreModel->getTransitionMatrix());
+    EXPECT_TRUE(inMemoryModel->getStateLabeling() == outOfCoreModel->getStateLabeling());
+    EXPECT_EQ(inMemoryModel->getInitialStates(), outOfCoreModel->getInitialStates());
+    
+    storm::Environment env;
+    storm::parser::FormulaParser formulaParser(std::make_shared<storm::expressions::ExpressionManager>());
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    std::vector<double> results;
+    for (auto const& model : {inMemoryModel, outOfCoreModel}) {
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*model->as<storm::models::sparse::Dtmc<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        results.push_back(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()]);
+    }
+    EXPECT_NEAR(0.3328800375801578281, results[0], 1e-6);
+    EXPECT_EQ(results[0], results[1]);
+}
+
 TEST(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
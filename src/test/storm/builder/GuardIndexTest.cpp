@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/storage/prism/Program.h"
+
+TEST(GuardIndexTest, Candidates) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+    
+    // Pack x at bit 0, y in [-3, 12] at bits 1-4 and z in [2, 5] at bits 5-6.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0);
+    variableInformation.integerVariables.emplace_back(y, -3, 12, 1, 4);
+    variableInformation.integerVariables.emplace_back(z, 2, 5, 5, 2);
+    variableInformation.totalBitOffset = 7;
+    
+    std::vector<storm::expressions::Expression> guards;
+    guards.push_back(y.getExpression() == manager->integer(0) && x);
+    guards.push_back(manager->integer(3) > y || z.getExpression() == manager->integer(4));
+    guards.push_back((y >= manager->integer(4) && y <= manager->integer(6)) || y.getExpression() == manager->integer(10));
+    guards.push_back(!x && z.getExpression() != manager->integer(2));
+    guards.push_back(y.getExpression() == manager->integer(7) && y.getExpression() == manager->integer(8));
+    guards.push_back(y.getExpression() == z.getExpression());
+    
+    storm::generator::GuardIndex index(guards, variableInformation);
+    EXPECT_TRUE(index.isDiscriminating());
+    
+    storm::expressions::ExprtkExpressionEvaluator eval(*manager);
+    storm::generator::CompressedState state(64);
+    uint64_t totalCandidates = 0;
+    uint64_t numberOfStates = 0;
+    for (uint_fast64_t xValue = 0; xValue < 2; ++xValue) {
+        for (int_fast64_t yValue = -3; yValue <= 12; ++yValue) {
+            for (int_fast64_t zValue = 2; zValue <= 5; ++zValue) {
+                state.set(0, xValue == 1);
+                state.setFromInt(1, 4, yValue + 3);
+                state.setFromInt(5, 2, zValue - 2);
+                eval.setBooleanValue(x, xValue == 1);
+                eval.setIntegerValue(y, yValue);
+                eval.setIntegerValue(z, zValue);
+                
+                // All satisfied guards need to be among the candidates and the candidates need to be ordered.
+                std::vector<uint64_t> const& candidates = index.getCandidates(state);
+                EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    if (eval.asBool(guards[guard])) {
+                        EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), guard) != candidates.end()) << guards[guard];
+                    }
+                }
+                totalCandidates += candidates.size();
+                ++numberOfStates;
+            }
+        }
+    }
+    EXPECT_LT(totalCandidates, numberOfStates * guards.size());
+    
+    // Guards that do not constrain any variable yield all guards as candidates.
+    std::vector<storm::expressions::Expression> unconstrainedGuards;
+    unconstrainedGuards.push_back(y.getExpression() == z.getExpression());
+    unconstrainedGuards.push_back(x || y > manager->integer(2));
+    storm::generator::GuardIndex trivialIndex(unconstrainedGuards, variableInformation);
+    EXPECT_FALSE(trivialIndex.isDiscriminating());
+    EXPECT_EQ(2ul, trivialIndex.getCandidates(state).size());
+}
+
+TEST(GuardIndexTest, ConstantVariable) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    
+    storm::expressions::Variable c = manager->declareIntegerVariable("c");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    
+    // The variable c has the single value 1 and is therefore not stored in the state. y in [0, 3] is at bits 0-1.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.integerVariables.emplace_back(c, 1, 1, 0, 0);
+    variableInformation.integerVariables.emplace_back(y, 0, 3, 0, 2);
+    variableInformation.totalBitOffset = 2;
+    
+    // The tests on c rule out more guards than the ones on y, but the index must not be built over c.
+    std::vector<storm::expressions::Expression> guards;
+    guards.push_back(c.getExpression() == manager->integer(1) && y.getExpression() == manager->integer(0));
+    guards.push_back(c.getExpression() == manager->integer(2));
+    guards.push_back(c.getExpression() == manager->integer(3));
+    guards.push_back(c.getExpression() == manager->integer(4) && y.getExpression() == manager->integer(1));
+    guards.push_back(y.getExpression() <= manager->integer(1));
+    
+    storm::generator::GuardIndex index(guards, variableInformation);
+    EXPECT_TRUE(index.isDiscriminating());
+    
+    storm::expressions::ExprtkExpressionEvaluator eval(*manager);
+    eval.setIntegerValue(c, 1);
+    storm::generator::CompressedState state(64);
+    for (int_fast64_t yValue = 0; yValue <= 3; ++yValue) {
+        state.setFromInt(0, 2, yValue);
+        eval.setIntegerValue(y, yValue);
+        std::vector<uint64_t> const& candidates = index.getCandidates(state);
+        EXPECT_LT(candidates.size(), guards.size());
+        for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+            if (eval.asBool(guards[guard])) {
+                EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), guard) != candidates.end()) << guards[guard];
+            }
+        }
+    }
+    
+    // If only the constant variable is tested, there is no discriminating variable.
+    std::vector<storm::expressions::Expression> constantGuards;
+    constantGuards.push_back(c.getExpression() == manager->integer(1));
+    constantGuards.push_back(c.getExpression() == manager->integer(2));
+    storm::generator::GuardIndex constantIndex(constantGuards, variableInformation);
+    EXPECT_FALSE(constantIndex.isDiscriminating());
+    EXPECT_EQ(2ul, constantIndex.getCandidates(state).size());
+}
+
+TEST(GuardIndexTest, PrismProgram) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    
+    std::vector<storm::expressions::Expression> guards;
+    for (auto const& command : program.getModule(0).getCommands()) {
+        guards.push_back(command.getGuardExpression());
+    }
+    storm::generator::GuardIndex index(guards, variableInformation);
+    ASSERT_TRUE(index.isDiscriminating());
+    
+    // The commands are guarded by s=0, ..., s=7, so every value of s yields exactly one candidate.
+    storm::expressions::Variable s = program.getManager().getVariable("s");
+    auto variableIt = std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(), [&s] (storm::generator::IntegerVariableInformation const& information) { return information.variable == s; });
+    ASSERT_TRUE(variableIt != variableInformation.integerVariables.end());
+    
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (uint64_t value = 0; value < 8; ++value) {
+        state.setFromInt(variableIt->bitOffset, variableIt->bitWidth, value);
+        std::vector<uint64_t> const& candidates = index.getCandidates(state);
+        ASSERT_EQ(1ul, candidates.size());
+        EXPECT_EQ(value, candidates.front());
+    }
+}
@@ -364,4 +364,61 @@ namespace {
         
         
     }
-}
\ No newline at end of file
+    
+    TEST(SparseCtmcCslModelCheckerTest, BoundedUntilProbabilitySeries) {
+        std::string formulasString = "P=? [ true U !\"minimum\"]";
+        formulasString += "; P=? [ F<=100 !\"minimum\"]";
+        formulasString += "; P=? [ F<=10 !\"minimum\"]";
+        formulasString += "; P=? [ F<=0 !\"minimum\"]";
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+        
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+        
+        storm::modelchecker::CheckTask<storm::logic::UntilFormula, double> task(formulas[0]->asProbabilityOperatorFormula().getSubformula().asUntilFormula());
+        std::vector<double> upperBounds = {100.0, 10.0, 0.0};
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> series = checker.computeBoundedUntilProbabilitySeries(env, task, upperBounds);
+        ASSERT_EQ(3ul, series.size());
+        EXPECT_NEAR(5.5461254704419085E-5, series[0]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        EXPECT_EQ(1ul, checker.getUniformizationCache().getNumberOfMisses());
+        
+        // The results agree with the ones for the individual properties, which take the uniformized matrix from the cache.
+        for (uint64_t index = 0; index < upperBounds.size(); ++index) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index + 1]));
+            std::vector<double> const& expected = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            std::vector<double> const& actual = series[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-10);
+            }
+        }
+        EXPECT_EQ(1ul, checker.getUniformizationCache().getNumberOfMisses());
+        EXPECT_EQ(2ul, checker.getUniformizationCache().getNumberOfHits());
+    }
+    
+    TEST(SparseCtmcCslModelCheckerTest, UniformizationCacheCapacity) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+        auto model = storm::api::buildSparseModel<double>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>())->as<storm::models::sparse::Ctmc<double>>();
+        storm::modelchecker::helper::SparseCtmcUniformizationCache<double> cache(model->getTransitionMatrix(), model->getExitRateVector(), 1);
+        
+        storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+        storm::storage::BitVector initialStates = model->getInitialStates();
+        uint64_t numberOfRows = cache.getUniformizedMatrix(allStates, 10.0).getRowCount();
+        EXPECT_EQ(model->getNumberOfStates(), numberOfRows);
+        EXPECT_EQ(1ul, cache.getUniformizedMatrix(initialStates, 10.0).getRowCount());
+        EXPECT_EQ(1ul, cache.size());
+        
+        // The matrix for all states was evicted and has to be computed again, also if the rate changes.
+        EXPECT_EQ(numberOfRows, cache.getUniformizedMatrix(allStates, 10.0).getRowCount());
+        EXPECT_EQ(numberOfRows, cache.getUniformizedMatrix(allStates, 20.0).getRowCount());
+        EXPECT_EQ(numberOfRows, cache.getUniformizedMatrix(allStates, 20.0).getRowCount());
+        EXPECT_EQ(1ul, cache.size());
+        EXPECT_EQ(4ul, cache.getNumberOfMisses());
+        EXPECT_EQ(1ul, cache.getNumberOfHits());
+    }
+}
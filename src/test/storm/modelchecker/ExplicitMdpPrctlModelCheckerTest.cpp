@@ -13,6 +13,9 @@
 #include "storm/parser/AutoParser.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/api/verification.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 TEST(ExplicitMdpPrctlModelCheckerTest, Dice) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
@@ -197,3 +200,145 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+
+TEST(ExplicitMdpPrctlModelCheckerTest, SharedQualitativeAnalysisCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+    
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    auto cache = std::make_shared<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<double>>(mdp->getTransitionMatrix());
+    
+    std::vector<std::string> formulas = {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Rmin=? [F \"done\"]", "Rmax=? [F \"done\"]", "LRAmax=? [\"done\"]"};
+    std::vector<double> expectedResults;
+    for (auto const& formulaString : formulas) {
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formulaParser.parseSingleFormulaFromString(formulaString));
+        expectedResults.push_back(result->asExplicitQuantitativeCheckResult<double>()[0]);
+    }
+    
+    // Check every formula twice with fresh model checkers that share the cache.
+    uint64_t missesAfterFirstRound = 0;
+    for (uint64_t round = 0; round < 2; ++round) {
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp, cache);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formulaParser.parseSingleFormulaFromString(formulas[index]));
+            EXPECT_NEAR(expectedResults[index], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+        }
+        if (round == 0) {
+            missesAfterFirstRound = cache->getNumberOfMisses();
+            EXPECT_LT(0ull, missesAfterFirstRound);
+        }
+    }
+    
+    // The second round did not need any further graph analysis.
+    EXPECT_EQ(missesAfterFirstRound, cache->getNumberOfMisses());
+    EXPECT_LE(missesAfterFirstRound, cache->getNumberOfHits());
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> otherModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    EXPECT_THROW(storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>(*otherModel->as<storm::models::sparse::Mdp<double>>(), cache), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, QualitativeAnalysisCacheCapacity) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<double> cache(mdp->getTransitionMatrix(), 1);
+    storm::Environment env;
+    
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp->getStates("two");
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> prob01Min = cache.getProb01(env, true, allStates, psiStates);
+    cache.getProb01(env, false, allStates, psiStates);
+    cache.getProb1(env, true, allStates, psiStates);
+    EXPECT_EQ(2ul, cache.size());
+    
+    // The result for minimal probabilities was evicted by the one for maximal probabilities, but not by the other kind.
+    EXPECT_EQ(prob01Min, cache.getProb01(env, true, allStates, psiStates));
+    cache.getProb1(env, true, allStates, psiStates);
+    EXPECT_EQ(2ul, cache.size());
+    EXPECT_EQ(4ul, cache.getNumberOfMisses());
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, NoQualitativeAnalysisCacheByDefault) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+    
+    // The cache is opt-in, so with the default settings there is none and the model checker does without it.
+    std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<double>> cache = storm::api::createQualitativeAnalysisCache(abstractModel);
+    EXPECT_FALSE(cache);
+    
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    for (auto const& formulaString : {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Rmin=? [F \"done\"]", "LRAmax=? [\"done\"]"}) {
+        auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+        std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = checker.check(env, *formula);
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checkerWithoutCache(*mdp, cache);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checkerWithoutCache.check(env, *formula);
+        EXPECT_NEAR(expectedResult->asExplicitQuantitativeCheckResult<double>()[0], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ResultHintCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+    
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    
+    std::vector<std::string> formulas = {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Pmin=? [F \"two\"]", "Rmin=? [F \"done\"]", "Rmax=? [F \"done\"]"};
+    for (auto const& method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        
+        auto cache = std::make_shared<storm::modelchecker::ResultHintCache<double>>();
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checkerWithHints(*mdp);
+        checkerWithHints.setResultHintCache(cache);
+        for (auto const& formulaString : formulas) {
+            auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+            std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = checker.check(env, *formula);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checkerWithHints.check(env, *formula);
+            EXPECT_NEAR(expectedResult->asExplicitQuantitativeCheckResult<double>()[0], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+        }
+        
+        // Results are only reused for the same optimization direction, so only the second minimal probability
+        // query found a compatible earlier result.
+        EXPECT_EQ(4ull, cache->getNumberOfMisses());
+        EXPECT_EQ(1ull, cache->getNumberOfHits());
+        EXPECT_EQ(4ull, cache->size());
+    }
+    
+    // If only one result is kept, the result of the minimal probabilities is dropped for the maximal ones.
+    auto cache = std::make_shared<storm::modelchecker::ResultHintCache<double>>(1);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checkerWithHints(*mdp);
+    checkerWithHints.setResultHintCache(cache);
+    for (auto const& formulaString : {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Pmin=? [F \"two\"]", "Pmin=? [F \"two\"]"}) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checkerWithHints.check(*formulaParser.parseSingleFormulaFromString(formulaString));
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+    EXPECT_EQ(3ull, cache->getNumberOfMisses());
+    EXPECT_EQ(1ull, cache->getNumberOfHits());
+    EXPECT_EQ(1ull, cache->size());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ResultHintCacheWithoutQualitativeAnalysisCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+    
+    // The results are shared through the API even if there is no cache for the graph analyses.
+    std::shared_ptr<storm::modelchecker::helper::SparseMdpQualitativeAnalysisCache<double>> qualitativeAnalysisCache;
+    auto resultHintCache = std::make_shared<storm::modelchecker::ResultHintCache<double>>();
+    for (auto const& formulaString : {"Pmin=? [F \"two\"]", "Pmin=? [F \"two\"]"}) {
+        auto task = storm::api::createTask<double>(formulaParser.parseSingleFormulaFromString(formulaString), true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine(abstractModel, task, qualitativeAnalysisCache, resultHintCache);
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+    EXPECT_EQ(1ull, resultHintCache->getNumberOfMisses());
+    EXPECT_EQ(1ull, resultHintCache->getNumberOfHits());
+}
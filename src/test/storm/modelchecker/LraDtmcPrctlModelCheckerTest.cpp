@@ -16,6 +16,7 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/parser/AutoParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -265,4 +266,68 @@ namespace {
             EXPECT_NEAR(this->parseNumber("1/10"), quantitativeResult1[14], this->precision());
         }
     }
-}
\ No newline at end of file
+    
+    TEST(LraDtmcPrctlModelCheckerParallelTest, ManyBsccs) {
+        // Each of the small BSCCs consists of three states (with stationary distribution 20/43, 13/43, 10/43) and
+        // the large BSCC is a cycle in which each state returns to the first one with probability 0.1.
+        uint64_t const numberOfSmallBsccs = 200;
+        uint64_t const sizeOfLargeBscc = 100;
+        uint64_t const numberOfStates = 1 + 3 * numberOfSmallBsccs + sizeOfLargeBscc;
+        uint64_t const firstStateOfLargeBscc = 1 + 3 * numberOfSmallBsccs;
+        
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+        storm::models::sparse::StateLabeling labeling(numberOfStates);
+        labeling.addLabel("a");
+        for (uint64_t bscc = 0; bscc < numberOfSmallBsccs; ++bscc) {
+            matrixBuilder.addNextValue(0, 1 + 3 * bscc, 1.0 / (numberOfSmallBsccs + 1));
+        }
+        matrixBuilder.addNextValue(0, firstStateOfLargeBscc, 1.0 / (numberOfSmallBsccs + 1));
+        for (uint64_t bscc = 0; bscc < numberOfSmallBsccs; ++bscc) {
+            uint64_t first = 1 + 3 * bscc;
+            matrixBuilder.addNextValue(first, first + 1, 0.5);
+            matrixBuilder.addNextValue(first, first + 2, 0.5);
+            matrixBuilder.addNextValue(first + 1, first, 1.0);
+            matrixBuilder.addNextValue(first + 2, first, 0.7);
+            matrixBuilder.addNextValue(first + 2, first + 1, 0.3);
+            labeling.addLabelToState("a", first + bscc % 3);
+        }
+        for (uint64_t state = firstStateOfLargeBscc; state < numberOfStates - 1; ++state) {
+            matrixBuilder.addNextValue(state, firstStateOfLargeBscc, 0.1);
+            matrixBuilder.addNextValue(state, state + 1, 0.9);
+        }
+        matrixBuilder.addNextValue(numberOfStates - 1, firstStateOfLargeBscc, 1.0);
+        labeling.addLabelToState("a", firstStateOfLargeBscc);
+        
+        storm::models::sparse::Dtmc<double> dtmc(matrixBuilder.build(), labeling);
+        storm::parser::FormulaParser formulaParser;
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("LRA=? [\"a\"]");
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+        
+        // Solve all BSCCs with the linear equation solver in a single thread.
+        storm::Environment sequentialEnv;
+        sequentialEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        sequentialEnv.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        sequentialEnv.modelchecker().setLraNumberOfThreads(1);
+        sequentialEnv.modelchecker().setLraDirectSolverThreshold(0);
+        std::vector<double> sequentialResult = checker.check(sequentialEnv, *formula)->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        
+        // Solve the small BSCCs directly in several threads.
+        storm::Environment parallelEnv = sequentialEnv;
+        parallelEnv.modelchecker().setLraNumberOfThreads(4);
+        parallelEnv.modelchecker().setLraDirectSolverThreshold(64);
+        std::vector<double> parallelResult = checker.check(parallelEnv, *formula)->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        
+        std::vector<double> const expectedSmallBsccValues = {20.0 / 43.0, 13.0 / 43.0, 10.0 / 43.0};
+        double expectedLargeBsccValue = 0.1 / (1.0 - std::pow(0.9, sizeOfLargeBscc));
+        ASSERT_EQ(numberOfStates, parallelResult.size());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(sequentialResult[state], parallelResult[state], 1e-6);
+        }
+        for (uint64_t bscc = 0; bscc < numberOfSmallBsccs; ++bscc) {
+            for (uint64_t offset = 0; offset < 3; ++offset) {
+                EXPECT_NEAR(expectedSmallBsccValues[bscc % 3], parallelResult[1 + 3 * bscc + offset], 1e-6);
+            }
+        }
+        EXPECT_NEAR(expectedLargeBsccValue, parallelResult[firstStateOfLargeBscc], 1e-6);
+    }
+}
@@ -8,10 +8,28 @@
 #include "storm/parser/FormulaParser.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+namespace {
+    // Lets the exploration sample with the given number of threads and perform precomputations frequently, so that
+    // the workers often compete for them.
+    class ExplorationThreadsMemento {
+    public:
+        ExplorationThreadsMemento(uint64_t numberOfThreads) {
+            storm::settings::mutableManager().setFromString("--exploration:threads " + std::to_string(numberOfThreads) + " --exploration:stepsprecomp 200 --exploration:pathsprecomp 50");
+        }
+        
+        ~ExplorationThreadsMemento() {
+            // The memento unsets the option when it goes out of scope.
+            storm::settings::SettingMemento pathsMemento(storm::settings::mutableManager().getModule(storm::settings::modules::ExplorationSettings::moduleName), "pathsprecomp", false);
+            storm::settings::mutableManager().setFromString("--exploration:threads 1 --exploration:stepsprecomp 100000");
+        }
+    };
+}
+
 TEST(SparseExplorationModelCheckerTest, Dice) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
     
@@ -86,3 +104,23 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, MultipleThreads) {
+    std::vector<std::pair<std::string, std::string>> filesAndFormulas = {{"/mdp/two_dice.nm", "Pmin=? [F \"three\"]"}, {"/mdp/two_dice.nm", "Pmax=? [F \"four\"]"}, {"/mdp/leader4.nm", "Pmin=? [F \"elected\"]"}, {"/mdp/leader4.nm", "Pmax=? [F \"elected\"]"}};
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    storm::parser::FormulaParser formulaParser;
+    for (auto const& fileAndFormula : filesAndFormulas) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileAndFormula.first);
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(fileAndFormula.second);
+        
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> sequentialChecker(program);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = sequentialChecker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        double sequentialValue = sequentialResult->asExplicitQuantitativeCheckResult<double>()[0];
+        
+        // Both results are lower bounds that are at most the precision away from the actual value.
+        ExplorationThreadsMemento threadsMemento(4);
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> parallelChecker(program);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = parallelChecker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(sequentialValue, parallelResult->asExplicitQuantitativeCheckResult<double>()[0], precision) << fileAndFormula.first << ": " << fileAndFormula.second;
+    }
+}
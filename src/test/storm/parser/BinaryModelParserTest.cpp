@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/parser/BinaryModelParser.h"
+#include "storm/parser/DirectEncodingParser.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/utility/BinaryModelExporter.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::string exportToFile(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%.bin")).string();
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, model);
+        return filename;
+    }
+
+    // Overwrites the word at the given position (counted in words) of the given file.
+    void overwriteWord(std::string const& filename, uint64_t position, uint64_t word) {
+        std::fstream stream(filename, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(position * sizeof(uint64_t));
+        stream.write(reinterpret_cast<char const*>(&word), sizeof(uint64_t));
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::string filename = exportToFile(model);
+        std::shared_ptr<storm::models::sparse::Model<double>> result = storm::parser::BinaryModelParser<double>::parseModel(filename);
+        boost::filesystem::remove(filename);
+        return result;
+    }
+
+    void checkEqual(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+        ASSERT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+        EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+        EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+        ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+        if (expected.hasChoiceLabeling()) {
+            EXPECT_TRUE(expected.getChoiceLabeling() == actual.getChoiceLabeling());
+        }
+
+        ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(nameRewardModelPair.first));
+            auto const& expectedRewardModel = nameRewardModelPair.second;
+            auto const& actualRewardModel = actual.getRewardModel(nameRewardModelPair.first);
+            ASSERT_EQ(expectedRewardModel.hasStateRewards(), actualRewardModel.hasStateRewards());
+            if (expectedRewardModel.hasStateRewards()) {
+                EXPECT_EQ(expectedRewardModel.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(expectedRewardModel.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+            if (expectedRewardModel.hasStateActionRewards()) {
+                EXPECT_EQ(expectedRewardModel.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+            }
+            ASSERT_EQ(expectedRewardModel.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+            if (expectedRewardModel.hasTransitionRewards()) {
+                EXPECT_TRUE(expectedRewardModel.getTransitionRewardMatrix() == actualRewardModel.getTransitionRewardMatrix());
+            }
+        }
+    }
+}
+
+TEST(BinaryModelParserTest, CtmcRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModel = exportAndParse(model);
+
+    checkEqual(*model, *parsedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), parsedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    EXPECT_EQ(64ul, parsedModel->getStates("premium").getNumberOfSetBits());
+}
+
+TEST(BinaryModelParserTest, MdpRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModel = exportAndParse(model);
+
+    checkEqual(*model, *parsedModel);
+    EXPECT_EQ(254ul, parsedModel->getNumberOfChoices());
+}
+
+TEST(BinaryModelParserTest, DtmcWithRewardsRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true)).build();
+    ASSERT_LT(0ul, model->getNumberOfRewardModels());
+
+    checkEqual(*model, *exportAndParse(model));
+}
+
+TEST(BinaryModelParserTest, MarkovAutomatonRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true).setBuildChoiceLabels(true)).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModel = exportAndParse(model);
+
+    checkEqual(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryModelParserTest, CorruptFile) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    uint64_t numberOfStates = model->getNumberOfStates();
+    uint64_t numberOfEntries = model->getTransitionMatrix().getEntryCount();
+
+    // The header has eleven words and is followed by the number of entries, the row indications of the matrix and
+    // the entries, each of which consists of its column and its value.
+    uint64_t rowIndicationsPosition = 12;
+    uint64_t entriesPosition = rowIndicationsPosition + numberOfStates + 1;
+
+    // Row indications that decrease.
+    std::string filename = exportToFile(model);
+    overwriteWord(filename, rowIndicationsPosition + 1, numberOfEntries);
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+
+    // Row indications that do not end at the number of entries.
+    filename = exportToFile(model);
+    overwriteWord(filename, rowIndicationsPosition + numberOfStates, numberOfEntries - 1);
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+
+    // A column that exceeds the number of states.
+    filename = exportToFile(model);
+    overwriteWord(filename, entriesPosition, numberOfStates);
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+
+    // A truncated file.
+    filename = exportToFile(model);
+    boost::filesystem::resize_file(filename, (entriesPosition + numberOfEntries) * sizeof(uint64_t));
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+    
+    // A number of states (and choices) for which the number of row indications is not representable.
+    filename = exportToFile(model);
+    overwriteWord(filename, 6, std::numeric_limits<uint64_t>::max());
+    overwriteWord(filename, 7, std::numeric_limits<uint64_t>::max());
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+}
@@ -39,6 +39,21 @@ namespace {
         }
     };
     
+    class NativeDoubleOptimisticValueIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration);
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            return env;
+        }
+    };
+    
     class NativeDoubleIntervalIterationEnvironment {
     public:
         typedef double ValueType;
@@ -279,6 +294,21 @@ namespace {
         }
     };
     
+    class TopologicalParallelEigenDoubleLUEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().topological().setSccBatchSize(1);
+            env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+            return env;
+        }
+    };
+    
     template<typename TestType>
     class LinearEquationSolverTest : public ::testing::Test {
     public:
@@ -294,6 +324,7 @@ namespace {
     typedef ::testing::Types<
             NativeDoublePowerEnvironment,
             NativeDoubleSoundValueIterationEnvironment,
+            NativeDoubleOptimisticValueIterationEnvironment,
             NativeDoubleIntervalIterationEnvironment,
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
@@ -311,7 +342,8 @@ namespace {
             EigenBicgstabNoneEnvironment,
             EigenDoubleLUEnvironment,
             EigenRationalLUEnvironment,
-            TopologicalEigenRationalLUEnvironment
+            TopologicalEigenRationalLUEnvironment,
+            TopologicalParallelEigenDoubleLUEnvironment
     > TestingTypes;
     
     TYPED_TEST_CASE(LinearEquationSolverTest, TestingTypes);
@@ -35,6 +35,18 @@ namespace {
             return env;
         }
     };
+    class DoubleOptimisticViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
     
     class DoubleIntervalIterationEnvironment {
     public:
@@ -123,6 +135,7 @@ namespace {
     typedef ::testing::Types<
             DoubleViEnvironment,
             DoubleSoundViEnvironment,
+            DoubleOptimisticViEnvironment,
             DoubleIntervalIterationEnvironment,
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
@@ -16,6 +16,44 @@ namespace {
         static storm::Environment createEnvironment() {
             storm::Environment env;
             env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setVectorInstructionSet(storm::storage::kernels::VectorInstructionSet::Scalar);
+            return env;
+        }
+    };
+    
+    class NativeCompactEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setCompactLayout(true);
+            env.solver().multiplier().setVectorInstructionSet(storm::storage::kernels::VectorInstructionSet::Scalar);
+            return env;
+        }
+    };
+    
+    class NativeVectorizedEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setVectorInstructionSet(storm::storage::kernels::getVectorInstructionSet());
+            return env;
+        }
+    };
+    
+    class NativeParallelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setNumberOfThreads(4);
             return env;
         }
     };
@@ -45,6 +83,9 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
+            NativeCompactEnvironment,
+            NativeVectorizedEnvironment,
+            NativeParallelEnvironment,
             GmmxxEnvironment
     > TestingTypes;
     
@@ -120,4 +161,99 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
+    TYPED_TEST(MultiplierTest, ownedMatrixTest) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        // A multiplier that owns its matrix may drop the original entries, so it has to yield the same results.
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        auto owningMultiplier = factory.create(this->env(), storm::storage::SparseMatrix<ValueType>(A));
+        
+        std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+        std::vector<ValueType> x = initialX;
+        std::vector<ValueType> y = initialX;
+        ASSERT_NO_THROW(multiplier->repeatedMultiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, x, nullptr, 20));
+        ASSERT_NO_THROW(owningMultiplier->repeatedMultiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, y, nullptr, 20));
+        EXPECT_EQ(x, y);
+        
+        x = initialX;
+        y = initialX;
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), storm::OptimizationDirection::Minimize, x, nullptr));
+        ASSERT_NO_THROW(owningMultiplier->multiplyAndReduceGaussSeidel(this->env(), storm::OptimizationDirection::Minimize, y, nullptr));
+        EXPECT_EQ(x, y);
+        
+        for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+            ValueType value = storm::utility::zero<ValueType>();
+            ValueType owningValue = storm::utility::zero<ValueType>();
+            multiplier->multiplyRow(row, initialX, value);
+            owningMultiplier->multiplyRow(row, initialX, owningValue);
+            EXPECT_EQ(value, owningValue);
+        }
+    }
+    
+    TEST(MultiplierTest, ownedCompactMatrixTest) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.099));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.001));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, 1.0));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, 1.0));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setNumberOfThreads(1);
+        storm::Environment compactEnv = env;
+        compactEnv.solver().multiplier().setCompactLayout(true);
+        
+        // The owning multiplier drops the entries of its matrix, so its sequential operations must use the compact
+        // matrix, even if the environment given to them does not request the compact layout.
+        auto factory = storm::solver::MultiplierFactory<double>();
+        auto multiplier = factory.create(env, A);
+        auto owningMultiplier = factory.create(compactEnv, storm::storage::SparseMatrix<double>(A));
+        
+        std::vector<double> x = {0.3, 1.0, 0.7};
+        std::vector<double> b = {0.1, 0.0, 0.2, 0.0};
+        for (auto const& callEnv : {compactEnv, env}) {
+            std::vector<double> result(A.getRowCount());
+            std::vector<double> owningResult(A.getRowCount());
+            ASSERT_NO_THROW(multiplier->multiply(env, x, &b, result));
+            ASSERT_NO_THROW(owningMultiplier->multiply(callEnv, x, &b, owningResult));
+            EXPECT_EQ(result, owningResult);
+            
+            for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+                std::vector<double> groupResult(A.getRowGroupCount());
+                std::vector<double> owningGroupResult(A.getRowGroupCount());
+                std::vector<uint_fast64_t> choices(A.getRowGroupCount());
+                std::vector<uint_fast64_t> owningChoices(A.getRowGroupCount());
+                ASSERT_NO_THROW(multiplier->multiplyAndReduce(env, dir, x, &b, groupResult, &choices));
+                ASSERT_NO_THROW(owningMultiplier->multiplyAndReduce(callEnv, dir, x, &b, owningGroupResult, &owningChoices));
+                EXPECT_EQ(groupResult, owningGroupResult);
+                EXPECT_EQ(choices, owningChoices);
+            }
+        }
+    }
+    
 }
\ No newline at end of file
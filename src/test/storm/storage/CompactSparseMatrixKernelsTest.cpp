@@ -0,0 +1,187 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "storm/storage/CompactSparseMatrixKernels.h"
+
+namespace {
+    using storm::storage::kernels::VectorInstructionSet;
+    
+    // A matrix in the compact layout whose rows have 0 to 19 entries, so that all remainders of the vector width occur.
+    struct TestMatrix {
+        TestMatrix(uint64_t numberOfGroups, uint64_t numberOfColumns) {
+            std::mt19937 generator(42);
+            std::uniform_int_distribution<uint64_t> groupSizeDistribution(0, 6);
+            std::uniform_int_distribution<uint64_t> rowSizeDistribution(0, 19);
+            std::uniform_int_distribution<uint32_t> columnDistribution(0, numberOfColumns - 1);
+            std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+            
+            rowGroupIndices.push_back(0);
+            rowIndications.push_back(0);
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                uint64_t groupSize = groupSizeDistribution(generator);
+                for (uint64_t choice = 0; choice < groupSize; ++choice) {
+                    uint64_t rowSize = rowSizeDistribution(generator);
+                    for (uint64_t entry = 0; entry < rowSize; ++entry) {
+                        columns.push_back(columnDistribution(generator));
+                        values.push_back(valueDistribution(generator));
+                    }
+                    rowIndications.push_back(columns.size());
+                    summand.push_back(valueDistribution(generator));
+                }
+                rowGroupIndices.push_back(rowIndications.size() - 1);
+            }
+            
+            for (uint64_t column = 0; column < numberOfColumns; ++column) {
+                x.push_back(valueDistribution(generator));
+            }
+        }
+        
+        uint64_t getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+        
+        double multiplyRow(uint64_t row) const {
+            double result = summand[row];
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                result += values[entry] * x[columns[entry]];
+            }
+            return result;
+        }
+        
+        /*!
+         * The kernels add up the products of a row in a different order than the scalar loop, so we allow the
+         * difference that is documented for the kernels: Both sums are within gamma(n + 1) times the sum of the
+         * absolute values of the summands of the exact result.
+         */
+        double getTolerance(uint64_t row) const {
+            double magnitude = std::abs(summand[row]);
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                magnitude += std::abs(values[entry] * x[columns[entry]]);
+            }
+            double numberOfSummands = static_cast<double>(rowIndications[row + 1] - rowIndications[row] + 1);
+            double unitRoundoff = std::numeric_limits<double>::epsilon() / 2;
+            double gamma = numberOfSummands * unitRoundoff / (1 - numberOfSummands * unitRoundoff);
+            return 2 * gamma * magnitude;
+        }
+        
+        std::vector<uint64_t> rowGroupIndices;
+        std::vector<uint64_t> rowIndications;
+        std::vector<uint32_t> columns;
+        std::vector<double> values;
+        std::vector<double> summand;
+        std::vector<double> x;
+    };
+    
+    std::vector<VectorInstructionSet> getSupportedVectorInstructionSets() {
+        std::vector<VectorInstructionSet> result;
+        for (auto const& instructionSet : {VectorInstructionSet::Avx2, VectorInstructionSet::Avx512}) {
+            if (storm::storage::kernels::isSupported(instructionSet)) {
+                result.push_back(instructionSet);
+            }
+        }
+        return result;
+    }
+}
+
+TEST(CompactSparseMatrixKernelsTest, MultiplyWithVector) {
+    TestMatrix matrix(500, 300);
+    for (auto const& instructionSet : getSupportedVectorInstructionSets()) {
+        std::vector<double> result(matrix.getRowCount(), -1.0);
+        ASSERT_TRUE(storm::storage::kernels::multiplyWithVector(instructionSet, matrix.rowIndications.data(), matrix.columns.data(), matrix.values.data(), matrix.x.data(), matrix.summand.data(), result.data(), 0, matrix.getRowCount()));
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(matrix.multiplyRow(row), result[row], matrix.getTolerance(row)) << "row " << row << " with " << instructionSet;
+        }
+        
+        // Only the given range of rows is touched and the summand is optional.
+        std::vector<double> partialResult(matrix.getRowCount(), -1.0);
+        ASSERT_TRUE(storm::storage::kernels::multiplyWithVector(instructionSet, matrix.rowIndications.data(), matrix.columns.data(), matrix.values.data(), matrix.x.data(), nullptr, partialResult.data(), 3, 17));
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            if (row < 3 || row >= 17) {
+                EXPECT_EQ(-1.0, partialResult[row]);
+            } else {
+                EXPECT_NEAR(matrix.multiplyRow(row) - matrix.summand[row], partialResult[row], matrix.getTolerance(row));
+            }
+        }
+    }
+    
+    std::vector<double> result(matrix.getRowCount());
+    EXPECT_FALSE(storm::storage::kernels::multiplyWithVector(VectorInstructionSet::Scalar, matrix.rowIndications.data(), matrix.columns.data(), matrix.values.data(), matrix.x.data(), nullptr, result.data(), 0, matrix.getRowCount()));
+}
+
+TEST(CompactSparseMatrixKernelsTest, MultiplyAndReduce) {
+    TestMatrix matrix(500, 300);
+    uint64_t numberOfGroups = matrix.rowGroupIndices.size() - 1;
+    for (auto const& instructionSet : getSupportedVectorInstructionSets()) {
+        for (bool minimize : {true, false}) {
+            std::vector<double> result(numberOfGroups, -1.0);
+            std::vector<uint_fast64_t> choices(numberOfGroups, 42);
+            ASSERT_TRUE(storm::storage::kernels::multiplyAndReduce(instructionSet, minimize, matrix.rowGroupIndices.data(), matrix.rowIndications.data(), matrix.columns.data(), matrix.values.data(), matrix.x.data(), matrix.summand.data(), result.data(), choices.data(), 0, numberOfGroups));
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                uint64_t firstRow = matrix.rowGroupIndices[group];
+                uint64_t numberOfChoices = matrix.rowGroupIndices[group + 1] - firstRow;
+                if (numberOfChoices == 0) {
+                    EXPECT_EQ(0.0, result[group]);
+                    EXPECT_EQ(0ul, choices[group]);
+                    continue;
+                }
+                uint64_t expectedChoice = 0;
+                for (uint64_t choice = 1; choice < numberOfChoices; ++choice) {
+                    double value = matrix.multiplyRow(firstRow + choice);
+                    double bestValue = matrix.multiplyRow(firstRow + expectedChoice);
+                    if (minimize ? value < bestValue : value > bestValue) {
+                        expectedChoice = choice;
+                    }
+                }
+                EXPECT_EQ(expectedChoice, choices[group]) << "group " << group << " with " << instructionSet;
+                EXPECT_NEAR(matrix.multiplyRow(firstRow + expectedChoice), result[group], matrix.getTolerance(firstRow + expectedChoice)) << "group " << group << " with " << instructionSet;
+            }
+        }
+    }
+}
+
+TEST(CompactSparseMatrixKernelsTest, MultiplyAndReduceTies) {
+    // Two groups with three and five identical choices: the first choice is to be selected.
+    std::vector<uint64_t> rowGroupIndices = {0, 3, 8};
+    std::vector<uint64_t> rowIndications = {0, 2, 4, 6, 8, 10, 12, 14, 16};
+    std::vector<uint32_t> columns = {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+    std::vector<double> values(16, 0.5);
+    std::vector<double> x = {0.2, 0.4};
+    for (auto const& instructionSet : getSupportedVectorInstructionSets()) {
+        for (bool minimize : {true, false}) {
+            std::vector<double> result(2);
+            std::vector<uint_fast64_t> choices(2, 42);
+            ASSERT_TRUE(storm::storage::kernels::multiplyAndReduce(instructionSet, minimize, rowGroupIndices.data(), rowIndications.data(), columns.data(), values.data(), x.data(), nullptr, result.data(), choices.data(), 0, 2));
+            EXPECT_EQ(0ul, choices[0]);
+            EXPECT_EQ(0ul, choices[1]);
+            EXPECT_NEAR(0.3, result[0], 1e-15);
+            EXPECT_NEAR(0.3, result[1], 1e-15);
+        }
+    }
+}
+
+TEST(CompactSparseMatrixKernelsTest, CancellationWithinTolerance) {
+    // A row whose products cancel each other, which makes the result depend on the order of the summation.
+    std::vector<uint64_t> rowIndications = {0, 9};
+    std::vector<uint32_t> columns = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<double> values = {1.0, 1e16, 1.0, -1e16, 1.0, 1e16, 1.0, -1e16, 1.0};
+    double magnitude = 0.0;
+    double scalarResult = 0.0;
+    for (uint64_t entry = 0; entry < values.size(); ++entry) {
+        magnitude += std::abs(values[entry]);
+        scalarResult += values[entry];
+    }
+    std::vector<double> x(9, 1.0);
+    double unitRoundoff = std::numeric_limits<double>::epsilon() / 2;
+    double tolerance = 2 * 10 * unitRoundoff / (1 - 10 * unitRoundoff) * magnitude;
+    
+    for (auto const& instructionSet : getSupportedVectorInstructionSets()) {
+        double result;
+        ASSERT_TRUE(storm::storage::kernels::multiplyWithVector(instructionSet, rowIndications.data(), columns.data(), values.data(), x.data(), nullptr, &result, 0, 1));
+        EXPECT_NEAR(scalarResult, result, tolerance) << "with " << instructionSet;
+    }
+}
@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t number) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, number);
+        key.setFromInt(64, 64, number * 7 + 3);
+        return key;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+    
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+    
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+    
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+    
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    
+    std::pair<uint64_t, uint64_t> valueBucketPair = map.findOrAddAndGetBucket(third, 3);
+    EXPECT_EQ(3ul, valueBucketPair.first);
+    EXPECT_EQ(2ul, valueBucketPair.second);
+    
+    EXPECT_EQ(1ul, map.findOrAdd(first, 2));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 1));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 1));
+    EXPECT_EQ(3ul, map.size());
+    
+    EXPECT_TRUE(map.contains(second));
+    EXPECT_EQ(2ul, map.getValue(second));
+    EXPECT_EQ(third, map.getBucketAndValue(2).first);
+    
+    storm::storage::BitVector fourth(64);
+    fourth.set(12);
+    fourth.set(14);
+    EXPECT_FALSE(map.contains(fourth));
+    
+    std::pair<uint64_t, bool> valueInsertedPair = map.findOrAddLazily(fourth, [] (uint64_t bucket) { return bucket + 10; });
+    EXPECT_EQ(13ul, valueInsertedPair.first);
+    EXPECT_TRUE(valueInsertedPair.second);
+    valueInsertedPair = map.findOrAddLazily(fourth, [] (uint64_t bucket) { return bucket + 20; });
+    EXPECT_EQ(13ul, valueInsertedPair.first);
+    EXPECT_FALSE(valueInsertedPair.second);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Growth) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10);
+    uint64_t initialCapacity = map.capacity();
+    
+    for (uint64_t number = 0; number < 20000; ++number) {
+        ASSERT_EQ(number, map.findOrAdd(createKey(number), number));
+    }
+    EXPECT_EQ(20000ul, map.size());
+    EXPECT_LT(initialCapacity, map.capacity());
+    
+    for (uint64_t number = 0; number < 20000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(createKey(number), 0));
+    }
+    EXPECT_FALSE(map.contains(createKey(20000)));
+    
+    // The elements are enumerated in the order of insertion.
+    uint64_t number = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(createKey(number), keyValuePair.first);
+        EXPECT_EQ(number, keyValuePair.second);
+        ++number;
+    }
+    EXPECT_EQ(20000ul, number);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 10);
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 50000;
+    
+    // All threads insert the same keys (starting at different positions), so each key must be inserted by exactly one thread.
+    std::vector<uint64_t> numberOfInsertions(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&map, &numberOfInsertions, thread, numberOfKeys] () {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t number = (step + thread * 12345) % numberOfKeys;
+                std::pair<uint64_t, bool> valueInsertedPair = map.findOrAddLazily(createKey(number), [] (uint64_t bucket) { return bucket; });
+                if (valueInsertedPair.second) {
+                    ++numberOfInsertions[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    uint64_t totalInsertions = 0;
+    for (auto const& insertions : numberOfInsertions) {
+        totalInsertions += insertions;
+    }
+    EXPECT_EQ(numberOfKeys, totalInsertions);
+    EXPECT_EQ(numberOfKeys, map.size());
+    
+    // The value of every key is its bucket.
+    std::vector<bool> found(numberOfKeys, false);
+    uint64_t bucket = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(bucket, keyValuePair.second);
+        uint64_t number = keyValuePair.first.getAsInt(0, 64);
+        ASSERT_LT(number, numberOfKeys);
+        EXPECT_FALSE(found[number]);
+        found[number] = true;
+        EXPECT_EQ(bucket, map.getValue(createKey(number)));
+        ++bucket;
+    }
+}
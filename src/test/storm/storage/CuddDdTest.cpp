@@ -4,6 +4,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/DdTranslationCache.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
@@ -716,6 +717,81 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, TranslationCacheTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> states = manager->getRange(x.first);
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() + manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> cache;
+    storm::dd::Odd odd = cache.getOdd(states);
+    EXPECT_EQ(9ul, odd.getTotalOffset());
+    EXPECT_EQ(odd.getElseOffset(), odd.getElseSuccessor().getTotalOffset());
+    EXPECT_EQ(9ul, cache.getOdd(states).getTotalOffset());
+    
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> matrix = cache.getMatrix(dd, states);
+    EXPECT_EQ(matrix, cache.getMatrix(dd, states));
+    EXPECT_TRUE(*matrix == dd.toMatrix(odd, odd));
+    EXPECT_EQ(25ul, matrix->getNonzeroEntryCount());
+    
+    std::shared_ptr<std::vector<double> const> vector = cache.getVector(manager->template getIdentity<double>(x.first), states);
+    ASSERT_EQ(9ul, vector->size());
+    for (uint_fast64_t i = 0; i < vector->size(); ++i) {
+        EXPECT_TRUE(i + 1 == (*vector)[i]);
+    }
+    
+    EXPECT_EQ(3ul, cache.getNumberOfMisses());
+    EXPECT_EQ(4ul, cache.getNumberOfHits());
+    
+    // Entries that were evicted from the cache remain usable.
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> smallCache(1);
+    storm::dd::Odd firstOdd = smallCache.getOdd(states);
+    smallCache.getOdd(manager->getEncoding(x.first, 1));
+    EXPECT_EQ(9ul, firstOdd.getTotalOffset());
+    EXPECT_EQ(9ul, smallCache.getOdd(states).getTotalOffset());
+    EXPECT_EQ(3ul, smallCache.getNumberOfMisses());
+    
+    // A cache without capacity stores nothing.
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> disabledCache(0);
+    EXPECT_TRUE(*disabledCache.getMatrix(dd, states) == *matrix);
+    EXPECT_TRUE(*disabledCache.getMatrix(dd, states) == *matrix);
+    EXPECT_EQ(0ul, disabledCache.getNumberOfHits());
+    EXPECT_EQ(0ul, disabledCache.getMemoryUsage());
+    EXPECT_FALSE(disabledCache.isEnabled());
+    
+    // Taking a translation only moves it out if the cache does not keep it.
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> uncachedMatrix = disabledCache.getMatrix(dd, states);
+    EXPECT_FALSE(storm::dd::isSharedTranslation(uncachedMatrix));
+    EXPECT_TRUE(storm::dd::takeTranslation(std::move(uncachedMatrix)) == *matrix);
+    EXPECT_FALSE(uncachedMatrix);
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> cachedMatrix = cache.getMatrix(dd, states);
+    EXPECT_TRUE(storm::dd::isSharedTranslation(cachedMatrix));
+    EXPECT_TRUE(storm::dd::takeTranslation(std::move(cachedMatrix)) == *matrix);
+    EXPECT_EQ(25ul, cache.getMatrix(dd, states)->getNonzeroEntryCount());
+    
+    // An ODD is accounted with the size of its node storage and the nodes of the set of states it was created for.
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> oddCache;
+    storm::dd::Odd cachedOdd = oddCache.getOdd(states);
+    EXPECT_LT(0ul, cachedOdd.getStorageSize());
+    EXPECT_LT(cachedOdd.getStorageSize(), oddCache.getMemoryUsage());
+    
+    // The matrix fits into the memory limit, but not together with the ODD.
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> unboundedCache;
+    unboundedCache.getMatrix(dd, states);
+    uint64_t memoryLimit = unboundedCache.getMemoryUsage() - 1;
+    storm::dd::DdTranslationCache<storm::dd::DdType::CUDD, double> boundedCache(8, memoryLimit);
+    EXPECT_TRUE(*boundedCache.getMatrix(dd, states) == *matrix);
+    EXPECT_LE(boundedCache.getMemoryUsage(), memoryLimit);
+    EXPECT_TRUE(*boundedCache.getMatrix(dd, states) == *matrix);
+    EXPECT_EQ(1ul, boundedCache.getNumberOfHits());
+    EXPECT_EQ(9ul, boundedCache.getVector(manager->template getIdentity<double>(x.first), states)->size());
+    EXPECT_LE(boundedCache.getMemoryUsage(), memoryLimit);
+    boundedCache.clear();
+    EXPECT_EQ(0ul, boundedCache.getMemoryUsage());
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
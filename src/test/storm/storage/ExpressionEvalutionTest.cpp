@@ -3,6 +3,8 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+#include "storm/generator/ExpressionBytecode.h"
+#include "storm/generator/VariableInformation.h"
 
 TEST(ExpressionEvaluation, NaiveEvaluation) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
@@ -60,3 +62,71 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
         EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
     }
 }
+
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    storm::expressions::Variable w;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+    ASSERT_NO_THROW(z = manager->declareIntegerVariable("z"));
+    ASSERT_NO_THROW(w = manager->declareRationalVariable("w"));
+    
+    // Pack x at bit 0, y in [-3, 12] at bits 1-4 and z in [2, 5] at bits 5-6.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0);
+    variableInformation.integerVariables.emplace_back(y, -3, 12, 1, 4);
+    variableInformation.integerVariables.emplace_back(z, 2, 5, 5, 2);
+    variableInformation.totalBitOffset = 7;
+    
+    std::vector<storm::expressions::Expression> expressions;
+    expressions.push_back(storm::expressions::ite(x, y + z, manager->integer(3) * z));
+    expressions.push_back(x && y > manager->integer(2));
+    expressions.push_back(!x || y * z <= manager->integer(4));
+    expressions.push_back(storm::expressions::implies(x, y.getExpression() >= z.getExpression()));
+    expressions.push_back(storm::expressions::xclusiveor(x, y.getExpression() != z.getExpression()));
+    expressions.push_back(storm::expressions::iff(y.getExpression() < z.getExpression(), x));
+    expressions.push_back(storm::expressions::minimum(y, z) - storm::expressions::maximum(y, manager->integer(0)));
+    expressions.push_back(storm::expressions::floor(y / manager->rational(2.5)) + storm::expressions::ceil(z / manager->rational(3.0)));
+    expressions.push_back(-y + (z ^ manager->integer(2)));
+    expressions.push_back(storm::expressions::ite(y > manager->integer(0), manager->rational(0.25) * y, manager->rational(1.0) / z));
+    
+    storm::generator::ExpressionBytecodeCompiler compiler(variableInformation);
+    std::vector<boost::optional<storm::generator::ExpressionBytecode>> bytecode;
+    for (auto const& expression : expressions) {
+        bytecode.push_back(compiler.compile(expression));
+        ASSERT_TRUE(static_cast<bool>(bytecode.back()));
+    }
+    
+    // Expressions over variables that are not stored in the states can not be compiled.
+    EXPECT_FALSE(static_cast<bool>(compiler.compile(y + w)));
+    
+    storm::expressions::ExprtkExpressionEvaluator eval(*manager);
+    storm::generator::CompressedState state(64);
+    for (uint_fast64_t xValue = 0; xValue < 2; ++xValue) {
+        for (int_fast64_t yValue = -3; yValue <= 12; ++yValue) {
+            for (int_fast64_t zValue = 2; zValue <= 5; ++zValue) {
+                state.set(0, xValue == 1);
+                state.setFromInt(1, 4, yValue + 3);
+                state.setFromInt(5, 2, zValue - 2);
+                eval.setBooleanValue(x, xValue == 1);
+                eval.setIntegerValue(y, yValue);
+                eval.setIntegerValue(z, zValue);
+                
+                for (uint_fast64_t index = 0; index < expressions.size(); ++index) {
+                    storm::expressions::Expression const& expression = expressions[index];
+                    if (expression.hasBooleanType()) {
+                        EXPECT_EQ(eval.asBool(expression), bytecode[index]->evaluateAsBool(state)) << expression;
+                    } else if (expression.hasIntegerType()) {
+                        EXPECT_EQ(eval.asInt(expression), bytecode[index]->evaluateAsInt(state)) << expression;
+                    } else {
+                        EXPECT_NEAR(eval.asRational(expression), bytecode[index]->evaluateAsDouble(state), 1e-9) << expression;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -133,3 +133,32 @@ TEST(MaximalEndComponentDecomposition, Subsystem) {
         ASSERT_TRUE(false);
     }
 }
+
+TEST(MaximalEndComponentDecomposition, MultipleThreads) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
+    
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> markovAutomaton = abstractModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::storage::BitVector allStates(markovAutomaton->getNumberOfStates(), true);
+    
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(markovAutomaton->getTransitionMatrix(), markovAutomaton->getBackwardTransitions(), allStates, 1);
+    storm::storage::MaximalEndComponentDecomposition<double> parallelMecDecomposition;
+    ASSERT_NO_THROW(parallelMecDecomposition = storm::storage::MaximalEndComponentDecomposition<double>(markovAutomaton->getTransitionMatrix(), markovAutomaton->getBackwardTransitions(), allStates, 4));
+    ASSERT_EQ(2ul, parallelMecDecomposition.size());
+    ASSERT_EQ(mecDecomposition.size(), parallelMecDecomposition.size());
+    
+    // The MECs may be found in a different order, but their states and choices have to coincide.
+    for (auto const& parallelMec : parallelMecDecomposition) {
+        bool found = false;
+        for (auto const& mec : mecDecomposition) {
+            if (mec.containsState(*parallelMec.getStateSet().begin())) {
+                found = true;
+                ASSERT_EQ(mec.getStateSet(), parallelMec.getStateSet());
+                for (auto const& stateChoicesPair : parallelMec) {
+                    ASSERT_TRUE(mec.containsState(stateChoicesPair.first));
+                    ASSERT_TRUE(mec.getChoicesForState(stateChoicesPair.first) == stateChoicesPair.second);
+                }
+            }
+        }
+        ASSERT_TRUE(found);
+    }
+}
@@ -1,4 +1,7 @@
 #include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -148,6 +151,127 @@ TEST(SparseMatrix, Build) {
     ASSERT_EQ(5ul, matrix5.getEntryCount());
 }
 
+TEST(SparseMatrixBuilder, SpillEntriesToDisk) {
+    // Builds the same matrix (with row groups and remapped columns) in memory and with at most two resident entries.
+    auto buildMatrix = [] (bool spill) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+        if (spill) {
+            matrixBuilder.spillEntriesToDisk(boost::filesystem::temp_directory_path().string(), 2);
+        }
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 1, 0.5);
+        matrixBuilder.addNextValue(0, 2, 0.5);
+        matrixBuilder.addNextValue(1, 0, 1.0);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.addNextValue(2, 3, 0.3);
+        matrixBuilder.addNextValue(2, 0, 0.7);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 2, 1.0);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.addNextValue(4, 1, 0.4);
+        matrixBuilder.addNextValue(4, 3, 0.6);
+        matrixBuilder.replaceColumns({3, 2, 1, 0}, 0);
+        return matrixBuilder.build();
+    };
+    
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(false);
+    storm::storage::SparseMatrix<double> spilledMatrix;
+    ASSERT_NO_THROW(spilledMatrix = buildMatrix(true));
+    EXPECT_EQ(7ul, spilledMatrix.getEntryCount());
+    EXPECT_EQ(4ul, spilledMatrix.getRowGroupCount());
+    EXPECT_TRUE(matrix == spilledMatrix);
+    
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_THROW(matrixBuilder.spillEntriesToDisk(boost::filesystem::temp_directory_path().string(), 2), storm::exceptions::InvalidStateException);
+}
+
+TEST(SparseMatrixBuilder, SpillFileOwnership) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directory(directory);
+    auto getNumberOfFiles = [&directory] () {
+        return std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator());
+    };
+    
+    // Moving the builder transfers the file, so it is neither removed by the moved-from builder nor leaked.
+    storm::storage::SparseMatrix<double> matrix;
+    {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.spillEntriesToDisk(directory.string(), 1);
+        matrixBuilder.addNextValue(0, 1, 1.0);
+        matrixBuilder.addNextValue(1, 0, 0.5);
+        matrixBuilder.addNextValue(2, 2, 0.7);
+        EXPECT_EQ(1, getNumberOfFiles());
+        
+        storm::storage::SparseMatrixBuilder<double> movedBuilder(std::move(matrixBuilder));
+        storm::storage::SparseMatrixBuilder<double> assignedBuilder;
+        assignedBuilder = std::move(movedBuilder);
+        EXPECT_EQ(1, getNumberOfFiles());
+        ASSERT_NO_THROW(matrix = assignedBuilder.build());
+    }
+    EXPECT_EQ(3ul, matrix.getEntryCount());
+    EXPECT_EQ(0.7, matrix.getRow(2).begin()->getValue());
+    
+    // A builder that is destroyed without building the matrix removes its file.
+    {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.spillEntriesToDisk(directory.string(), 1);
+        matrixBuilder.addNextValue(0, 1, 1.0);
+        matrixBuilder.addNextValue(1, 0, 0.5);
+        EXPECT_EQ(1, getNumberOfFiles());
+    }
+    EXPECT_EQ(0, getNumberOfFiles());
+    
+    // A copied builder gets its own file, so both builders can be continued and built independently.
+    {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.spillEntriesToDisk(directory.string(), 1);
+        matrixBuilder.addNextValue(0, 1, 1.0);
+        matrixBuilder.addNextValue(1, 0, 0.5);
+        storm::storage::SparseMatrixBuilder<double> copiedBuilder(matrixBuilder);
+        EXPECT_EQ(2, getNumberOfFiles());
+        matrixBuilder.addNextValue(2, 2, 0.7);
+        copiedBuilder.addNextValue(2, 1, 0.3);
+        storm::storage::SparseMatrix<double> copiedMatrix;
+        ASSERT_NO_THROW(matrix = matrixBuilder.build());
+        ASSERT_NO_THROW(copiedMatrix = copiedBuilder.build());
+        EXPECT_EQ(0.7, matrix.getRow(2).begin()->getValue());
+        EXPECT_EQ(0.3, copiedMatrix.getRow(2).begin()->getValue());
+        EXPECT_EQ(1.0, copiedMatrix.getRow(0).begin()->getValue());
+    }
+    EXPECT_EQ(0, getNumberOfFiles());
+    boost::filesystem::remove_all(directory);
+}
+
+TEST(SparseMatrixBuilder, SpillEntriesOfLongRow) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directory(directory);
+    
+    // A single row exceeds the number of resident entries many times, including out-of-order and duplicate entries.
+    auto buildMatrix = [&directory] (bool spill) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        if (spill) {
+            matrixBuilder.spillEntriesToDisk(directory.string(), 2);
+        }
+        for (uint_fast64_t column = 0; column < 10; ++column) {
+            matrixBuilder.addNextValue(0, 2 * column, 0.1);
+        }
+        matrixBuilder.addNextValue(0, 19, 0.5);
+        matrixBuilder.addNextValue(0, 19, 0.5);
+        matrixBuilder.addNextValue(0, 3, 0.2);
+        matrixBuilder.replaceColumns({19, 18}, 18);
+        return matrixBuilder.build();
+    };
+    
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(false);
+    storm::storage::SparseMatrix<double> spilledMatrix;
+    ASSERT_NO_THROW(spilledMatrix = buildMatrix(true));
+    EXPECT_EQ(12ul, spilledMatrix.getEntryCount());
+    EXPECT_TRUE(matrix == spilledMatrix);
+    EXPECT_EQ(0, std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator()));
+    boost::filesystem::remove_all(directory);
+}
+
 TEST(SparseMatrix, CreationWithMovingContents) {
     std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues;
     columnsAndValues.emplace_back(1, 1.0);
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BloomFilter.h"
+#include "storm/storage/SpillingBitVectorHashMap.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t number) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, number);
+        key.setFromInt(64, 64, number * 7 + 3);
+        return key;
+    }
+}
+
+TEST(BloomFilterTest, MayContain) {
+    storm::storage::BloomFilter filter(1000);
+    for (uint64_t number = 0; number < 1000; ++number) {
+        filter.add(createKey(number));
+    }
+    EXPECT_EQ(1000ul, filter.getNumberOfKeys());
+    
+    // There are no false negatives.
+    for (uint64_t number = 0; number < 1000; ++number) {
+        EXPECT_TRUE(filter.mayContain(createKey(number)));
+    }
+    
+    // With ten bits per key, the false positive rate is roughly one percent.
+    uint64_t falsePositives = 0;
+    for (uint64_t number = 1000; number < 11000; ++number) {
+        if (filter.mayContain(createKey(number))) {
+            ++falsePositives;
+        }
+    }
+    EXPECT_LT(falsePositives, 500ul);
+    
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain(createKey(0)));
+}
+
+TEST(SpillingBitVectorHashMapTest, FindOrAdd) {
+    std::string directory = boost::filesystem::temp_directory_path().string();
+    storm::storage::SpillingBitVectorHashMap<uint64_t> map(128, 100, directory, 8);
+    
+    // Insert far more keys than can be held in memory.
+    for (uint64_t number = 0; number < 2000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(createKey(number), number));
+    }
+    EXPECT_EQ(2000ul, map.size());
+    EXPECT_LE(map.getNumberOfResidentKeys(), 100ul);
+    
+    // Runs of similar size are merged, so there are only logarithmically many of them.
+    EXPECT_LE(map.getNumberOfRuns(), 8ul);
+    
+    // The keys written to disk are found again without loading them into memory.
+    uint64_t residentKeys = map.getNumberOfResidentKeys();
+    for (uint64_t number = 0; number < 2000; number += 7) {
+        EXPECT_EQ(number, map.findOrAdd(createKey(number), 0));
+    }
+    EXPECT_EQ(2000ul, map.size());
+    EXPECT_EQ(residentKeys, map.getNumberOfResidentKeys());
+    
+    // Keys that are smaller or larger than all keys of a run are not found in it.
+    EXPECT_EQ(2000ul, map.findOrAdd(storm::storage::BitVector(128), 2000));
+    storm::storage::BitVector largestKey(128, true);
+    EXPECT_EQ(2001ul, map.findOrAdd(largestKey, 2001));
+    EXPECT_EQ(2002ul, map.size());
+    
+    map.remap([] (uint64_t const& value) { return 2 * value; });
+    std::vector<bool> found(2002, false);
+    map.forEach([&found] (storm::storage::BitVector const& key, uint64_t const& value) {
+        if (value / 2 < 2000) {
+            EXPECT_EQ(createKey(value / 2), key);
+        }
+        EXPECT_FALSE(found[value / 2]);
+        found[value / 2] = true;
+    });
+    for (uint64_t number = 0; number < 2002; ++number) {
+        EXPECT_TRUE(found[number]);
+    }
+    EXPECT_EQ(20ul, map.findOrAdd(createKey(10), 0));
+}
@@ -3,9 +3,13 @@
 #include "storm/parser/AutoParser.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/CompactSccDecomposition.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include <algorithm>
+#include <set>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
 	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -78,3 +82,94 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ForwardBackward) {
+	std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny2.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny2.lab", "", "");
+
+	std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> markovAutomaton = abstractModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::storage::BitVector allStates(markovAutomaton->getNumberOfStates(), true);
+    
+    // The forward-backward algorithm has to find the same SCCs as the sequential one (possibly in a different order),
+    // regardless of the number of threads.
+    for (uint64_t numberOfThreads : {1, 4}) {
+        for (bool dropNaiveSccs : {false, true}) {
+            storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition(markovAutomaton->getTransitionMatrix(), allStates, dropNaiveSccs);
+            storm::storage::StronglyConnectedComponentDecomposition<double> forwardBackwardSccDecomposition;
+            ASSERT_NO_THROW(forwardBackwardSccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(markovAutomaton->getTransitionMatrix(), markovAutomaton->getBackwardTransitions(), allStates, dropNaiveSccs, numberOfThreads));
+            ASSERT_EQ(sccDecomposition.size(), forwardBackwardSccDecomposition.size());
+            
+            std::set<std::vector<uint_fast64_t>> sccs;
+            for (auto const& scc : sccDecomposition) {
+                sccs.emplace(scc.begin(), scc.end());
+            }
+            for (auto const& scc : forwardBackwardSccDecomposition) {
+                EXPECT_TRUE(sccs.find(std::vector<uint_fast64_t>(scc.begin(), scc.end())) != sccs.end());
+            }
+        }
+    }
+
+    markovAutomaton = nullptr;
+}
+
+TEST(StronglyConnectedComponentDecomposition, Compact) {
+	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 5, 0.7));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 1.0));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.4));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 0.3));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 0.3));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 4, 1.0));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.5));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 4, 0.5));
+	ASSERT_NO_THROW(matrixBuilder.addNextValue(5, 1, 1.0));
+
+	storm::storage::SparseMatrix<double> matrix;
+	ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    // The SCCs form a chain, so their (reverse topological) order is unique.
+    uint64_t longestChainSize = 0;
+    storm::storage::CompactSccDecomposition<double> sccDecomposition(matrix, false, false, &longestChainSize);
+    ASSERT_EQ(4ul, sccDecomposition.size());
+    EXPECT_EQ(4ul, longestChainSize);
+    EXPECT_EQ(std::vector<uint_fast64_t>({3, 4, 1, 2, 5, 0}), sccDecomposition.getStates());
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 4, 5, 6}), sccDecomposition.getSccIndications());
+    EXPECT_FALSE(sccDecomposition.getScc(0).isTrivial());
+    EXPECT_TRUE(sccDecomposition.getScc(2).isTrivial());
+    EXPECT_FALSE(sccDecomposition.getScc(3).isTrivial());
+    
+    sccDecomposition = storm::storage::CompactSccDecomposition<double>(matrix, true, false);
+    ASSERT_EQ(3ul, sccDecomposition.size());
+    EXPECT_EQ(std::vector<uint_fast64_t>({3, 4, 1, 2, 0}), sccDecomposition.getStates());
+    
+    sccDecomposition = storm::storage::CompactSccDecomposition<double>(matrix, true, true);
+    ASSERT_EQ(1ul, sccDecomposition.size());
+    EXPECT_EQ(std::vector<uint_fast64_t>({3, 4}), sccDecomposition.getStates());
+    
+    storm::storage::BitVector subsystem(6, true);
+    subsystem.set(2, false);
+    sccDecomposition = storm::storage::CompactSccDecomposition<double>(matrix, subsystem, true, false);
+    ASSERT_EQ(2ul, sccDecomposition.size());
+    std::vector<uint_fast64_t> states = sccDecomposition.getStates();
+    std::sort(states.begin(), states.end());
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 3, 4}), states);
+
+    // Compare against the regular decomposition on a larger system.
+	std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny2.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny2.lab", "", "");
+    for (bool dropNaiveSccs : {false, true}) {
+        for (bool onlyBottomSccs : {false, true}) {
+            storm::storage::StronglyConnectedComponentDecomposition<double> regularSccDecomposition(abstractModel->getTransitionMatrix(), dropNaiveSccs, onlyBottomSccs);
+            storm::storage::CompactSccDecomposition<double> compactSccDecomposition(abstractModel->getTransitionMatrix(), dropNaiveSccs, onlyBottomSccs);
+            ASSERT_EQ(regularSccDecomposition.size(), compactSccDecomposition.size());
+            
+            std::set<std::vector<uint_fast64_t>> sccs;
+            for (auto const& scc : regularSccDecomposition) {
+                sccs.emplace(scc.begin(), scc.end());
+            }
+            for (uint64_t sccIndex = 0; sccIndex < compactSccDecomposition.size(); ++sccIndex) {
+                auto scc = compactSccDecomposition.getScc(sccIndex);
+                EXPECT_TRUE(sccs.find(std::vector<uint_fast64_t>(scc.begin(), scc.end())) != sccs.end());
+            }
+        }
+    }
+}
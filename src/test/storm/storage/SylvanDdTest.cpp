@@ -731,6 +731,33 @@ TEST(SylvanDd, MultiplyMatrixTest) {
     EXPECT_TRUE(dd3 == dd2 * manager->template getConstant<double>(2));
 }
 
+TEST(SylvanDd, MultiplyMatrixAndAbstractTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    // The choice variable c is located above and d below the row and column variables.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> c = manager->addMetaVariable("c", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> d = manager->addMetaVariable("d", 0, 2);
+    
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> matrix = manager->template getIdentity<double>(x.first).greaterOrEqual(manager->template getIdentity<double>(x.second)).template toAdd<double>();
+    matrix *= manager->template getIdentity<double>(c.first) + manager->template getIdentity<double>(d.first) + manager->template getAddOne<double>();
+    matrix *= manager->getRange(c.first).template toAdd<double>() * manager->getRange(d.first).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> vector = manager->template getIdentity<double>(x.second);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> offset = manager->template getIdentity<double>(x.first) - manager->template getIdentity<double>(c.first);
+    
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> product = matrix.multiplyMatrix(vector, {x.second}) + offset;
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> result;
+    ASSERT_NO_THROW(result = matrix.multiplyMatrixAndAbstract(vector, {x.second}, offset, {c.first}, false));
+    EXPECT_TRUE(result == product.minAbstract({c.first}));
+    EXPECT_EQ(result.getContainedMetaVariables(), std::set<storm::expressions::Variable>({x.first, d.first}));
+    ASSERT_NO_THROW(result = matrix.multiplyMatrixAndAbstract(vector, {x.second}, offset, {c.first}, true));
+    EXPECT_TRUE(result == product.maxAbstract({c.first}));
+    ASSERT_NO_THROW(result = matrix.multiplyMatrixAndAbstract(vector, {x.second}, offset, {d.first}, false));
+    EXPECT_TRUE(result == product.minAbstract({d.first}));
+    ASSERT_NO_THROW(result = matrix.multiplyMatrixAndAbstract(vector, {x.second}, offset, {c.first, d.first}, true));
+    EXPECT_TRUE(result == product.maxAbstract({c.first, d.first}));
+    EXPECT_EQ(result.getContainedMetaVariables(), std::set<storm::expressions::Variable>({x.first}));
+}
+
 TEST(SylvanDd, GetSetValueTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
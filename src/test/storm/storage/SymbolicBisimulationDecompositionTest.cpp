@@ -7,6 +7,8 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
+#include "storm/storage/dd/bisimulation/PartitionRefiner.h"
 #include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
@@ -28,6 +30,33 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/settings/SettingsManager.h"
+
+namespace {
+    // Sets the given option of the bisimulation settings to the given value until the object is destroyed.
+    class BisimulationOptionMemento {
+    public:
+        BisimulationOptionMemento(std::string const& optionName, std::string const& value, std::string const& defaultValue) : optionName(optionName), defaultValue(defaultValue) {
+            storm::settings::mutableManager().setFromString("--bisimulation:" + optionName + " " + value);
+        }
+        
+        ~BisimulationOptionMemento() {
+            storm::settings::mutableManager().setFromString("--bisimulation:" + optionName + " " + defaultValue);
+        }
+        
+    private:
+        std::string optionName;
+        std::string defaultValue;
+    };
+    
+    template<typename ValueType>
+    void expectStochasticRows(storm::storage::SparseMatrix<ValueType> const& matrix) {
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(1.0, matrix.getRowSum(row), 1e-10) << "row " << row;
+        }
+    }
+}
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     
@@ -467,3 +496,195 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+TEST(SymbolicModelBisimulationDecomposition, IncrementalSignatures_Cudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram());
+    
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]"));
+    storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double> initialPartition = storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*model, storm::storage::BisimulationType::Strong, formulas);
+    
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> incrementalRefiner(*model, initialPartition, true);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> fullRefiner(*model, initialPartition);
+    
+    // Both refiners have to arrive at the very same partition in every round.
+    uint64_t rounds = 0;
+    bool refined = true;
+    while (refined) {
+        refined = fullRefiner.refine();
+        ASSERT_EQ(refined, incrementalRefiner.refine()) << "round " << rounds;
+        
+        storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double> const& fullPartition = fullRefiner.getStatePartition();
+        storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double> const& incrementalPartition = incrementalRefiner.getStatePartition();
+        EXPECT_EQ(fullPartition.getNumberOfBlocks(), incrementalPartition.getNumberOfBlocks()) << "round " << rounds;
+        ASSERT_EQ(fullPartition.storedAsBdd(), incrementalPartition.storedAsBdd());
+        if (fullPartition.storedAsBdd()) {
+            EXPECT_TRUE(fullPartition.asBdd() == incrementalPartition.asBdd()) << "round " << rounds;
+        } else {
+            EXPECT_TRUE(fullPartition.asAdd() == incrementalPartition.asAdd()) << "round " << rounds;
+        }
+        ++rounds;
+    }
+    EXPECT_GT(rounds, 3ul);
+    
+    // The quotients are the same as without incremental signatures.
+    BisimulationOptionMemento memento("refine", "incremental", "full");
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient();
+    EXPECT_EQ(2007ul, quotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, quotient->getNumberOfTransitions());
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition2.compute();
+    quotient = decomposition2.getQuotient();
+    EXPECT_EQ(65ul, quotient->getNumberOfStates());
+    EXPECT_EQ(105ul, quotient->getNumberOfTransitions());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, IncrementalSignatures_Sylvan) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+    
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]"));
+    storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> initialPartition = storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double>::create(*model, storm::storage::BisimulationType::Strong, formulas);
+    
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::Sylvan, double> incrementalRefiner(*model, initialPartition, true);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::Sylvan, double> fullRefiner(*model, initialPartition);
+    
+    // Both refiners have to arrive at the very same partition in every round.
+    uint64_t rounds = 0;
+    bool refined = true;
+    while (refined) {
+        refined = fullRefiner.refine();
+        ASSERT_EQ(refined, incrementalRefiner.refine()) << "round " << rounds;
+        
+        storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> const& fullPartition = fullRefiner.getStatePartition();
+        storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> const& incrementalPartition = incrementalRefiner.getStatePartition();
+        EXPECT_EQ(fullPartition.getNumberOfBlocks(), incrementalPartition.getNumberOfBlocks()) << "round " << rounds;
+        ASSERT_EQ(fullPartition.storedAsBdd(), incrementalPartition.storedAsBdd());
+        if (fullPartition.storedAsBdd()) {
+            EXPECT_TRUE(fullPartition.asBdd() == incrementalPartition.asBdd()) << "round " << rounds;
+        } else {
+            EXPECT_TRUE(fullPartition.asAdd() == incrementalPartition.asAdd()) << "round " << rounds;
+        }
+        ++rounds;
+    }
+    EXPECT_GT(rounds, 3ul);
+    
+    // The quotients are the same as without incremental signatures.
+    BisimulationOptionMemento memento("refine", "incremental", "full");
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient();
+    EXPECT_EQ(2007ul, quotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, quotient->getNumberOfTransitions());
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition2.compute();
+    quotient = decomposition2.getQuotient();
+    EXPECT_EQ(65ul, quotient->getNumberOfStates());
+    EXPECT_EQ(105ul, quotient->getNumberOfTransitions());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, SparseQuotient_Cudd) {
+    BisimulationOptionMemento memento("quot", "sparse", "dd");
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient();
+    
+    // The sparse quotient has the same size as the DD quotient and its rows are probability distributions.
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+    EXPECT_EQ(11ul, quotient->getNumberOfStates());
+    EXPECT_EQ(17ul, quotient->getNumberOfTransitions());
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+    
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]"));
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition2.compute();
+    quotient = decomposition2.getQuotient();
+    
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(5ul, quotient->getNumberOfStates());
+    EXPECT_EQ(8ul, quotient->getNumberOfTransitions());
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition3(*model, storm::storage::BisimulationType::Strong);
+    decomposition3.compute();
+    quotient = decomposition3.getQuotient();
+    
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(storm::models::ModelType::Mdp, quotient->getType());
+    EXPECT_EQ(77ul, quotient->getNumberOfStates());
+    EXPECT_EQ(210ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(116ul, (quotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices()));
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, SparseQuotient_Sylvan) {
+    BisimulationOptionMemento memento("quot", "sparse", "dd");
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient();
+    
+    // The sparse quotient has the same size as the DD quotient and its rows are probability distributions.
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+    EXPECT_EQ(11ul, quotient->getNumberOfStates());
+    EXPECT_EQ(17ul, quotient->getNumberOfTransitions());
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+    
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]"));
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition2.compute();
+    quotient = decomposition2.getQuotient();
+    
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(5ul, quotient->getNumberOfStates());
+    EXPECT_EQ(8ul, quotient->getNumberOfTransitions());
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition3(*model, storm::storage::BisimulationType::Strong);
+    decomposition3.compute();
+    quotient = decomposition3.getQuotient();
+    
+    ASSERT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(storm::models::ModelType::Mdp, quotient->getType());
+    EXPECT_EQ(77ul, quotient->getNumberOfStates());
+    EXPECT_EQ(210ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(116ul, (quotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices()));
+    expectStochasticRows(quotient->as<storm::models::sparse::Model<double>>()->getTransitionMatrix());
+}
@@ -15,6 +15,9 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
@@ -668,3 +671,80 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitParallelSearch) {
+    // A graph with two wide levels, so that every level is expanded in several chunks: state 0 leads to the states
+    // 1 to n and every state i of these leads to the state n + i.
+    uint64_t const n = 5000;
+    storm::storage::SparseMatrixBuilder<double> builder(2 * n + 1, 2 * n + 1);
+    for (uint64_t state = 1; state <= n; ++state) {
+        builder.addNextValue(0, state, 1.0 / n);
+    }
+    for (uint64_t state = 1; state <= n; ++state) {
+        builder.addNextValue(state, n + state, 1.0);
+    }
+    for (uint64_t state = n + 1; state <= 2 * n; ++state) {
+        builder.addNextValue(state, state, 1.0);
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    
+    for (uint64_t numberOfThreads : {1, 4}) {
+        storm::storage::BitVector reachedStates(2 * n + 1);
+        reachedStates.set(0);
+        storm::utility::graph::performParallelSearch(matrix, reachedStates, {0}, [] (uint_fast64_t state) { return state % 7 != 0; }, numberOfThreads);
+        for (uint64_t state = 0; state <= 2 * n; ++state) {
+            bool expected = state == 0 || (state % 7 != 0 && (state <= n || (state - n) % 7 != 0));
+            EXPECT_EQ(expected, reachedStates.get(state)) << "state " << state << " with " << numberOfThreads << " threads";
+        }
+    }
+}
+
+TEST(GraphTest, ExplicitProb01MultipleThreads) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    
+    storm::Environment env;
+    env.modelchecker().setGraphAnalysisNumberOfThreads(4);
+    uint64_t numberOfThreads = storm::utility::graph::getNumberOfGraphAnalysisThreads<double>(env);
+    ASSERT_EQ(4ull, numberOfThreads);
+    
+    // The results with multiple threads have to coincide with the sequential ones.
+    for (std::string const& label : {"observe0Greater1", "observeIGreater1", "observeOnlyTrueSender"}) {
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), allStates, model->getStates(label));
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelStatesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), allStates, model->getStates(label), numberOfThreads);
+        EXPECT_EQ(statesWithProbability01.first, parallelStatesWithProbability01.first) << label;
+        EXPECT_EQ(statesWithProbability01.second, parallelStatesWithProbability01.second) << label;
+    }
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+    allStates = storm::storage::BitVector(mdp->getNumberOfStates(), true);
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> minStatesWithProbability01 = storm::utility::graph::performProb01Min(*mdp, allStates, mdp->getStates("elected"));
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> maxStatesWithProbability01 = storm::utility::graph::performProb01Max(*mdp, allStates, mdp->getStates("elected"));
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(mdp->getTransitionMatrix(), mdp->getBackwardTransitions(), allStates, 1);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelStatesWithProbability01 = storm::utility::graph::performProb01Min(*mdp, allStates, mdp->getStates("elected"), numberOfThreads);
+    EXPECT_EQ(minStatesWithProbability01.first, parallelStatesWithProbability01.first);
+    EXPECT_EQ(minStatesWithProbability01.second, parallelStatesWithProbability01.second);
+    parallelStatesWithProbability01 = storm::utility::graph::performProb01Max(*mdp, allStates, mdp->getStates("elected"), numberOfThreads);
+    EXPECT_EQ(maxStatesWithProbability01.first, parallelStatesWithProbability01.first);
+    EXPECT_EQ(maxStatesWithProbability01.second, parallelStatesWithProbability01.second);
+    
+    // The MECs may be found in a different order, but their states have to coincide.
+    storm::storage::MaximalEndComponentDecomposition<double> parallelMecDecomposition(mdp->getTransitionMatrix(), mdp->getBackwardTransitions(), allStates, numberOfThreads);
+    ASSERT_EQ(mecDecomposition.size(), parallelMecDecomposition.size());
+    std::vector<storm::storage::BitVector> mecStates;
+    for (auto const& mec : mecDecomposition) {
+        mecStates.push_back(storm::storage::BitVector(mdp->getNumberOfStates(), mec.getStateSet().begin(), mec.getStateSet().end()));
+    }
+    for (auto const& mec : parallelMecDecomposition) {
+        storm::storage::BitVector states(mdp->getNumberOfStates(), mec.getStateSet().begin(), mec.getStateSet().end());
+        EXPECT_TRUE(std::find(mecStates.begin(), mecStates.end(), states) != mecStates.end());
+    }
+}
@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "storm/utility/ThreadPool.h"
+
+TEST(ThreadPoolTest, SharedPoolIsNotRecreated) {
+    storm::utility::ThreadPool& pool = storm::utility::getThreadPool();
+    
+    // Requesting a different number of threads must not invalidate the pool obtained before.
+    EXPECT_EQ(1ul, storm::utility::getNumberOfThreads(1));
+    EXPECT_EQ(pool.getNumberOfThreads(), storm::utility::getNumberOfThreads(0));
+    EXPECT_EQ(pool.getNumberOfThreads(), storm::utility::getNumberOfThreads(pool.getNumberOfThreads() + 5));
+    EXPECT_EQ(&pool, &storm::utility::getThreadPool());
+}
+
+TEST(ThreadPoolTest, Execute) {
+    storm::utility::ThreadPool pool(4);
+    
+    std::vector<std::atomic<uint64_t>> executions(1000);
+    for (auto& execution : executions) {
+        execution = 0;
+    }
+    pool.execute(executions.size(), [&] (uint64_t task) { ++executions[task]; });
+    for (auto const& execution : executions) {
+        EXPECT_EQ(1ul, execution.load());
+    }
+    
+    // Nested executions are performed sequentially by the calling thread.
+    std::atomic<uint64_t> nestedExecutions(0);
+    pool.execute(10, [&] (uint64_t) {
+        pool.execute(10, [&] (uint64_t) { ++nestedExecutions; });
+    });
+    EXPECT_EQ(100ul, nestedExecutions.load());
+    
+    EXPECT_THROW(pool.execute(100, [] (uint64_t task) {
+        if (task == 42) {
+            throw std::runtime_error("Task failed.");
+        }
+    }), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, ExecuteWithThreadLimit) {
+    storm::utility::ThreadPool pool(4);
+    
+    // Only the threads below the limit take part, so the thread indices stay below the limit.
+    for (uint64_t limit = 1; limit <= 3; ++limit) {
+        std::atomic<uint64_t> executions(0);
+        std::atomic<bool> indexBelowLimit(true);
+        pool.execute(1000, [&] (uint64_t) {
+            if (storm::utility::ThreadPool::getCurrentThreadIndex() >= limit) {
+                indexBelowLimit = false;
+            }
+            ++executions;
+        }, limit);
+        EXPECT_EQ(1000ul, executions.load());
+        EXPECT_TRUE(indexBelowLimit.load());
+    }
+}